@@ -0,0 +1,439 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Checks the neighborhood smoothers in data_plane_util.cc against
+   //  a direct loop over every point of the template:
+   //
+   //     UW_MEAN and fractional coverage, from the running sums
+   //     MIN and MAX of squares, from the van Herk/Gil-Werman blocks
+   //     MIN and MAX of circles, from the row deques
+   //     MEDIAN, from the running median
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const int n_sizes = 5;
+
+static const int test_nx [n_sizes] = { 1, 2, 7, 13, 30 };
+static const int test_ny [n_sizes] = { 1, 6, 3, 11, 20 };
+
+static const int n_widths = 5;
+
+static const int test_width [n_widths] = { 1, 3, 4, 7, 0 };   //  0:  wider than the grid
+
+static const int n_vld_thresh = 3;
+
+static const double test_vld_thresh [n_vld_thresh] = { 0.0, 0.5, 1.0 };
+
+static const int n_bad_fractions = 3;
+
+static const double test_bad_fraction [n_bad_fractions] = { 0.0, 0.2, 0.6 };
+
+static const double frac_thresh = 10.0;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <unistd.h>
+#include <stdlib.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "vx_util.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static ConcatString program_name;
+
+   //
+   //  the running sums are differences of prefix sums, so the means
+   //  can differ from the direct sums in the last few bits.  Bound that
+   //  at 1.0e-11 relative to the mean, or a couple of units in the last
+   //  place of a float DataPlane.  These grids see about 2.0e-13.
+   //
+
+static const double uw_mean_tol = max(1.0e-11, 2.0*numeric_limits<dataplane_t>::epsilon());
+
+   //
+   //  fractions are ratios of integer counts, and the minimum, maximum
+   //  and median are picked from the data, so those must match exactly
+   //
+
+static const int n_mthds = 5;
+
+static const InterpMthd test_mthd [n_mthds] = {
+   InterpMthd_UW_Mean, InterpMthd_Nbrhd,
+   InterpMthd_Min, InterpMthd_Max, InterpMthd_Median
+};
+
+static const int n_shapes = 2;
+
+static const GridTemplateFactory::GridTemplates test_shape [n_shapes] = {
+   GridTemplateFactory::GridTemplate_Square,
+   GridTemplateFactory::GridTemplate_Circle
+};
+
+static int n_checked = 0;
+static int n_failed  = 0;
+
+static double max_diff = 0.0;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static void random_field(int nx, int ny, double bad_fraction, bool non_finite, DataPlane &);
+
+static void direct_smooth(const DataPlane & in, InterpMthd, const GridTemplate &,
+                          double vld_thresh, const SingleThresh &, DataPlane & out);
+
+static bool same_value(double a, double b, double tol);
+
+static void compare(const DataPlane & a, const DataPlane & b, double tol,
+                    InterpMthd, const GridTemplate &, int width,
+                    double vld_thresh, double bad_fraction, bool non_finite);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int main(int argc, char * argv [])
+
+{
+
+int i, j, k, m, nf, s, t, width;
+DataPlane in, out, expected;
+GaussianInfo gaussian;
+GridTemplateFactory gtf;
+GridTemplate * gt = (GridTemplate *) 0;
+SingleThresh st;
+
+program_name = get_short_name(argv[0]);
+
+st.set(frac_thresh, thresh_ge);
+
+srand(1234);
+
+for (i=0; i<n_sizes; ++i)  {
+
+   for (j=0; j<n_widths; ++j)  {
+
+      width = test_width[j];
+
+      if ( width == 0 )  width = 2*max(test_nx[i], test_ny[i]) + 1;
+
+      for (s=0; s<n_shapes; ++s)  {
+
+         gt = gtf.buildGT(test_shape[s], width);
+
+         for (k=0; k<n_vld_thresh; ++k)  {
+
+            for (m=0; m<n_bad_fractions; ++m)  {
+
+               for (nf=0; nf<2; ++nf)  {
+
+                  random_field(test_nx[i], test_ny[i], test_bad_fraction[m], nf == 1, in);
+
+                  for (t=0; t<n_mthds; ++t)  {
+
+                     direct_smooth(in, test_mthd[t], *gt, test_vld_thresh[k], st, expected);
+
+                     if ( test_mthd[t] == InterpMthd_Nbrhd )  {
+
+                        fractional_coverage(in, out, width, test_shape[s], st, test_vld_thresh[k]);
+
+                     } else {
+
+                        smooth_field(in, out, test_mthd[t], width, test_shape[s],
+                                     test_vld_thresh[k], gaussian);
+
+                     }
+
+                     compare(out, expected,
+                             ( test_mthd[t] == InterpMthd_UW_Mean ? uw_mean_tol : 0.0 ),
+                             test_mthd[t], *gt, width, test_vld_thresh[k],
+                             test_bad_fraction[m], nf == 1);
+
+                  }
+
+               }
+
+            }
+
+         }
+
+         delete gt;  gt = (GridTemplate *) 0;
+
+      }
+
+   }
+
+}
+
+if ( n_failed > 0 )  {
+
+   cout << "\n\n  " << program_name << ": " << n_failed << " of " << n_checked
+        << " points FAILED\n\n";
+
+   return ( 1 );
+
+}
+
+cout << "\n\n  " << program_name << ": all " << n_checked << " points passed"
+     << ", largest UW_MEAN difference " << max_diff << "\n\n";
+
+   //
+   //  done
+   //
+
+return ( 0 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  values in [-50, 50], with ties, bad data at random points and,
+   //  if requested, a few infinities and NaNs
+   //
+
+void random_field(int nx, int ny, double bad_fraction, bool non_finite, DataPlane & dp)
+
+{
+
+int x, y, r;
+double v;
+
+dp.clear();
+
+dp.set_size(nx, ny);
+
+for (x=0; x<nx; ++x)  {
+
+   for (y=0; y<ny; ++y)  {
+
+      if ( rand()%4 == 0 )  v = (double) (rand()%11 - 5);
+      else                  v = 100.0*rand()/RAND_MAX - 50.0;
+
+      if ( rand() < bad_fraction*RAND_MAX )  v = bad_data_double;
+
+      if ( non_finite )  {
+
+         r = rand()%40;
+
+              if ( r == 0 )  v =  numeric_limits<double>::infinity();
+         else if ( r == 1 )  v = -numeric_limits<double>::infinity();
+         else if ( r == 2 )  v =  numeric_limits<double>::quiet_NaN();
+
+      }
+
+      dp.set(v, x, y);
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  each neighborhood gathered one point at a time, as the per-point
+   //  interp_*() routines did.  NaNs are bad data.  The median of an
+   //  odd count is the middle value, so that an infinite neighbor does
+   //  not make it 0*inf.
+   //
+
+void direct_smooth(const DataPlane & in, InterpMthd mthd, const GridTemplate & gt,
+                   double vld_thresh, const SingleThresh & st, DataPlane & out)
+
+{
+
+int x, y, j, n, n_thr, index;
+double v, sum, delta;
+vector<double> vals;
+const int num_points = gt.size();
+GridPoint * p = (GridPoint *) 0;
+
+out = in;
+
+for (x=0; x<in.nx(); ++x)  {
+
+   for (y=0; y<in.ny(); ++y)  {
+
+      vals.clear();
+
+      for (p=gt.getFirstInGrid(x, y, in.nx(), in.ny()); p; p=gt.getNextInGrid())  {
+
+         v = in(p->x, p->y);
+
+         if ( !::is_bad_data(v) )  vals.push_back(v);
+
+      }
+
+      n = vals.size();
+
+      if ( mthd == InterpMthd_Nbrhd )  {
+
+         for (j=n_thr=0; j<n; ++j)  if ( st.check(vals[j]) )  ++n_thr;
+
+         if ( n > 0 && (double) n/num_points >= vld_thresh )  v = (double) n_thr/n;
+         else                                                 v = bad_data_double;
+
+         out.set(v, x, y);
+
+         continue;
+
+      }
+
+      if ( num_points == 0 || (double) n/num_points < vld_thresh )  {
+
+         out.set(bad_data_double, x, y);
+
+         continue;
+
+      }
+
+         //
+         //  an empty neighborhood is 0/0 for the mean
+         //
+
+      if ( n == 0 )  {
+
+         out.set(( mthd == InterpMthd_UW_Mean ? numeric_limits<double>::quiet_NaN()
+                                              : bad_data_double ), x, y);
+
+         continue;
+
+      }
+
+      switch ( mthd )  {
+
+         case InterpMthd_UW_Mean:
+            for (j=0, sum=0.0; j<n; ++j)  sum += vals[j];
+            v = sum/n;
+            break;
+
+         case InterpMthd_Min:
+            v = vals[0];
+            for (j=1; j<n; ++j)  if ( vals[j] < v )  v = vals[j];
+            break;
+
+         case InterpMthd_Max:
+            v = vals[0];
+            for (j=1; j<n; ++j)  if ( vals[j] > v )  v = vals[j];
+            break;
+
+         case InterpMthd_Median:
+            sort(vals.begin(), vals.end());
+            index = nint(floor((n - 1)*0.50));
+            delta = (n - 1)*0.50 - index;
+            v = ( delta == 0.0 ? vals[index] : (1 - delta)*vals[index] + delta*vals[index + 1] );
+            break;
+
+         default:
+            v = bad_data_double;
+            break;
+
+      }
+
+      out.set(v, x, y);
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool same_value(double a, double b, double tol)
+
+{
+
+if ( std::isnan(a) || std::isnan(b) )  return ( std::isnan(a) && std::isnan(b) );
+
+if ( std::isinf(a) || std::isinf(b) )  return ( a == b );
+
+if ( ::is_bad_data(a) || ::is_bad_data(b) )  return ( ::is_bad_data(a) && ::is_bad_data(b) );
+
+if ( tol == 0.0 )  return ( a == b );
+
+max_diff = max(max_diff, fabs(a - b)/max(1.0, fabs(b)));
+
+return ( fabs(a - b) <= tol*max(1.0, fabs(b)) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void compare(const DataPlane & a, const DataPlane & b, double tol,
+             InterpMthd mthd, const GridTemplate & gt, int width,
+             double vld_thresh, double bad_fraction, bool non_finite)
+
+{
+
+int x, y;
+
+for (x=0; x<b.nx(); ++x)  {
+
+   for (y=0; y<b.ny(); ++y)  {
+
+      ++n_checked;
+
+      if ( same_value(a(x, y), b(x, y), tol) )  continue;
+
+      ++n_failed;
+
+      cout << "FAILED: " << interpmthd_to_string(mthd) << ", " << gt.getClassName()
+           << " width " << width << ", " << b.nx() << " x " << b.ny() << " grid"
+           << ", vld_thresh " << vld_thresh << ", bad fraction " << bad_fraction
+           << ( non_finite ? ", non-finite values" : "" )
+           << " at (" << x << ", " << y << "):  " << a(x, y)
+           << " != " << b(x, y) << "\n";
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,340 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Checks ShapeData::conv_filter_circ(), which adds up the circle
+   //  one chord per row from running row sums, against the direct
+   //  loop over every point of the circle that it replaced.
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const int n_sizes = 5;
+
+static const int test_nx [n_sizes] = { 1, 2, 6, 17, 40 };
+static const int test_ny [n_sizes] = { 1, 5, 4, 13, 33 };
+
+static const int n_diameters = 4;
+
+static const int test_diameter [n_diameters] = { 3, 5, 9, 0 };   //  0:  wider than the grid
+
+static const int n_vld_thresh = 4;
+
+static const double test_vld_thresh [n_vld_thresh] = { 0.0, 0.3, 0.5, 1.0 };
+
+static const int n_bad_fractions = 3;
+
+static const double test_bad_fraction [n_bad_fractions] = { 0.0, 0.2, 0.6 };
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <unistd.h>
+#include <stdlib.h>
+#include <cmath>
+#include <limits>
+
+#include "vx_util.h"
+#include "vx_shapedata.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static ConcatString program_name;
+
+   //
+   //  the running sums round differently than the direct sums, and
+   //  both are rounded to the DataPlane value type
+   //
+
+static const double test_tol = max(1.0e-9, 4.0*numeric_limits<dataplane_t>::epsilon());
+
+static int n_checked = 0;
+static int n_failed  = 0;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static void random_field(int nx, int ny, double bad_fraction, bool non_finite, DataPlane &);
+
+static void direct_conv_circ(const DataPlane & in, int diameter, double vld_thresh, DataPlane & out);
+
+static bool same_value(double a, double b);
+
+static void compare(const DataPlane & a, const DataPlane & b, int diameter,
+                    double vld_thresh, double bad_fraction, bool non_finite);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int main(int argc, char * argv [])
+
+{
+
+int i, j, k, m, nf, diameter;
+ShapeData sd;
+DataPlane in, expected;
+
+program_name = get_short_name(argv[0]);
+
+srand(1234);
+
+for (i=0; i<n_sizes; ++i)  {
+
+   for (j=0; j<n_diameters; ++j)  {
+
+      diameter = test_diameter[j];
+
+      if ( diameter == 0 )  diameter = 2*max(test_nx[i], test_ny[i]) + 3;
+
+      for (k=0; k<n_vld_thresh; ++k)  {
+
+         for (m=0; m<n_bad_fractions; ++m)  {
+
+            for (nf=0; nf<2; ++nf)  {
+
+               random_field(test_nx[i], test_ny[i], test_bad_fraction[m], nf == 1, in);
+
+               direct_conv_circ(in, diameter, test_vld_thresh[k], expected);
+
+               sd.data = in;
+
+               sd.conv_filter_circ(diameter, test_vld_thresh[k]);
+
+               compare(sd.data, expected, diameter, test_vld_thresh[k],
+                       test_bad_fraction[m], nf == 1);
+
+            }
+
+         }
+
+      }
+
+   }
+
+}
+
+if ( n_failed > 0 )  {
+
+   cout << "\n\n  " << program_name << ": " << n_failed << " of " << n_checked
+        << " points FAILED\n\n";
+
+   return ( 1 );
+
+}
+
+cout << "\n\n  " << program_name << ": all " << n_checked << " points passed\n\n";
+
+   //
+   //  done
+   //
+
+return ( 0 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  values in [-50, 50] with bad data at random points and, if
+   //  requested, a few infinities and NaNs
+   //
+
+void random_field(int nx, int ny, double bad_fraction, bool non_finite, DataPlane & dp)
+
+{
+
+int x, y, r;
+double v;
+
+dp.clear();
+
+dp.set_size(nx, ny);
+
+for (x=0; x<nx; ++x)  {
+
+   for (y=0; y<ny; ++y)  {
+
+      v = 100.0*rand()/RAND_MAX - 50.0;
+
+      if ( rand() < bad_fraction*RAND_MAX )  v = bad_data_double;
+
+      if ( non_finite )  {
+
+         r = rand()%40;
+
+              if ( r == 0 )  v =  numeric_limits<double>::infinity();
+         else if ( r == 1 )  v = -numeric_limits<double>::infinity();
+         else if ( r == 2 )  v =  numeric_limits<double>::quiet_NaN();
+
+      }
+
+      dp.set(v, x, y);
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  ShapeData::conv_filter_circ() as it was before it used row sums
+   //
+
+void direct_conv_circ(const DataPlane & in, int diameter, double vld_thresh, DataPlane & out)
+
+{
+
+int x, y, xx, yy, u, v;
+int count, bd_count;
+double center, cur, sum, vld_ratio;
+const int nx = in.nx();
+const int ny = in.ny();
+const int radius = (diameter - 1)/2;
+const bool vld_thresh_one = is_eq(vld_thresh, 1.0);
+bool center_bad;
+
+out = in;
+
+for (y=0; y<ny; ++y)  {
+
+   for (x=0; x<nx; ++x)  {
+
+      center = in(x, y);
+
+      center_bad = ::is_bad_data(center);
+
+      if ( center_bad && vld_thresh_one )  { out.set(bad_data_double, x, y);  continue; }
+
+      sum      = 0.0;
+      count    = 0;
+      bd_count = 0;
+
+      for (v=-radius; v<=radius; ++v)  {
+
+         yy = y + v;
+
+         if ( (yy < 0) || (yy >= ny) )  continue;
+
+         for (u=-radius; u<=radius; ++u)  {
+
+            xx = x + u;
+
+            if ( (xx < 0) || (xx >= nx) )  continue;
+
+            if ( sqrt( (double) (u*u + v*v) ) > radius )  continue;
+
+            cur = in(xx, yy);
+
+            if ( ::is_bad_data(cur) )  { bd_count++;  continue; }
+
+            sum += cur;
+
+            count++;
+
+         }
+
+      }
+
+      if ( count == 0 )  sum = bad_data_double;
+      else {
+
+         vld_ratio = ((double) count)/(bd_count + count);
+
+         if ( center_bad && (vld_ratio < vld_thresh) )  sum = bad_data_double;
+         else                                           sum /= count;
+
+      }
+
+      out.set(sum, x, y);
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool same_value(double a, double b)
+
+{
+
+if ( std::isnan(a) || std::isnan(b) )  return ( std::isnan(a) && std::isnan(b) );
+
+if ( std::isinf(a) || std::isinf(b) )  return ( a == b );
+
+if ( ::is_bad_data(a) || ::is_bad_data(b) )  return ( ::is_bad_data(a) && ::is_bad_data(b) );
+
+return ( fabs(a - b) <= test_tol*max(1.0, fabs(b)) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void compare(const DataPlane & a, const DataPlane & b, int diameter,
+             double vld_thresh, double bad_fraction, bool non_finite)
+
+{
+
+int x, y;
+
+for (x=0; x<b.nx(); ++x)  {
+
+   for (y=0; y<b.ny(); ++y)  {
+
+      ++n_checked;
+
+      if ( same_value(a(x, y), b(x, y)) )  continue;
+
+      ++n_failed;
+
+      cout << "FAILED: " << b.nx() << " x " << b.ny() << " grid, diameter " << diameter
+           << ", vld_thresh " << vld_thresh << ", bad fraction " << bad_fraction
+           << ( non_finite ? ", non-finite values" : "" )
+           << " at (" << x << ", " << y << "):  " << a(x, y)
+           << " != " << b(x, y) << "\n";
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,534 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Checks the jackknife statistics of the BCa intervals, which
+   //  compute_ci.cc derives from the full sample, against recomputing
+   //  the statistics from the remaining n-1 pairs:
+   //
+   //     CTS and NBRCTS, from the full 2x2 contingency table
+   //     MCTS, from the full multi-category contingency table
+   //     CNT, from the weighted partial sums and sorted errors
+   //     NBRCNT, from the weighted partial sums
+   //
+   //  The CNT and NBRCNT statistics of the remaining pairs are found
+   //  with compute_cntinfo() and compute_nbrcntinfo() on a copy of the
+   //  pairs without the left-out one, so that the weights are
+   //  normalized over the remaining pairs, as in compute_ci.cc.
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const int n_sizes = 6;
+
+static const int test_n [n_sizes] = { 2, 3, 4, 9, 40, 151 };
+
+static const int n_mcts_thresh = 3;
+
+static const double mcts_thresh [n_mcts_thresh] = { -5.0, 0.0, 5.0 };
+
+   //
+   //  the partial sums are found by subtraction, so the CNT and NBRCNT
+   //  statistics can differ from the direct sums in the last few bits
+   //
+
+static const double sums_tol = 1.0e-9;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <unistd.h>
+#include <stdlib.h>
+#include <cmath>
+
+#include "vx_util.h"
+#include "vx_statistics.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static ConcatString program_name;
+
+static int n_checked = 0;
+static int n_failed  = 0;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static void random_pairs(int n, bool climo_flag, bool wgt_flag, bool tie_flag,
+                         PairDataPoint & pd, PairDataPoint & pd_thr);
+
+static void remove_pair(const PairDataPoint &, int skip, PairDataPoint &);
+
+static void all_pairs(const PairDataPoint &, NumArray &);
+
+static void check_cts    (const PairDataPoint &, const SingleThresh &, const SingleThresh &, const char *);
+static void check_mcts   (const PairDataPoint &, const char *);
+static void check_cnt    (const PairDataPoint &, const char *);
+static void check_nbrcnt (const PairDataPoint &, const PairDataPoint &, const char *);
+
+static void check_value(const char * family, const char * stat, const char * desc,
+                        int skip, double jack, double direct, double tol);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int main(int argc, char * argv [])
+
+{
+
+int i, climo, wgt, tie;
+PairDataPoint pd, pd_thr;
+SingleThresh ge_zero, ge_big, lt_big;
+ConcatString desc;
+
+program_name = get_short_name(argv[0]);
+
+ge_zero.set(0.0, thresh_ge);
+ge_big.set(1000.0, thresh_ge);
+lt_big.set(1000.0, thresh_lt);
+
+srand(1234);
+
+for (i=0; i<n_sizes; ++i)  {
+
+   for (climo=0; climo<2; ++climo)  {
+
+      for (wgt=0; wgt<2; ++wgt)  {
+
+         for (tie=0; tie<2; ++tie)  {
+
+            random_pairs(test_n[i], climo == 1, wgt == 1, tie == 1, pd, pd_thr);
+
+            desc.clear();
+            desc << test_n[i] << " pairs"
+                 << ( climo ? ", climatology" : "" )
+                 << ( wgt   ? ", weighted" : "" )
+                 << ( tie   ? ", ties" : "" );
+
+               //
+               //  the thresholds that no pair or every pair meets leave
+               //  empty cells, and so bad data statistics
+               //
+
+            check_cts(pd, ge_zero, ge_zero, desc.c_str());
+            check_cts(pd, ge_big,  ge_zero, desc.c_str());
+            check_cts(pd, ge_zero, lt_big,  desc.c_str());
+
+            check_mcts(pd, desc.c_str());
+
+            check_cnt(pd, desc.c_str());
+
+            check_nbrcnt(pd, pd_thr, desc.c_str());
+
+         }
+
+      }
+
+   }
+
+}
+
+if ( n_failed > 0 )  {
+
+   cout << "\n\n  " << program_name << ": " << n_failed << " of " << n_checked
+        << " statistics FAILED\n\n";
+
+   return ( 1 );
+
+}
+
+cout << "\n\n  " << program_name << ": all " << n_checked << " statistics passed\n\n";
+
+   //
+   //  done
+   //
+
+return ( 0 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  pairs in about [-15, 15] with optional climatology and weights.
+   //  With ties, the values are rounded so that many of the errors,
+   //  and their deviations from the median, are equal.  The
+   //  neighborhood pairs are the same values rescaled to [0, 1], with
+   //  the event flags set where they are at least 0.5.
+   //
+
+void random_pairs(int n, bool climo_flag, bool wgt_flag, bool tie_flag,
+                  PairDataPoint & pd, PairDataPoint & pd_thr)
+
+{
+
+int i;
+double f, o, c, w;
+
+pd.clear();
+pd_thr.clear();
+
+for (i=0; i<n; ++i)  {
+
+   o = 20.0*rand()/RAND_MAX - 10.0;
+   f = o + 10.0*rand()/RAND_MAX - 5.0;
+   c = ( climo_flag ? 4.0*rand()/RAND_MAX - 2.0 : bad_data_double );
+   w = ( wgt_flag   ? 0.5 + rand()/(double) RAND_MAX : 1.0 );
+
+   if ( tie_flag )  { f = nint(f/2.0)*2.0;  o = nint(o/2.0)*2.0; }
+
+   pd.add_grid_pair(f, o, c, bad_data_double, w);
+
+   f = (f + 15.0)/30.0;
+   o = (o + 15.0)/30.0;
+
+   pd_thr.add_grid_pair(( f >= 0.5 ? 1.0 : 0.0 ), ( o >= 0.5 ? 1.0 : 0.0 ),
+                        bad_data_double, bad_data_double, w);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void remove_pair(const PairDataPoint & pd, int skip, PairDataPoint & out)
+
+{
+
+int i;
+
+out.clear();
+
+for (i=0; i<pd.f_na.n(); ++i)  {
+
+   if ( i == skip )  continue;
+
+   out.add_grid_pair(pd.f_na[i], pd.o_na[i], pd.cmn_na[i], pd.csd_na[i], pd.wgt_na[i]);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void all_pairs(const PairDataPoint & pd, NumArray & i_na)
+
+{
+
+i_na.clear();
+
+i_na.add_seq(0, pd.f_na.n() - 1);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void check_cts(const PairDataPoint & pd, const SingleThresh & ft,
+               const SingleThresh & ot, const char * desc)
+
+{
+
+int i, k;
+NumArray i_na;
+CTSInfo full, jack, direct;
+ConcatString cs;
+
+full.fthresh = direct.fthresh = ft;
+full.othresh = direct.othresh = ot;
+
+all_pairs(pd, i_na);
+
+compute_ctsinfo(pd, i_na, true, false, full);
+
+cs << desc << ", " << ft.get_str() << " " << ot.get_str();
+
+for (i=0; i<pd.f_na.n(); ++i)  {
+
+   compute_i_ctsinfo(pd, i, false, direct);
+
+   k = cts_jack_cell(full, pd, i);
+
+   jack.cts = full.cts;
+
+   if ( !dec_cts_jack_cell(jack.cts, k) )  {
+
+      check_value("CTS", "cell", cs.c_str(), i, k, bad_data_double, 0.0);
+
+      continue;
+
+   }
+
+   jack.compute_stats();
+
+   check_value("CTS", "BASER", cs.c_str(), i, jack.baser.v, direct.baser.v, 0.0);
+   check_value("CTS", "FMEAN", cs.c_str(), i, jack.fmean.v, direct.fmean.v, 0.0);
+   check_value("CTS", "ACC",   cs.c_str(), i, jack.acc.v,   direct.acc.v,   0.0);
+   check_value("CTS", "FBIAS", cs.c_str(), i, jack.fbias.v, direct.fbias.v, 0.0);
+   check_value("CTS", "PODY",  cs.c_str(), i, jack.pody.v,  direct.pody.v,  0.0);
+   check_value("CTS", "PODN",  cs.c_str(), i, jack.podn.v,  direct.podn.v,  0.0);
+   check_value("CTS", "POFD",  cs.c_str(), i, jack.pofd.v,  direct.pofd.v,  0.0);
+   check_value("CTS", "FAR",   cs.c_str(), i, jack.far.v,   direct.far.v,   0.0);
+   check_value("CTS", "CSI",   cs.c_str(), i, jack.csi.v,   direct.csi.v,   0.0);
+   check_value("CTS", "GSS",   cs.c_str(), i, jack.gss.v,   direct.gss.v,   0.0);
+   check_value("CTS", "HK",    cs.c_str(), i, jack.hk.v,    direct.hk.v,    0.0);
+   check_value("CTS", "HSS",   cs.c_str(), i, jack.hss.v,   direct.hss.v,   0.0);
+   check_value("CTS", "ODDS",  cs.c_str(), i, jack.odds.v,  direct.odds.v,  0.0);
+   check_value("CTS", "LODDS", cs.c_str(), i, jack.lodds.v, direct.lodds.v, 0.0);
+   check_value("CTS", "ORSS",  cs.c_str(), i, jack.orss.v,  direct.orss.v,  0.0);
+   check_value("CTS", "EDS",   cs.c_str(), i, jack.eds.v,   direct.eds.v,   0.0);
+   check_value("CTS", "SEDS",  cs.c_str(), i, jack.seds.v,  direct.seds.v,  0.0);
+   check_value("CTS", "EDI",   cs.c_str(), i, jack.edi.v,   direct.edi.v,   0.0);
+   check_value("CTS", "SEDI",  cs.c_str(), i, jack.sedi.v,  direct.sedi.v,  0.0);
+   check_value("CTS", "BAGSS", cs.c_str(), i, jack.bagss.v, direct.bagss.v, 0.0);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void check_mcts(const PairDataPoint & pd, const char * desc)
+
+{
+
+int i, k, r, c, n_cat;
+NumArray i_na;
+ThreshArray ta;
+MCTSInfo full, jack, direct;
+
+for (i=0; i<n_mcts_thresh; ++i)  ta.add(mcts_thresh[i], thresh_lt);
+
+n_cat = ta.n() + 1;
+
+full.cts.set_size(n_cat);
+full.set_fthresh(ta);
+full.set_othresh(ta);
+
+direct = full;
+
+all_pairs(pd, i_na);
+
+compute_mctsinfo(pd, i_na, true, false, full);
+
+for (i=0; i<pd.f_na.n(); ++i)  {
+
+   compute_i_mctsinfo(pd, i, false, direct);
+
+   k = mcts_jack_cell(full, pd, i);
+
+   if ( k < 0 || full.cts.entry(k/n_cat, k%n_cat) <= 0 )  {
+
+      check_value("MCTS", "cell", desc, i, k, bad_data_double, 0.0);
+
+      continue;
+
+   }
+
+   r = k/n_cat;
+   c = k%n_cat;
+
+   jack = full;
+
+   jack.cts.set_entry(r, c, full.cts.entry(r, c) - 1);
+
+   jack.compute_stats();
+
+   check_value("MCTS", "ACC", desc, i, jack.acc.v, direct.acc.v, 0.0);
+   check_value("MCTS", "HK",  desc, i, jack.hk.v,  direct.hk.v,  0.0);
+   check_value("MCTS", "HSS", desc, i, jack.hss.v, direct.hss.v, 0.0);
+   check_value("MCTS", "GER", desc, i, jack.ger.v, direct.ger.v, 0.0);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void check_cnt(const PairDataPoint & pd, const char * desc)
+
+{
+
+int i;
+NumArray i_na;
+PairDataPoint pd_i;
+CNTJackSums sums;
+CNTInfo jack, direct;
+const double t = sums_tol;
+
+compute_cnt_jack_sums(pd, sums);
+
+for (i=0; i<pd.f_na.n(); ++i)  {
+
+   remove_pair(pd, i, pd_i);
+
+   all_pairs(pd_i, i_na);
+
+   compute_cntinfo(pd_i, i_na, false, false, false, direct);
+
+   compute_i_cnt_jack(sums, pd, i, jack);
+
+   check_value("CNT", "N", desc, i, jack.n, direct.n, 0.0);
+
+   check_value("CNT", "FBAR",      desc, i, jack.fbar.v,      direct.fbar.v,      t);
+   check_value("CNT", "FSTDEV",    desc, i, jack.fstdev.v,    direct.fstdev.v,    t);
+   check_value("CNT", "OBAR",      desc, i, jack.obar.v,      direct.obar.v,      t);
+   check_value("CNT", "OSTDEV",    desc, i, jack.ostdev.v,    direct.ostdev.v,    t);
+   check_value("CNT", "PR_CORR",   desc, i, jack.pr_corr.v,   direct.pr_corr.v,   t);
+   check_value("CNT", "ANOM_CORR", desc, i, jack.anom_corr.v, direct.anom_corr.v, t);
+   check_value("CNT", "RMSFA",     desc, i, jack.rmsfa.v,     direct.rmsfa.v,     t);
+   check_value("CNT", "RMSOA",     desc, i, jack.rmsoa.v,     direct.rmsoa.v,     t);
+   check_value("CNT", "ME",        desc, i, jack.me.v,        direct.me.v,        t);
+   check_value("CNT", "ME2",       desc, i, jack.me2.v,       direct.me2.v,       t);
+   check_value("CNT", "ESTDEV",    desc, i, jack.estdev.v,    direct.estdev.v,    t);
+   check_value("CNT", "MBIAS",     desc, i, jack.mbias.v,     direct.mbias.v,     t);
+   check_value("CNT", "MAE",       desc, i, jack.mae.v,       direct.mae.v,       t);
+   check_value("CNT", "MSE",       desc, i, jack.mse.v,       direct.mse.v,       t);
+   check_value("CNT", "MSESS",     desc, i, jack.msess.v,     direct.msess.v,     t);
+   check_value("CNT", "BCMSE",     desc, i, jack.bcmse.v,     direct.bcmse.v,     t);
+   check_value("CNT", "RMSE",      desc, i, jack.rmse.v,      direct.rmse.v,      t);
+
+      //
+      //  the percentiles are picked from the same sorted errors
+      //
+
+   check_value("CNT", "E10",  desc, i, jack.e10.v,  direct.e10.v,  0.0);
+   check_value("CNT", "E25",  desc, i, jack.e25.v,  direct.e25.v,  0.0);
+   check_value("CNT", "E50",  desc, i, jack.e50.v,  direct.e50.v,  0.0);
+   check_value("CNT", "E75",  desc, i, jack.e75.v,  direct.e75.v,  0.0);
+   check_value("CNT", "E90",  desc, i, jack.e90.v,  direct.e90.v,  0.0);
+   check_value("CNT", "EIQR", desc, i, jack.eiqr.v, direct.eiqr.v, 0.0);
+   check_value("CNT", "MAD",  desc, i, jack.mad.v,  direct.mad.v,  0.0);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void check_nbrcnt(const PairDataPoint & pd, const PairDataPoint & pd_thr,
+                  const char * desc)
+
+{
+
+int i;
+NumArray i_na;
+PairDataPoint pd_i, pd_thr_i;
+NBRCNTJackSums sums;
+NBRCNTInfo jack, direct;
+const double t = sums_tol;
+
+compute_nbrcnt_jack_sums(pd, pd_thr, sums);
+
+for (i=0; i<pd.f_na.n(); ++i)  {
+
+   remove_pair(pd,     i, pd_i);
+   remove_pair(pd_thr, i, pd_thr_i);
+
+   all_pairs(pd_i, i_na);
+
+   compute_nbrcntinfo(pd_i, pd_thr_i, i_na, direct, true);
+
+   compute_i_nbrcnt_jack(sums, pd, pd_thr, i, jack);
+
+   check_value("NBRCNT", "FBS",    desc, i, jack.fbs.v,    direct.fbs.v,    t);
+   check_value("NBRCNT", "FSS",    desc, i, jack.fss.v,    direct.fss.v,    t);
+   check_value("NBRCNT", "AFSS",   desc, i, jack.afss.v,   direct.afss.v,   t);
+   check_value("NBRCNT", "UFSS",   desc, i, jack.ufss.v,   direct.ufss.v,   t);
+   check_value("NBRCNT", "F_RATE", desc, i, jack.f_rate.v, direct.f_rate.v, t);
+   check_value("NBRCNT", "O_RATE", desc, i, jack.o_rate.v, direct.o_rate.v, t);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void check_value(const char * family, const char * stat, const char * desc,
+                 int skip, double jack, double direct, double tol)
+
+{
+
+bool same;
+
+++n_checked;
+
+if ( ::is_bad_data(jack) || ::is_bad_data(direct) )  {
+
+   same = ( ::is_bad_data(jack) && ::is_bad_data(direct) );
+
+} else if ( tol == 0.0 )  {
+
+   same = ( jack == direct );
+
+} else {
+
+   same = ( fabs(jack - direct) <= tol*max(1.0, fabs(direct)) );
+
+}
+
+if ( same )  return;
+
+++n_failed;
+
+cout << "FAILED: " << family << " " << stat << ", " << desc
+     << ", pair " << skip << " left out:  " << jack
+     << " != " << direct << "\n";
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,641 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Checks that object labeling with UnionFind numbers the objects
+   //  of fragmented fields the same way as the partitions it replaced:
+   //  the MODE Partition class, which moved the last set into the slot
+   //  vacated by a merge, and Mtd_Partition, which keeps the sets in
+   //  order of their first label.
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const int n_sizes = 5;
+
+static const int test_nx [n_sizes] = { 1, 2, 7, 40, 123 };
+static const int test_ny [n_sizes] = { 1, 3, 5, 30,  77 };
+
+static const int n_densities = 4;
+
+static const double test_density [n_densities] = { 0.2, 0.4, 0.55, 0.7 };
+
+static const int n_trials = 25;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <unistd.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "vx_util.h"
+
+#include "mtd_partition.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static ConcatString program_name;
+
+static int n_failed = 0;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The sets of the MODE Partition class:  a merge combines the two
+   //  sets into the lower slot and moves the last set into the higher
+   //
+
+class ModePartition {
+
+   public:
+
+      vector< vector<int> > c;
+
+      int which_cell(int k) const;
+
+      void add(int k);
+
+      void merge_values(int v1, int v2);
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static void random_field(int nx, int ny, double density, bool zero_edges, vector<int> & f);
+
+static void label_mode_partition   (const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes);
+static void label_mode_union_find  (const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes);
+
+static void label_mtd_partition    (const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes);
+static void label_mtd_union_find   (const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes);
+
+static void check_last_set_moves();
+
+static void check(bool ok, const char * what, int nx, int ny, double density, int trial);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int main(int argc, char * argv [])
+
+{
+
+int j, k, trial, nx, ny, n_a, n_b;
+double density;
+vector<int> f, a, b;
+
+program_name = get_short_name(argv[0]);
+
+srand(1234);
+
+check_last_set_moves();
+
+for (j=0; j<n_sizes; ++j)  {
+
+   nx = test_nx[j];
+   ny = test_ny[j];
+
+   for (k=0; k<n_densities; ++k)  {
+
+      density = test_density[k];
+
+      for (trial=0; trial<n_trials; ++trial)  {
+
+         random_field(nx, ny, density, false, f);
+
+         label_mode_partition  (f, nx, ny, a, n_a);
+         label_mode_union_find (f, nx, ny, b, n_b);
+
+         check(n_a == n_b && a == b, "MODE split", nx, ny, density, trial);
+
+            //
+            //  the MTD scan requires the last row and column to be empty
+            //
+
+         random_field(nx, ny, density, true, f);
+
+         label_mtd_partition  (f, nx, ny, a, n_a);
+         label_mtd_union_find (f, nx, ny, b, n_b);
+
+         check(n_a == n_b && a == b, "MTD split_const_t", nx, ny, density, trial);
+
+      }
+
+   }
+
+}
+
+if ( n_failed > 0 )  {
+
+   cout << "\n\n  " << program_name << ": " << n_failed << " check(s) FAILED\n\n";
+
+   return ( 1 );
+
+}
+
+cout << "\n\n  " << program_name << ": all checks passed\n\n";
+
+   //
+   //  done
+   //
+
+return ( 0 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void check(bool ok, const char * what, int nx, int ny, double density, int trial)
+
+{
+
+if ( ok )  return;
+
+++n_failed;
+
+cout << "FAILED: " << what << " labeling differs for a " << nx << " x " << ny
+     << " field with density " << density << " (trial " << trial << ")\n";
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Five singletons with labels 1 to 5 in slots 0 to 4.  Merging
+   //  labels 2 and 3 empties slot 2, so label 5 moves from slot 4
+   //  into it.
+   //
+
+void check_last_set_moves()
+
+{
+
+int j;
+UnionFind uf;
+ModePartition p;
+vector<int> index;
+
+for (j=1; j<=5; ++j)  { uf.add();  p.add(j); }
+
+uf.merge(2, 3);
+p.merge_values(2, 3);
+
+check(uf.n_sets() == 4 && (int) p.c.size() == 4, "set count after merge", 5, 1, 0.0, 0);
+
+check(uf.set_index(5) == 2, "last set moved into the vacated slot", 5, 1, 0.0, 0);
+
+for (j=1; j<=5; ++j)  {
+
+   check(uf.set_index(j) == p.which_cell(j), "set index after merge", 5, 1, 0.0, j);
+
+}
+
+   //
+   //  merging the moved set again moves label 4 down
+   //
+
+uf.merge(5, 1);
+p.merge_values(5, 1);
+
+for (j=1; j<=5; ++j)  {
+
+   check(uf.set_index(j) == p.which_cell(j), "set index after second merge", 5, 1, 0.0, j);
+
+}
+
+   //
+   //  the MTD numbering orders the sets by their smallest label
+   //
+
+uf.ordered_set_index(index);
+
+check(index[1] == 0 && index[2] == 1 && index[3] == 1 &&
+      index[4] == 2 && index[5] == 0, "ordered set index", 5, 1, 0.0, 0);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void random_field(int nx, int ny, double density, bool zero_edges, vector<int> & f)
+
+{
+
+int x, y;
+
+f.assign(nx*ny, 0);
+
+for (y=0; y<ny; ++y)  {
+
+   for (x=0; x<nx; ++x)  {
+
+      if ( zero_edges && ((x == nx - 1) || (y == ny - 1)) )  continue;
+
+      f[y*nx + x] = ( rand() < density*RAND_MAX ? 1 : 0 );
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The labeling done by split() in vx_shapedata before it used
+   //  UnionFind
+   //
+
+void label_mode_partition(const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes)
+
+{
+
+int j, k, x, y, xx, yy;
+int current_shape = 0;
+bool shape_assigned;
+vector<int> d(nx*ny, 0);
+ModePartition p;
+
+static const int nbr_dx[] = { -1, 0, 1, 1 };
+static const int nbr_dy[] = {  1, 1, 1, 0 };
+
+for (y=(ny - 2); y>=0; --y)  {
+
+   for (x=(nx - 2); x>=0; --x)  {
+
+      if ( !f[y*nx + x] )  continue;
+
+      shape_assigned = false;
+
+      for (k=0; k<4; ++k)  {
+
+         xx = x + nbr_dx[k];
+         yy = y + nbr_dy[k];
+
+         if ( (xx < 0) || (xx >= nx) || (yy >= ny) || !f[yy*nx + xx] )  continue;
+
+         if ( shape_assigned )  p.merge_values(d[y*nx + x], d[yy*nx + xx]);
+         else                   d[y*nx + x] = d[yy*nx + xx];
+
+         shape_assigned = true;
+
+      }
+
+      if ( !shape_assigned )  {
+
+         d[y*nx + x] = ++current_shape;
+
+         p.add(current_shape);
+
+      }
+
+   }
+
+}
+
+out.assign(nx*ny, 0);
+
+for (j=0; j<nx*ny; ++j)  out[j] = p.which_cell(d[j]) + 1;
+
+n_shapes = (int) p.c.size();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The labeling done by split() in vx_shapedata now
+   //
+
+void label_mode_union_find(const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes)
+
+{
+
+int j, k, x, y, xx, yy;
+int label, nbr;
+bool shape_assigned;
+vector<int> d(nx*ny, 0);
+vector<int> shape;
+UnionFind uf;
+
+static const int nbr_dx[] = { -1, 0, 1, 1 };
+static const int nbr_dy[] = {  1, 1, 1, 0 };
+
+for (y=(ny - 2); y>=0; --y)  {
+
+   for (x=(nx - 2); x>=0; --x)  {
+
+      if ( !f[y*nx + x] )  continue;
+
+      label = 0;
+
+      shape_assigned = false;
+
+      for (k=0; k<4; ++k)  {
+
+         xx = x + nbr_dx[k];
+         yy = y + nbr_dy[k];
+
+         if ( (xx < 0) || (xx >= nx) || (yy >= ny) || !f[yy*nx + xx] )  continue;
+
+         nbr = d[yy*nx + xx];
+
+         if ( shape_assigned )  { if ( (label > 0) && (nbr > 0) )  uf.merge(label, nbr); }
+         else                   label = nbr;
+
+         shape_assigned = true;
+
+      }
+
+      if ( !shape_assigned )  label = uf.add();
+
+      d[y*nx + x] = label;
+
+   }
+
+}
+
+shape.assign(uf.n_labels() + 1, 0);
+
+for (j=1; j<=uf.n_labels(); ++j)  shape[j] = uf.set_index(j) + 1;
+
+out.assign(nx*ny, 0);
+
+for (j=0; j<nx*ny; ++j)  out[j] = shape[d[j]];
+
+n_shapes = uf.n_sets();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The labeling done by MtdIntFile::split_const_t() before it used
+   //  UnionFind
+   //
+
+void label_mtd_partition(const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes)
+
+{
+
+int j, k, x, y, xx, yy;
+int current_shape = 0;
+bool shape_assigned;
+vector<int> d(nx*ny, 0);
+Mtd_Partition p;
+
+static const int nbr_dx[] = { -1, 0, 1, 1 };
+static const int nbr_dy[] = {  1, 1, 1, 0 };
+
+for (y=(ny - 2); y>=0; --y)  {
+
+   for (x=(nx - 2); x>=0; --x)  {
+
+      if ( !f[y*nx + x] )  continue;
+
+      shape_assigned = false;
+
+      for (k=0; k<4; ++k)  {
+
+         xx = x + nbr_dx[k];
+         yy = y + nbr_dy[k];
+
+         if ( (xx < 0) || (xx >= nx) || (yy >= ny) || !f[yy*nx + xx] )  continue;
+
+         if ( shape_assigned )  p.merge_values(d[y*nx + x], d[yy*nx + xx]);
+         else                   d[y*nx + x] = d[yy*nx + xx];
+
+         shape_assigned = true;
+
+      }
+
+      if ( !shape_assigned )  {
+
+         d[y*nx + x] = ++current_shape;
+
+         p.add_no_repeat(current_shape);
+
+      }
+
+   }
+
+}
+
+out.assign(nx*ny, 0);
+
+for (j=0; j<nx*ny; ++j)  {
+
+   for (k=0; k<(p.n_elements()); ++k)  {
+
+      if ( p.has(k, d[j]) )  { out[j] = k + 1;  break; }
+
+   }
+
+}
+
+n_shapes = p.n_elements();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The labeling done by MtdIntFile::split_const_t() now
+   //
+
+void label_mtd_union_find(const vector<int> & f, int nx, int ny, vector<int> & out, int & n_shapes)
+
+{
+
+int j, k, x, y, xx, yy;
+int label, nbr;
+bool shape_assigned;
+vector<int> d(nx*ny, 0);
+vector<int> index;
+UnionFind uf;
+
+static const int nbr_dx[] = { -1, 0, 1, 1 };
+static const int nbr_dy[] = {  1, 1, 1, 0 };
+
+for (y=(ny - 2); y>=0; --y)  {
+
+   for (x=(nx - 2); x>=0; --x)  {
+
+      if ( !f[y*nx + x] )  continue;
+
+      label = 0;
+
+      shape_assigned = false;
+
+      for (k=0; k<4; ++k)  {
+
+         xx = x + nbr_dx[k];
+         yy = y + nbr_dy[k];
+
+         if ( (xx < 0) || (xx >= nx) || (yy >= ny) || !f[yy*nx + xx] )  continue;
+
+         nbr = d[yy*nx + xx];
+
+         if ( shape_assigned )  { if ( label != nbr )  uf.merge(label, nbr); }
+         else                   label = nbr;
+
+         shape_assigned = true;
+
+      }
+
+      if ( !shape_assigned )  label = uf.add();
+
+      d[y*nx + x] = label;
+
+   }
+
+}
+
+uf.ordered_set_index(index);
+
+out.assign(nx*ny, 0);
+
+for (j=0; j<nx*ny; ++j)  {
+
+   if ( d[j] )  out[j] = index[d[j]] + 1;
+
+}
+
+n_shapes = uf.n_sets();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class ModePartition
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int ModePartition::which_cell(int k) const
+
+{
+
+int j, i;
+
+for (j=0; j<(int) c.size(); ++j)  {
+
+   for (i=0; i<(int) c[j].size(); ++i)  {
+
+      if ( c[j][i] == k )  return ( j );
+
+   }
+
+}
+
+return ( -1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void ModePartition::add(int k)
+
+{
+
+if ( which_cell(k) >= 0 )  return;
+
+c.push_back(vector<int>(1, k));
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  values not in any set, such as the unlabeled last row and column,
+   //  are ignored
+   //
+
+void ModePartition::merge_values(int v1, int v2)
+
+{
+
+if ( v1 == v2 )  return;
+
+int j_1 = which_cell(v1);
+int j_2 = which_cell(v2);
+
+if ( (j_1 < 0) || (j_2 < 0) || (j_1 == j_2) )  return;
+
+int j_min = min(j_1, j_2);
+int j_max = max(j_1, j_2);
+
+c[j_min].insert(c[j_min].end(), c[j_max].begin(), c[j_max].end());
+
+c[j_max] = c.back();
+
+c.pop_back();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
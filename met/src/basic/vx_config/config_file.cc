@@ -18,6 +18,7 @@ using namespace std;
 #include <stdlib.h>
 #include <cstdio>
 #include <cmath>
+#include <mutex>
 
 #include "indent.h"
 #include "vx_log.h"
@@ -58,6 +59,17 @@ extern void start_string_scan  (const char *);
 extern void finish_string_scan ();
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  the parser keeps its state in globals, so only one thread at a
+   //  time may read a config file or string
+   //
+
+static recursive_mutex parse_mutex;
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -301,6 +313,8 @@ bool MetConfig::read(const char * name)
 
 {
 
+lock_guard<recursive_mutex> lock(parse_mutex);
+
 if ( empty(name) )  {
 
    mlog << Error << "\nMetConfig::read(const char *) -> "
@@ -405,6 +419,8 @@ bool MetConfig::read_string(const char * s)
 
 {
 
+lock_guard<recursive_mutex> lock(parse_mutex);
+
 if ( empty(s) )  {
 
    mlog << Error << "\nMetConfig::read_string(const char *) -> "
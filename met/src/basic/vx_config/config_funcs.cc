@@ -29,7 +29,13 @@ using namespace std;
 ////////////////////////////////////////////////////////////////////////
 
 
-extern Calculator hp;
+   //
+   //  User functions are evaluated on a separate stack for each
+   //  thread so that they may be called concurrently, for example
+   //  when converting observation values.
+   //
+
+static thread_local Calculator func_calc;
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -194,9 +200,9 @@ Number n;
 n.d = x;
 n.is_int = false;
 
-hp.run( V, &n);
+func_calc.run( V, &n);
 
-n = hp.pop();
+n = func_calc.pop();
 
 return ( as_double(n) );
 
@@ -359,9 +365,9 @@ Number UserFunc_MultiArg::operator()(const Number * n) const
 
 {
 
-hp.run( V, n);
+func_calc.run( V, n);
 
-return ( hp.pop() );
+return ( func_calc.pop() );
 
 }
 
@@ -16,6 +16,7 @@ using namespace std;
 #include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <mutex>
 
 #include "temp_file.h"
 #include "file_exists.h"
@@ -23,22 +24,33 @@ using namespace std;
 
 ////////////////////////////////////////////////////////////////////////
 
+//
+// Each call within a process uses a new index so that threads asking
+// for names at the same time never receive the same one
+//
+
+static mutex temp_name_mutex;
+static int   temp_name_index = 0;
+
+////////////////////////////////////////////////////////////////////////
+
 ConcatString make_temp_file_name(const char *prefix, const char *suffix) {
-   int i, pid;
+   int i, pid, n_tries;
    ConcatString s;
    const int max_tries = 1000;
+   lock_guard<mutex> lock(temp_name_mutex);
 
    //
    // Retrieve the current process id
    //
    pid = (int) getpid();
 
-   i = -1;
+   n_tries = 0;
 
    do {
-      i++;
+      i = temp_name_index++;
 
-      if(i > max_tries) {
+      if(++n_tries > max_tries) {
          mlog << Error << "\nmake_temp_file_name() -> "
               << "failed to make temporary file name:\n"
               << s << "\n\n";
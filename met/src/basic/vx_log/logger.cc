@@ -14,6 +14,7 @@ using namespace std;
 
 
 #include <cstdio>
+#include <mutex>
 
 #include "logger.h"
 
@@ -43,12 +44,28 @@ static const bool DefaultExitOnWarning =  false;
    //  these need external linkage, do not make static or extern
    //
 
-MsgLevel Global_Level;
+thread_local MsgLevel Global_Level;
 
 LoggerError Error;
 LoggerWarning Warning;
 
 
+//////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The level of the message being written is kept per thread and
+   //  each piece of a message is written while holding log_mutex, so
+   //  the logger may be used from worker threads.  Messages written
+   //  at the same time by different threads may still be interleaved.
+   //
+
+thread_local bool     Logger::need_to_output_type = false;
+thread_local MsgLevel Logger::message_level;
+
+static recursive_mutex log_mutex;
+
+
 //////////////////////////////////////////////////////////////////
 
 
@@ -563,6 +580,8 @@ void Logger::open_log_file(const ConcatString s)
 
 Logger & Logger::operator<<(const string s)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
    ConcatString msg;
    StringArray messages;
    int i, len, msg_len;
@@ -730,6 +749,8 @@ Logger & Logger::operator<<(const string s)
 
 Logger & Logger::operator<<(const char * s)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
    ConcatString msg;
    StringArray messages;
    char tmp[2];
@@ -892,6 +913,8 @@ Logger & Logger::operator<<(const char * s)
 
 Logger & Logger::operator<<(const int n)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -958,6 +981,8 @@ Logger & Logger::operator<<(const int n)
 
 Logger & Logger::operator<<(const unsigned int n)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1024,6 +1049,8 @@ Logger & Logger::operator<<(const unsigned int n)
 
 Logger & Logger::operator<<(const long l)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1089,6 +1116,8 @@ Logger & Logger::operator<<(const long l)
 
 Logger & Logger::operator<<(const unsigned long l)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1155,6 +1184,8 @@ Logger & Logger::operator<<(const unsigned long l)
 
 Logger & Logger::operator<<(const long long l)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1221,6 +1252,8 @@ Logger & Logger::operator<<(const long long l)
 
 Logger & Logger::operator<<(const unsigned long long l)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1287,6 +1320,8 @@ Logger & Logger::operator<<(const unsigned long long l)
 
 Logger & Logger::operator<<(const double d)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1353,6 +1388,8 @@ Logger & Logger::operator<<(const double d)
 
 Logger & Logger::operator<<(const char c)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1419,6 +1456,8 @@ Logger & Logger::operator<<(const char c)
 
 Logger & Logger::operator<<(const bool b)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // if the message level is -1, then this is an ERROR type message,
       // so write it to cerr
@@ -1485,6 +1524,8 @@ Logger & Logger::operator<<(const bool b)
 
 Logger & Logger::operator<<(const Indent & i)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
    int j, jmax;
    ConcatString tmp_str;
 
@@ -1575,6 +1616,8 @@ Logger & Logger::operator<<(const Indent & i)
 
 Logger & Logger::operator<<(const MsgLevel & m)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
       //
       // set this logger's message_level value from m
       //
@@ -1594,6 +1637,8 @@ Logger & Logger::operator<<(const MsgLevel & m)
 
 Logger & Logger::operator<<(const LoggerError e)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
    (*this) << level(ErrorMessageLevel);
 
    return (*this);
@@ -1606,6 +1651,8 @@ Logger & Logger::operator<<(const LoggerError e)
 
 Logger & Logger::operator<<(const LoggerWarning w)
 {  
+   lock_guard<recursive_mutex> lock(log_mutex);
+
    (*this) << level(WarningMessageLevel);
    
    if (Warning.ExitOnWarning) Warning.NeedToExit = true;
@@ -1620,6 +1667,8 @@ Logger & Logger::operator<<(const LoggerWarning w)
 
 Logger & Logger::operator<<(const LoggerDebug d)
 {
+   lock_guard<recursive_mutex> lock(log_mutex);
+
    (*this) << level(d.value());
 
    return (*this);
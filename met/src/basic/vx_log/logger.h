@@ -87,7 +87,7 @@ inline MsgLevel::operator const int & () const { return (Value); }
 //////////////////////////////////////////////////////////////////
 
 
-extern MsgLevel Global_Level;
+extern thread_local MsgLevel Global_Level;
 
 
 //////////////////////////////////////////////////////////////////
@@ -197,9 +197,9 @@ class Logger
 
    protected:
 
-      bool need_to_output_type;
+      static thread_local bool need_to_output_type;
 
-      MsgLevel message_level;
+      static thread_local MsgLevel message_level;
 
          //
          // VerbosityLevel must be 0 or greater.
@@ -20,6 +20,7 @@ using namespace std;
 #include <stdlib.h>
 #include <string.h>
 #include <cmath>
+#include <ctype.h>
 
 #include "string_array.h"
 #include "logger.h"
@@ -37,6 +38,8 @@ static const int stringarray_alloc_inc = 50;
 
 static int lex_comp (const void *, const void *);
 
+static std::string fold_case (const std::string &);
+
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -132,6 +135,10 @@ void StringArray::init_from_scratch()
 
 IgnoreCase = 0;
 
+Hashed = false;
+
+IndexValid = false;
+
 clear();
 
 
@@ -151,6 +158,8 @@ void StringArray::clear()
 
 s.clear();
 
+clear_index();
+
 return;
 
 }
@@ -169,6 +178,8 @@ s = a.s;
 
 IgnoreCase = a.IgnoreCase;
 
+Hashed = a.Hashed;
+
 return;
 
 }
@@ -185,6 +196,7 @@ Indent prefix(depth);
 Indent prefix2(depth + 1);
 
 out << prefix << "IgnoreCase = " << IgnoreCase << "\n";
+out << prefix << "Hashed     = " << Hashed     << "\n";
 
 int j;
 
@@ -238,6 +250,24 @@ void StringArray::set_ignore_case(const bool b)
 
 IgnoreCase = b;
 
+clear_index();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void StringArray::set_hashed(const bool b)
+
+{
+
+Hashed = b;
+
+if ( !Hashed )  clear_index();
+
 return;
 
 }
@@ -252,6 +282,8 @@ void StringArray::add(const std::string text)
 
 s.push_back(text);
 
+clear_index();
+
 return;
 
 }
@@ -267,7 +299,9 @@ void StringArray::add(const StringArray & a)
 if ( a.n() == 0 )  return;
 
 s.insert(s.end(), a.s.begin(), a.s.end());
- 
+
+clear_index();
+
 return;
 
 }
@@ -322,6 +356,8 @@ void StringArray::set(int i, const std::string text)
 
 s[i] = text;
 
+clear_index();
+
 return;
 
 }
@@ -344,6 +380,8 @@ void StringArray::insert(int i, const char * text)
 
   s.insert(s.begin()+i, text);
 
+  clear_index();
+
   return;
 
 }
@@ -352,13 +390,13 @@ void StringArray::insert(int i, const char * text)
 ////////////////////////////////////////////////////////////////////////
 
 
-bool StringArray::has(const std::string text) const
+bool StringArray::has(const std::string & text) const
 
 {
 
-  int index;
+int index;
 
-  return ( has(text, index) );
+return ( has(text, index) );
 
 }
 
@@ -366,43 +404,129 @@ bool StringArray::has(const std::string text) const
 ////////////////////////////////////////////////////////////////////////
 
 
-bool StringArray::has(const std::string text, int & index) const
+bool StringArray::has(const std::string & text, int & index) const
 
 {
 
-  index = -1;
+index = -1;
 
-  std::string str = text;
+   //
+   //  hash lookup
+   //
+
+if ( Hashed )  {
+
+   if ( !IndexValid.load(std::memory_order_acquire) )  build_index();
+
+   std::unordered_map<std::string, int>::const_iterator it;
+
+   it = Index.find(IgnoreCase ? fold_case(text) : text);
+
+   if ( it == Index.end() )  return ( false );
+
+   index = it->second;
+
+   return ( true );
+
+}
+
+   //
+   //  linear search
+   //
+
+int j;
+
+if ( IgnoreCase )  {
+
+   const std::string lower_text = fold_case(text);
+   std::string::size_type k;
+
+   for (j=0; j<n(); ++j)  {
+
+      if ( s[j].length() != lower_text.length() )  continue;
+
+      for (k=0; k<lower_text.length(); ++k)  {
+
+         if ( tolower((unsigned char) s[j][k]) != lower_text[k] )  break;
 
-  std::vector<std::string>::const_iterator it;
-  int count = 0;
-
-  for(it = s.begin(); it != s.end(); it++, count++) {
-    if ( IgnoreCase ) {
-      std::string lower_s = *it;
-      transform(lower_s.begin(), lower_s.end(), lower_s.begin(), ::tolower);
-      std::string lower_text = text;
-      transform(lower_text.begin(), lower_text.end(), lower_text.begin(), ::tolower);
-      if ( lower_s == lower_text) {
-	//      if ( strcasecmp((*it).c_str(), text.c_str()) ) {
-        index = count;
-	break;
-      }
-    }
-    else {
-      if ( *it == text ) {
-        index = count;
-	break;
       }
-    }
-  }
 
-  if (it != s.end()) {
-    return true;
-  }
-  return false;
+      if ( k == lower_text.length() )  { index = j;  return ( true ); }
+
+   }
 
 }
+else {
+
+   for (j=0; j<n(); ++j)  {
+
+      if ( s[j] == text )  { index = j;  return ( true ); }
+
+   }
+
+}
+
+return ( false );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Build the hash index from the current strings.  Concurrent
+   //  callers of has() on a const object wait here for a single build.
+   //
+
+void StringArray::build_index() const
+
+{
+
+std::lock_guard<std::mutex> lock(IndexMutex);
+
+if ( IndexValid.load(std::memory_order_relaxed) )  return;
+
+int j;
+
+Index.clear();
+
+Index.reserve(s.size());
+
+   //
+   //  keep the first occurrence to match the linear search
+   //
+
+for (j=0; j<n(); ++j)  {
+
+   Index.insert(std::make_pair(IgnoreCase ? fold_case(s[j]) : s[j], j));
+
+}
+
+IndexValid.store(true, std::memory_order_release);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void StringArray::clear_index()
+
+{
+
+if ( !IndexValid.load(std::memory_order_relaxed) && Index.empty() )  return;
+
+IndexValid = false;
+
+Index.clear();
+
+return;
+
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -454,6 +578,8 @@ void StringArray::parse_delim(const std::string text, const char *delim)
   if (start < str.length())
       s.push_back(str.substr(start).c_str());
 
+  clear_index();
+
   return;
 
 }
@@ -484,6 +610,8 @@ if ( (shift <= 0) || ((pos + shift) > n()) )  {
 
  s.erase(s.begin() + pos, s.begin() + pos + shift);
 
+ clear_index();
+
  return;
 
 }
@@ -574,7 +702,9 @@ void StringArray::sort()
 if ( n() <= 1 )  return;
 
  std::sort(s.begin(), s.end());
- 
+
+ clear_index();
+
 return;
 
 }
@@ -645,6 +775,23 @@ return( valid );
 ////////////////////////////////////////////////////////////////////////
 
 
+std::string fold_case(const std::string & text)
+
+{
+
+std::string lower = text;
+std::string::size_type j;
+
+for (j=0; j<lower.length(); ++j)  lower[j] = tolower((unsigned char) lower[j]);
+
+return ( lower );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 int lex_comp(const void * a, const void * b)
 
 {
@@ -20,8 +20,12 @@
 
 #include <iostream>
 #include <ostream>
+#include <string>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +47,24 @@ class StringArray {
 
       bool IgnoreCase;
 
+         //
+         //  optional hash index used by has(), keyed on the lower case
+         //  string when IgnoreCase is set.  It's built on the first
+         //  lookup and discarded whenever the strings change.
+         //
+
+      bool Hashed;
+
+      mutable std::unordered_map<std::string, int> Index;
+
+      mutable std::atomic<bool> IndexValid;
+
+      mutable std::mutex IndexMutex;
+
+      void build_index() const;
+
+      void clear_index();
+
 
    public:
 
@@ -60,6 +82,8 @@ class StringArray {
 
       void set_ignore_case(const bool);
 
+      void set_hashed(const bool);
+
       void add(const std::string text);
       
       void add(const StringArray &);
@@ -77,9 +101,9 @@ class StringArray {
 
       int length(int) const;
 
-      bool has(const std::string) const;
+      bool has(const std::string &) const;
 
-      bool has(const std::string, int & index) const;
+      bool has(const std::string &, int & index) const;
 
          //
          //  parse delimited strings
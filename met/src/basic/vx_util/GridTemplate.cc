@@ -77,6 +77,8 @@ GridTemplate::GridTemplate(const GridTemplate& rhs)
         offset_iter != rhs._offsetList.end(); ++offset_iter)
       _offsetList.push_back(new GridOffset(*offset_iter));
 
+   _spanList = rhs._spanList;
+
    _pointInGridBase   = rhs._pointInGridBase;
    _pointInGridNumX   = rhs._pointInGridNumX;
    _pointInGridNumY   = rhs._pointInGridNumY;
@@ -498,7 +500,8 @@ void GridTemplate::printOffsetList(FILE *stream)
  **********************************************************************/
 
 /**********************************************************************
- * _addOffset() - Add the given offset to the offset list.
+ * _addOffset() - Add the given offset to the offset list and extend the
+ *                row spans to include it.
  */
 
 void GridTemplate::_addOffset(int x_offset, int y_offset)
@@ -507,6 +510,25 @@ void GridTemplate::_addOffset(int x_offset, int y_offset)
 
   _offsetList.push_back(offset);
 
+  // Extend the current span or start a new one
+
+  if (!_spanList.empty() &&
+      _spanList.back().y_offset     == y_offset &&
+      _spanList.back().x_end_offset == x_offset)
+  {
+    _spanList.back().x_end_offset++;
+  }
+  else
+  {
+    GridSpan span;
+
+    span.y_offset     = y_offset;
+    span.x_beg_offset = x_offset;
+    span.x_end_offset = x_offset + 1;
+
+    _spanList.push_back(span);
+  }
+
   return;
 }
 
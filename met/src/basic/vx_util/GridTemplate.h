@@ -57,6 +57,16 @@
 
 using namespace std;
 
+// A run of consecutive x offsets within one row of a template.
+// x_end_offset is one past the last offset in the row.
+
+struct GridSpan
+{
+  int y_offset;
+  int x_beg_offset;
+  int x_end_offset;
+};
+
 class GridTemplate
 {
  public:
@@ -108,6 +118,44 @@ class GridTemplate
   void       incBaseX(const int &x_inc) const;
   void       incBaseY(const int &y_inc) const;
 
+  // Methods for stepping through the template one row at a time without
+  // any iteration state, so they may be used on the same template from
+  // several threads at once.  The spans are stored in the same order as
+  // the offset list.
+  //
+  // getSpanInGrid() clips span i of the template centered on base_x and
+  // base_y to the grid and returns the grid row, y, and the range of grid
+  // columns, x_beg <= x < x_end.  It returns false when the span lies
+  // entirely outside the grid.
+
+  int getNumSpans(void) const
+  {
+    return _spanList.size();
+  }
+
+  const GridSpan &getSpan(const int i) const
+  {
+    return _spanList[i];
+  }
+
+  inline bool getSpanInGrid(const int i,
+                            const int base_x, const int base_y,
+                            const int nx, const int ny,
+                            int &y, int &x_beg, int &x_end) const
+  {
+    const GridSpan &span = _spanList[i];
+
+    y = base_y + span.y_offset;
+    if (y < 0 || y >= ny) return false;
+
+    x_beg = base_x + span.x_beg_offset;
+    x_end = base_x + span.x_end_offset;
+    if (x_beg < 0)  x_beg = 0;
+    if (x_end > nx) x_end = nx;
+
+    return (x_beg < x_end);
+  }
+
   // Printing methods
 
   void printOffsetList(FILE *stream);
@@ -116,13 +164,12 @@ class GridTemplate
 
   inline void addOffset(const GridOffset &offset)
   {
-    _offsetList.push_back(new GridOffset(offset.x_offset,
-                                         offset.y_offset));
+    _addOffset(offset.x_offset, offset.y_offset);
   }
 
   inline void addOffset(const int x_offset, const int y_offset)
   {
-    _offsetList.push_back(new GridOffset(x_offset, y_offset));
+    _addOffset(x_offset, y_offset);
   }
 
   int size(void) const
@@ -152,6 +199,10 @@ class GridTemplate
   vector< GridOffset* > _offsetTopEdge;    // not allocated
   vector< GridOffset* > _offsetBotEdge; // not allocated
 
+  // The offsets grouped into runs along each row
+
+  vector< GridSpan > _spanList;
+
   // Iterator for finding points within a grid
 
   mutable vector< GridOffset* >::const_iterator _pointInGridIterator;
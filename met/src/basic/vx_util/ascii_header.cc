@@ -371,9 +371,11 @@ void AsciiHeader::init_from_scratch() {
 ////////////////////////////////////////////////////////////////////////
 
 void AsciiHeader::assign(const AsciiHeader &a) {
+   lock_guard<recursive_mutex> lock(HdrMutex);
 
    Versions = a.Versions;
    Headers  = a.Headers;
+   Lookup.clear();
 
    return;
 }
@@ -381,9 +383,11 @@ void AsciiHeader::assign(const AsciiHeader &a) {
 ////////////////////////////////////////////////////////////////////////
 
 void AsciiHeader::clear() {
+   lock_guard<recursive_mutex> lock(HdrMutex);
 
    Versions.clear();
    Headers.clear();
+   Lookup.clear();
 
    return;
 }
@@ -391,6 +395,16 @@ void AsciiHeader::clear() {
 ////////////////////////////////////////////////////////////////////////
 
 void AsciiHeader::read(const char *version) {
+   lock_guard<recursive_mutex> lock(HdrMutex);
+
+   load(version);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void AsciiHeader::load(const char *version) {
    ConcatString file_name;
    DataLine line;
    AsciiHeaderLine header_line;
@@ -455,13 +469,21 @@ const AsciiHeaderLine * AsciiHeader::header(const char *version,
                                             const char *line_type) {
 
    ConcatString version_mm(parse_version_major_minor(version));
+   string key;
+   map<string, const AsciiHeaderLine *>::const_iterator cached;
+   lock_guard<recursive_mutex> lock(HdrMutex);
+
+   // Check for a previous search
+   key = version_mm.string() + ':' + data_type + ':' + line_type;
+   cached = Lookup.find(key);
+   if(cached != Lookup.end()) return(cached->second);
 
    // Check if the version needs to be loaded
-   if(!Versions.has(version_mm)) read(version_mm.c_str());
+   if(!Versions.has(version_mm)) load(version_mm.c_str());
 
    // Find matching header line
    // Allow NA for line_type to match any line type
-   vector<AsciiHeaderLine>::const_iterator it;
+   deque<AsciiHeaderLine>::const_iterator it;
    for(it = Headers.begin(); it != Headers.end(); ++it) {
       if(strcmp(it->version(),    version_mm.c_str()) == 0 &&
          strcmp(it->data_type(),  data_type)          == 0 &&
@@ -478,6 +500,8 @@ const AsciiHeaderLine * AsciiHeader::header(const char *version,
       exit(1);
    }
 
+   Lookup[key] = &(*it);
+
    return(&(*it));
 }
 
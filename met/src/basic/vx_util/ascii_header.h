@@ -15,7 +15,11 @@
 
 using namespace std;
 
+#include <deque>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "concat_string.h"
@@ -105,8 +109,19 @@ class AsciiHeader {
 
       void assign(const AsciiHeader &);
 
-      StringArray             Versions;
-      vector<AsciiHeaderLine> Headers;
+      void load(const char *version);
+
+         //
+         //  Headers is a deque so that pointers to its lines remain
+         //  valid as more versions are loaded.  Lookup caches the
+         //  result of each header search.  HdrMutex serializes access
+         //  so that lines may be parsed from multiple threads.
+         //
+
+      StringArray                          Versions;
+      deque<AsciiHeaderLine>               Headers;
+      map<string, const AsciiHeaderLine *> Lookup;
+      recursive_mutex                      HdrMutex;
 
    public:
 
@@ -373,6 +373,51 @@ return ( 1 );
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Rebuild the line from items that have already been split, for
+   //  example when read back from a cache, rather than parsing text.
+   //
+
+int DataLine::set_items(const char * const * items, int n_items, LineDataFile * ldf, int line_number)
+
+{
+
+clear();
+
+if ( n_items <= 0 )  return ( 0 );
+
+int j;
+
+Items.reserve(n_items);
+Offset.reserve(n_items);
+
+for (j=0; j<n_items; ++j)  {
+
+   if ( j > 0 )  Line += ' ';
+
+   Offset.push_back(Line.size());
+
+   Items.push_back(items[j]);
+
+   Line += Items.back();
+
+}
+
+N_items = n_items;
+
+LineNumber = line_number;
+
+File = ldf;
+
+
+return ( 1 );
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
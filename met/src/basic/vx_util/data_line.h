@@ -126,6 +126,12 @@ class DataLine {
 
       virtual int read_fwf_line(LineDataFile *, const int *wdth, int n_wdth);
 
+         //
+         //  set the items directly from already parsed tokens
+         //
+
+      virtual int set_items(const char * const * items, int n_items, LineDataFile *, int line_number);
+
       virtual bool is_ok() const;
 
       virtual bool is_header() const;
@@ -182,7 +188,7 @@ class LineDataFile {
 
       int open(const char *);
 
-      void close();
+      virtual void close();
 
       void rewind();
 
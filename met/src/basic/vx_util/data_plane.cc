@@ -198,7 +198,7 @@ void DataPlane::set(double v, int x, int y) {
 
    n = two_to_one(x, y);
 
-   Data[n] = v;
+   Data[n] = (dataplane_t) v;
 
    return;
 }
@@ -226,7 +226,7 @@ void DataPlane::set_block(double *v, int nx, int ny) {
    for (int y=0; y < ny; y++) {
       int dp_offset = two_to_one(0, y);
       for (int x=0; x < nx; x++) {
-         Data[dp_offset+x] = v[offset++];
+         Data[dp_offset+x] = (dataplane_t) v[offset++];
       }
    }
 
@@ -245,7 +245,7 @@ void DataPlane::set_constant(double v) {
 
    int j;
 
-   for(j=0; j<Nxy; ++j) Data[j] = v;
+   for(j=0; j<Nxy; ++j) Data[j] = (dataplane_t) v;
 
    return;
 }
@@ -342,7 +342,7 @@ void DataPlane::censor(const ThreshArray &censor_thresh,
 
          // Break out after the first match.
          if(ta[j].check(Data[i])) {
-            Data[i] = censor_val[j];
+            Data[i] = (dataplane_t) censor_val[j];
             count++;
             break;
          }
@@ -367,7 +367,7 @@ int j;
 
 for (j=0; j<Nxy; ++j)  {
 
-   if ( is_bad_data(Data[j]) )  Data[j] = value;
+   if ( is_bad_data(Data[j]) )  Data[j] = (dataplane_t) value;
 
 }
 
@@ -523,7 +523,7 @@ if ( N == 0 )  return;   //  no shift, so do nothing
 
 int x, y, x_new;
 int index_old, index_new;
-std::vector<double> new_data(Nxy);
+std::vector<dataplane_t> new_data(Nxy);
 
 for (x=0; x<Nx; ++x)  {
 
@@ -569,7 +569,7 @@ if ( Data.empty() )  {
 
 const int n = two_to_one(x, y);   //  the two_to_one function does range checking on x and y
 
-Data[n] = value;
+Data[n] = (dataplane_t) value;
 
 return;
 
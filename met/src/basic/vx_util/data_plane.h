@@ -27,6 +27,21 @@
 
 typedef TwoD_Array<bool> MaskPlane;
 
+////////////////////////////////////////////////////////////////////////
+
+   //
+   //  Type used to store the DataPlane values.  Configuring with
+   //  --enable-float_planes stores them in single precision, halving
+   //  the memory used by large ensembles and 3-D volumes.  Values are
+   //  still set, retrieved, and accumulated as doubles.
+   //
+
+#ifdef WITH_FLOAT_PLANES
+typedef float  dataplane_t;
+#else
+typedef double dataplane_t;
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 
 class DataPlane {
@@ -38,7 +53,7 @@ class DataPlane {
       void init_from_scratch();
       void assign(const DataPlane &);
 
-      std::vector<double> Data;
+      std::vector<dataplane_t> Data;
 
       int Nx;
       int Ny;
@@ -92,8 +107,8 @@ class DataPlane {
       double   get(int x, int y) const;
       double   operator () (int x, int y) const;
 
-      const double * data() const;
-      std::vector<double> & buf();
+      const dataplane_t * data() const;
+      std::vector<dataplane_t> & buf();
 
          //
          // Do stuff
@@ -137,8 +152,8 @@ inline int      DataPlane::accum() const { return (AccumTime); }
 
 inline double DataPlane::operator()(int x, int y) const { return(get(x, y)); }
 
-inline const double * DataPlane::data() const { return ( Data.data() ); }
-inline std::vector<double> & DataPlane::buf() { return ( Data ); }
+inline const dataplane_t * DataPlane::data() const { return ( Data.data() ); }
+inline std::vector<dataplane_t> & DataPlane::buf() { return ( Data ); }
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -12,13 +12,16 @@ using namespace std;
 
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <math.h>
+#include <set>
 #include <string.h>
 #include <unistd.h>
 
 #include "data_plane_util.h"
 #include "interp_util.h"
 #include "two_to_one.h"
+#include "thread_util.h"
 
 #include "vx_gsl_prob.h"
 #include "vx_math.h"
@@ -85,6 +88,653 @@ void rescale_probability(DataPlane &dp) {
 
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Running sums used to compute neighborhood counts and means without
+// visiting every template point.  Each row y of the tables holds the
+// sums over x' < x of that row, for x = 0 to nx.  For rectangular
+// templates the rows are then accumulated over y' <= y so that any
+// box is found from four table entries.
+//
+// Valid values which are not finite are left out of the sum and
+// counted separately, since a single one would spoil every later
+// difference of the running sum.  The few neighborhoods containing
+// them are summed directly instead.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct NbrhdSums {
+   int nx, ny;
+
+   // Template bounds when it is a single rectangle
+   bool is_rect;
+   int rect_x_beg, rect_x_end, rect_y_beg, rect_y_end;
+
+   const DataPlane    *dp;
+   const SingleThresh *st;
+
+   vector<int>    vld;   // count of valid data
+   vector<int>    thr;   // count meeting the threshold
+   vector<double> sum;   // sum of the valid finite data
+   vector<int>    nfin;  // count of valid data that is not finite
+};
+
+////////////////////////////////////////////////////////////////////////
+
+static void nbrhd_row_sums_task(void *data, int, int i_beg, int i_end) {
+   NbrhdSums *s = (NbrhdSums *) data;
+   int x, y, n;
+   double v;
+
+   for(y=i_beg; y<i_end; y++) {
+
+      const dataplane_t *row = s->dp->data() + y*s->nx;
+      n = y*(s->nx + 1);
+
+      s->vld[n] = 0;
+      if(!s->thr.empty()) s->thr[n] = 0;
+      if(!s->sum.empty()) s->sum[n] = 0.0;
+      if(!s->sum.empty()) s->nfin[n] = 0;
+
+      for(x=0; x<s->nx; x++, n++) {
+         v = row[x];
+         bool ok = !is_bad_data(v);
+         bool fin = ok && isfinite(v);
+         s->vld[n+1] = s->vld[n] + ok;
+         if(!s->thr.empty()) s->thr[n+1] = s->thr[n] + (ok && s->st->check(v));
+         if(!s->sum.empty()) {
+            s->sum[n+1]  = s->sum[n] + (fin ? v : 0.0);
+            s->nfin[n+1] = s->nfin[n] + (ok && !fin);
+         }
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void nbrhd_col_sums_task(void *data, int, int i_beg, int i_end) {
+   NbrhdSums *s = (NbrhdSums *) data;
+   int x, y, n, m;
+
+   for(y=1; y<s->ny; y++) {
+      n = y*(s->nx + 1);
+      m = n - (s->nx + 1);
+      for(x=i_beg; x<i_end; x++) {
+         s->vld[n+x] += s->vld[m+x];
+         if(!s->thr.empty()) s->thr[n+x] += s->thr[m+x];
+         if(!s->sum.empty()) s->sum[n+x] += s->sum[m+x];
+         if(!s->sum.empty()) s->nfin[n+x] += s->nfin[m+x];
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void build_nbrhd_sums(NbrhdSums &s, const DataPlane &dp,
+                             const GridTemplate &gt,
+                             const SingleThresh *st, bool do_sum) {
+   int i, n_threads = get_num_threads();
+
+   s.nx = dp.nx();
+   s.ny = dp.ny();
+   s.dp = &dp;
+   s.st = st;
+
+   // Check for a template which is a single rectangle
+   s.is_rect = (gt.getNumSpans() > 0);
+   for(i=0; i<gt.getNumSpans(); i++) {
+      const GridSpan &span = gt.getSpan(i);
+      if(i == 0) {
+         s.rect_x_beg = span.x_beg_offset;
+         s.rect_x_end = span.x_end_offset;
+         s.rect_y_beg = span.y_offset;
+      }
+      else if(span.x_beg_offset != s.rect_x_beg ||
+              span.x_end_offset != s.rect_x_end ||
+              span.y_offset     != s.rect_y_end) {
+         s.is_rect = false;
+         break;
+      }
+      s.rect_y_end = span.y_offset + 1;
+   }
+
+   s.vld.resize((s.nx + 1)*s.ny);
+   if(st)     s.thr.resize((s.nx + 1)*s.ny);
+   if(do_sum) s.sum.resize((s.nx + 1)*s.ny);
+   if(do_sum) s.nfin.resize((s.nx + 1)*s.ny);
+
+   run_thread_tasks(nbrhd_row_sums_task, &s, s.ny, n_threads);
+
+   if(s.is_rect) {
+      run_thread_tasks(nbrhd_col_sums_task, &s, s.nx + 1, n_threads);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void get_nbrhd_sums(const NbrhdSums &s, const GridTemplate &gt,
+                           int x, int y,
+                           int &n_vld, int &n_thr, double &sum) {
+   int i, gx, gy, gx_beg, gx_end, n0, n1, n_nfin;
+
+   n_vld = n_thr = n_nfin = 0;
+   sum = 0.0;
+
+   // Four corners of the clipped rectangle
+   if(s.is_rect) {
+      int x0 = max(x + s.rect_x_beg, 0);
+      int x1 = min(x + s.rect_x_end, s.nx);
+      int y0 = max(y + s.rect_y_beg, 0);
+      int y1 = min(y + s.rect_y_end, s.ny);
+
+      if(x0 >= x1 || y0 >= y1) return;
+
+      n1 = (y1 - 1)*(s.nx + 1);
+      n_vld = s.vld[n1+x1] - s.vld[n1+x0];
+      if(!s.thr.empty()) n_thr  = s.thr[n1+x1]  - s.thr[n1+x0];
+      if(!s.sum.empty()) sum    = s.sum[n1+x1]  - s.sum[n1+x0];
+      if(!s.sum.empty()) n_nfin = s.nfin[n1+x1] - s.nfin[n1+x0];
+
+      if(y0 > 0) {
+         n0 = (y0 - 1)*(s.nx + 1);
+         n_vld -= s.vld[n0+x1] - s.vld[n0+x0];
+         if(!s.thr.empty()) n_thr  -= s.thr[n0+x1]  - s.thr[n0+x0];
+         if(!s.sum.empty()) sum    -= s.sum[n0+x1]  - s.sum[n0+x0];
+         if(!s.sum.empty()) n_nfin -= s.nfin[n0+x1] - s.nfin[n0+x0];
+      }
+   }
+
+   // Otherwise, add up each template row
+   else {
+      for(i=0; i<gt.getNumSpans(); i++) {
+         if(!gt.getSpanInGrid(i, x, y, s.nx, s.ny,
+                              gy, gx_beg, gx_end)) continue;
+
+         n0 = gy*(s.nx + 1);
+         n_vld += s.vld[n0+gx_end] - s.vld[n0+gx_beg];
+         if(!s.thr.empty()) n_thr  += s.thr[n0+gx_end]  - s.thr[n0+gx_beg];
+         if(!s.sum.empty()) sum    += s.sum[n0+gx_end]  - s.sum[n0+gx_beg];
+         if(!s.sum.empty()) n_nfin += s.nfin[n0+gx_end] - s.nfin[n0+gx_beg];
+      }
+   }
+
+   // Drop the rounding left in the differences when there is no data
+   if(n_vld == 0) sum = 0.0;
+
+   // Sum the data directly when it includes non-finite values
+   else if(n_nfin > 0) {
+      sum = 0.0;
+      for(i=0; i<gt.getNumSpans(); i++) {
+         if(!gt.getSpanInGrid(i, x, y, s.nx, s.ny,
+                              gy, gx_beg, gx_end)) continue;
+
+         const dataplane_t *row = s.dp->data() + gy*s.nx;
+         for(gx=gx_beg; gx<gx_end; gx++) {
+            if(!is_bad_data(row[gx])) sum += row[gx];
+         }
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Task data for computing the mean or fractional coverage field
+// one row at a time.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct SmoothFieldTaskInfo {
+   const DataPlane    *dp;
+   DataPlane          *out_dp;
+   const GridTemplate *gt;
+   const NbrhdSums    *sums;
+   InterpMthd          mthd;
+   double              t;
+};
+
+////////////////////////////////////////////////////////////////////////
+
+static void smooth_field_task(void *data, int, int i_beg, int i_end) {
+   SmoothFieldTaskInfo *info = (SmoothFieldTaskInfo *) data;
+   const DataPlane &dp = *info->dp;
+   const GridTemplate &gt = *info->gt;
+   const int num_points = gt.size();
+   int x, y, n_vld, n_thr;
+   double v = 0.0, sum;
+
+   for(y=i_beg; y<i_end; y++) {
+      for(x=0; x<dp.nx(); x++) {
+
+         // Compute the smoothed value based on the interpolation method
+         switch(info->mthd) {
+
+            case(InterpMthd_UW_Mean):  // Unweighted Mean
+               get_nbrhd_sums(*info->sums, gt, x, y, n_vld, n_thr, sum);
+               if((num_points == 0) ||
+                  ((static_cast<double>(n_vld) / num_points) < info->t)) {
+                  v = bad_data_double;
+               }
+               else {
+                  v = sum / n_vld;
+               }
+               break;
+
+            // Nbrhd computes the fractional coverage
+            case(InterpMthd_Nbrhd):
+               get_nbrhd_sums(*info->sums, gt, x, y, n_vld, n_thr, sum);
+               if((double)(n_vld)/num_points >= info->t && n_vld != 0) {
+                  v = (double) n_thr/n_vld;
+               }
+               else {
+                  v = bad_data_double;
+               }
+               break;
+
+            default:
+               v = bad_data_double;
+               break;
+         }
+
+         // Store the smoothed value
+         info->out_dp->set(v, x, y);
+
+      } // end for x
+   } // end for y
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Minimum over the columns [x + x_beg, x + x_end) of one row for each
+// x, skipping bad data, using a monotonic deque of column indices.
+// The values are multiplied by sign so that the same code computes the
+// maximum.  Windows with no valid data are set to infinity.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void row_window_min(const dataplane_t *row, int nx, double sign,
+                           int x_beg, int x_end,
+                           int *dq_x, double *dq_v, double *out) {
+   int x, head, tail, next;
+   double v;
+   const double inf = numeric_limits<double>::infinity();
+
+   head = tail = 0;
+   next = max(x_beg, 0);
+
+   for(x=0; x<nx; x++) {
+
+      // Push the columns entering the window
+      for(; next < min(x + x_end, nx); next++) {
+         if(is_bad_data(row[next])) continue;
+         v = sign*row[next];
+         while(tail > head && dq_v[tail-1] >= v) tail--;
+         dq_x[tail] = next;
+         dq_v[tail] = v;
+         tail++;
+      }
+
+      // Pop the columns leaving the window
+      while(tail > head && dq_x[head] < x + x_beg) head++;
+
+      out[x] = (tail > head ? dq_v[head] : inf);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Task data for the sliding window minimum, maximum, and median
+// smoothers.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct SmoothWindowTaskInfo {
+   const DataPlane    *dp;
+   DataPlane          *out_dp;
+   const GridTemplate *gt;
+   const NbrhdSums    *sums;
+   double              sign;
+   double              t;
+   int                 n_win;   // rectangle height
+   vector<double>      row_min; // [y][x] minimum along each row
+   vector<double>      fwd_min; // [p][x] minimum from the start of each block
+   vector<double>      bwd_min; // [p][x] minimum to the end of each block
+};
+
+////////////////////////////////////////////////////////////////////////
+
+static void store_window_min(SmoothWindowTaskInfo *info,
+                             int x, int y, double v) {
+   int n_vld, n_thr;
+   double sum;
+   const int num_points = info->gt->size();
+
+   get_nbrhd_sums(*info->sums, *info->gt, x, y, n_vld, n_thr, sum);
+
+   // Check whether enough valid grid points were found to trust
+   // the value computed
+   if(num_points == 0 || n_vld == 0 ||
+      (static_cast<double>(n_vld) / num_points) < info->t) {
+      v = bad_data_double;
+   }
+   else {
+      v *= info->sign;
+   }
+
+   info->out_dp->set(v, x, y);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Rectangular templates:  minimum along each row
+//
+////////////////////////////////////////////////////////////////////////
+
+static void rect_row_min_task(void *data, int, int i_beg, int i_end) {
+   SmoothWindowTaskInfo *info = (SmoothWindowTaskInfo *) data;
+   const DataPlane &dp = *info->dp;
+   const NbrhdSums &s = *info->sums;
+   vector<int> dq_x(dp.nx());
+   vector<double> dq_v(dp.nx());
+   int y;
+
+   for(y=i_beg; y<i_end; y++) {
+      row_window_min(dp.data() + y*dp.nx(), dp.nx(), info->sign,
+                     s.rect_x_beg, s.rect_x_end,
+                     dq_x.data(), dq_v.data(),
+                     &info->row_min[y*dp.nx()]);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Rectangular templates:  minimum of the row minimums over each column
+// window, using the van Herk/Gil-Werman block algorithm.  The rows are
+// padded with infinity to rect_y_beg rows below and rect_y_end - 1
+// rows above the grid and split into blocks of n_win rows.  Each
+// window is covered by the end of one block and the start of the next.
+// The task range is a range of columns.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void rect_col_min_task(void *data, int, int i_beg, int i_end) {
+   SmoothWindowTaskInfo *info = (SmoothWindowTaskInfo *) data;
+   const int nx = info->dp->nx();
+   const int ny = info->dp->ny();
+   const int w  = info->n_win;
+   const int np = ny + w - 1;
+   const int y_beg = info->sums->rect_y_beg;
+   const double inf = numeric_limits<double>::infinity();
+   const double *r;
+   double *f, *b;
+   int p, x, y, gy;
+
+   // Forward pass within each block
+   for(p=0; p<np; p++) {
+      gy = p + y_beg;
+      f = &info->fwd_min[p*nx];
+      r = (gy >= 0 && gy < ny ? &info->row_min[gy*nx] : (double *) 0);
+      for(x=i_beg; x<i_end; x++) {
+         f[x] = (r ? r[x] : inf);
+         if(p % w != 0) f[x] = min(f[x], f[x-nx]);
+      }
+   }
+
+   // Backward pass within each block
+   for(p=np-1; p>=0; p--) {
+      gy = p + y_beg;
+      b = &info->bwd_min[p*nx];
+      r = (gy >= 0 && gy < ny ? &info->row_min[gy*nx] : (double *) 0);
+      for(x=i_beg; x<i_end; x++) {
+         b[x] = (r ? r[x] : inf);
+         if(p % w != w - 1 && p != np - 1) b[x] = min(b[x], b[x+nx]);
+      }
+   }
+
+   // Window [y, y + w) in padded rows
+   for(y=0; y<ny; y++) {
+      f = &info->fwd_min[(y + w - 1)*nx];
+      b = &info->bwd_min[y*nx];
+      for(x=i_beg; x<i_end; x++) {
+         store_window_min(info, x, y, min(b[x], f[x]));
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Other templates:  minimum of the sliding row minimums over the
+// template rows, one output row at a time.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void span_min_task(void *data, int, int i_beg, int i_end) {
+   SmoothWindowTaskInfo *info = (SmoothWindowTaskInfo *) data;
+   const DataPlane &dp = *info->dp;
+   const GridTemplate &gt = *info->gt;
+   const int nx = dp.nx();
+   const double inf = numeric_limits<double>::infinity();
+   vector<int> dq_x(nx);
+   vector<double> dq_v(nx), row(nx), acc(nx);
+   int i, x, y, gy;
+
+   for(y=i_beg; y<i_end; y++) {
+
+      for(x=0; x<nx; x++) acc[x] = inf;
+
+      for(i=0; i<gt.getNumSpans(); i++) {
+         const GridSpan &span = gt.getSpan(i);
+         gy = y + span.y_offset;
+         if(gy < 0 || gy >= dp.ny()) continue;
+
+         row_window_min(dp.data() + gy*nx, nx, info->sign,
+                        span.x_beg_offset, span.x_end_offset,
+                        dq_x.data(), dq_v.data(), row.data());
+
+         for(x=0; x<nx; x++) acc[x] = min(acc[x], row[x]);
+      }
+
+      for(x=0; x<nx; x++) store_window_min(info, x, y, acc[x]);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Compute the neighborhood minimum, for sign = 1, or maximum, for
+// sign = -1, of each grid point.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void smooth_window_min(const DataPlane &dp, DataPlane &out_dp,
+                              const GridTemplate &gt,
+                              const NbrhdSums &sums,
+                              double sign, double t) {
+   SmoothWindowTaskInfo info;
+   int n_threads = get_num_threads();
+
+   info.dp     = &dp;
+   info.out_dp = &out_dp;
+   info.gt     = &gt;
+   info.sums   = &sums;
+   info.sign   = sign;
+   info.t      = t;
+   info.n_win  = 0;
+
+   if(sums.is_rect) {
+      info.n_win = sums.rect_y_end - sums.rect_y_beg;
+      info.row_min.resize(dp.nx()*dp.ny());
+      info.fwd_min.resize(dp.nx()*(dp.ny() + info.n_win - 1));
+      info.bwd_min.resize(dp.nx()*(dp.ny() + info.n_win - 1));
+      run_thread_tasks(rect_row_min_task, &info, dp.ny(), n_threads);
+      run_thread_tasks(rect_col_min_task, &info, dp.nx(), n_threads);
+   }
+   else {
+      run_thread_tasks(span_min_task, &info, dp.ny(), n_threads);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Running median of a sliding window.  The lower half of the values,
+// including the middle one, is kept in lo and the rest in hi.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct RunningMedian {
+   multiset<double> lo, hi;
+
+   void clear() { lo.clear(); hi.clear(); }
+
+   int n() const { return(lo.size() + hi.size()); }
+
+   void balance() {
+      int n_lo = (n() + 1)/2;
+      while((int) lo.size() > n_lo) {
+         hi.insert(*lo.rbegin());
+         lo.erase(prev(lo.end()));
+      }
+      while((int) lo.size() < n_lo) {
+         lo.insert(*hi.begin());
+         hi.erase(hi.begin());
+      }
+   }
+
+   void add(double v) {
+      if(lo.empty() || v <= *lo.rbegin()) lo.insert(v);
+      else                                hi.insert(v);
+      balance();
+   }
+
+   void remove(double v) {
+      if(!lo.empty() && v <= *lo.rbegin()) lo.erase(lo.find(v));
+      else                                 hi.erase(hi.find(v));
+      balance();
+   }
+
+   // Same result as percentile() of the sorted values at 0.5, except
+   // that an odd count returns the middle value itself rather than
+   // weighting its neighbor by zero, which is NaN when it is infinite
+   double median() const {
+      int index;
+      double delta, v_lo, v_hi;
+      if(n() == 0) return(bad_data_double);
+      index = nint(floor((n() - 1)*0.50));
+      delta = (n() - 1)*0.50 - index;
+      v_lo  = *lo.rbegin();
+      if(delta == 0.0) return(v_lo);
+      v_hi  = *hi.begin();
+      return((1 - delta)*v_lo + delta*v_hi);
+   }
+};
+
+////////////////////////////////////////////////////////////////////////
+//
+// Median of each grid point, one output row at a time.  Moving one
+// column to the right removes the first column of each template row
+// and adds the column after its last.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void smooth_median_task(void *data, int, int i_beg, int i_end) {
+   SmoothWindowTaskInfo *info = (SmoothWindowTaskInfo *) data;
+   const DataPlane &dp = *info->dp;
+   const GridTemplate &gt = *info->gt;
+   const int nx = dp.nx();
+   const int num_points = gt.size();
+   RunningMedian rm;
+   int i, x, y, gx, gy, gx_beg, gx_end;
+   double v;
+
+   for(y=i_beg; y<i_end; y++) {
+
+      rm.clear();
+
+      for(x=0; x<nx; x++) {
+
+         // Fill the window for the first column
+         if(x == 0) {
+            for(i=0; i<gt.getNumSpans(); i++) {
+               if(!gt.getSpanInGrid(i, x, y, nx, dp.ny(),
+                                    gy, gx_beg, gx_end)) continue;
+               const dataplane_t *row = dp.data() + gy*nx;
+               for(gx=gx_beg; gx<gx_end; gx++) {
+                  if(!is_bad_data(row[gx])) rm.add(row[gx]);
+               }
+            }
+         }
+         // Otherwise, slide each template row one column
+         else {
+            for(i=0; i<gt.getNumSpans(); i++) {
+               const GridSpan &span = gt.getSpan(i);
+               gy = y + span.y_offset;
+               if(gy < 0 || gy >= dp.ny()) continue;
+               const dataplane_t *row = dp.data() + gy*nx;
+
+               gx = x - 1 + span.x_beg_offset;
+               if(gx >= 0 && gx < nx && !is_bad_data(row[gx])) rm.remove(row[gx]);
+
+               gx = x - 1 + span.x_end_offset;
+               if(gx >= 0 && gx < nx && !is_bad_data(row[gx])) rm.add(row[gx]);
+            }
+         }
+
+         // Check whether enough valid grid points were found to trust
+         // the value computed
+         if((num_points == 0) ||
+            ((static_cast<double>(rm.n()) / num_points) < info->t)) {
+            v = bad_data_double;
+         }
+         else {
+            v = rm.median();
+         }
+
+         info->out_dp->set(v, x, y);
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void smooth_median(const DataPlane &dp, DataPlane &out_dp,
+                          const GridTemplate &gt, double t) {
+   SmoothWindowTaskInfo info;
+
+   info.dp     = &dp;
+   info.out_dp = &out_dp;
+   info.gt     = &gt;
+   info.sums   = (const NbrhdSums *) 0;
+   info.sign   = 1.0;
+   info.t      = t;
+   info.n_win  = 0;
+
+   run_thread_tasks(smooth_median_task, &info, dp.ny(), get_num_threads());
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Smooth the DataPlane values using the interpolation method and
@@ -96,8 +746,8 @@ void smooth_field(const DataPlane &dp, DataPlane &smooth_dp,
                   InterpMthd mthd, int width,
                   const GridTemplateFactory::GridTemplates shape,
                   double t, const GaussianInfo &gaussian) {
-   double v = 0.0;
-   int x, y;
+   NbrhdSums sums;
+   SmoothFieldTaskInfo info;
 
    // Initialize the smoothed field to the raw field
    smooth_dp = dp;
@@ -115,54 +765,53 @@ void smooth_field(const DataPlane &dp, DataPlane &smooth_dp,
         << " interpolation method.\n";
 
    // Otherwise, apply smoothing to each grid point
-   for(x=0; x<dp.nx(); x++) {
-      for(y=0; y<dp.ny(); y++) {
-
-         // Compute the smoothed value based on the interpolation method
-         switch(mthd) {
-
-            case(InterpMthd_Min):      // Minimum
-               v = interp_min(dp, *gt, x, y, t);
-               break;
-
-            case(InterpMthd_Max):      // Maximum
-               v = interp_max(dp, *gt, x, y, t);
-               break;
-
-            case(InterpMthd_Median):   // Median
-               v = interp_median(dp, *gt, x, y, t);
-               break;
-
-            case(InterpMthd_UW_Mean):  // Unweighted Mean
-               v = interp_uw_mean(dp, *gt, x, y, t);
-               break;
-
-            case(InterpMthd_Gaussian): // For Gaussian, pass the data through
-               v = dp.get(x, y);
-               break;
-
-            case(InterpMthd_MaxGauss): // For Max Gaussian, compute the max
-               v = interp_max(dp, *gt, x, y, 0);
-               break;
-
-            // Distance-weighted mean, area-weighted mean, least-squares
-            // fit, and bilinear are omitted here since they are not
-            // options for gridded data.
-
-            default:
-               mlog << Error << "\nsmooth_field() -> "
-                    << "unsupported interpolation method encountered: "
-                    << interpmthd_to_string(mthd) << "(" << mthd
-                    << ")\n\n";
-               exit(1);
-               break;
-         }
-
-         // Store the smoothed value
-         smooth_dp.set(v, x, y);
-
-      } // end for y
-   } // end for x
+   switch(mthd) {
+
+      case(InterpMthd_Min):      // Minimum
+         build_nbrhd_sums(sums, dp, *gt, (const SingleThresh *) 0, false);
+         smooth_window_min(dp, smooth_dp, *gt, sums, 1.0, t);
+         break;
+
+      case(InterpMthd_Max):      // Maximum
+         build_nbrhd_sums(sums, dp, *gt, (const SingleThresh *) 0, false);
+         smooth_window_min(dp, smooth_dp, *gt, sums, -1.0, t);
+         break;
+
+      case(InterpMthd_Median):   // Median
+         smooth_median(dp, smooth_dp, *gt, t);
+         break;
+
+      case(InterpMthd_UW_Mean):  // Unweighted Mean
+         build_nbrhd_sums(sums, dp, *gt, (const SingleThresh *) 0, true);
+         info.dp     = &dp;
+         info.out_dp = &smooth_dp;
+         info.gt     = gt;
+         info.sums   = &sums;
+         info.mthd   = mthd;
+         info.t      = t;
+         run_thread_tasks(smooth_field_task, &info, dp.ny(), get_num_threads());
+         break;
+
+      case(InterpMthd_Gaussian): // For Gaussian, pass the data through
+         break;
+
+      case(InterpMthd_MaxGauss): // For Max Gaussian, compute the max
+         build_nbrhd_sums(sums, dp, *gt, (const SingleThresh *) 0, false);
+         smooth_window_min(dp, smooth_dp, *gt, sums, -1.0, 0.0);
+         break;
+
+      // Distance-weighted mean, area-weighted mean, least-squares
+      // fit, and bilinear are omitted here since they are not
+      // options for gridded data.
+
+      default:
+         mlog << Error << "\nsmooth_field() -> "
+              << "unsupported interpolation method encountered: "
+              << interpmthd_to_string(mthd) << "(" << mthd
+              << ")\n\n";
+         exit(1);
+         break;
+   }
 
    // Apply the Gaussian smoother 
    if(mthd == InterpMthd_Gaussian ||
@@ -204,11 +853,8 @@ DataPlane smooth_field(const DataPlane &dp,
 void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
         int width, const GridTemplateFactory::GridTemplates shape,
         SingleThresh t, double vld_t) {
-   GridPoint *gp = NULL;
-   int x, y;
-   int n_vld = 0;
-   int n_thr = 0;
-   double v;
+   NbrhdSums sums;
+   SmoothFieldTaskInfo info;
 
    // Check that width is set to 1 or greater
    if(width < 1) {
@@ -231,61 +877,18 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
    frac_dp = dp;
    frac_dp.set_constant(bad_data_double);
 
-   // Compute the fractional coverage meeting the threshold criteria
-   for(x=0; x<dp.nx(); x++) {
-      for(y=0; y<dp.ny(); y++) {
-
-         // For a new column, reset the grid template and counts.
-         if(y == 0) {
-
-            // Initialize counts
-            n_vld = n_thr = 0;
-
-            // Sum all the points
-            for(gp  = gt->getFirstInGrid(x, y, dp.nx(), dp.ny());
-                gp != NULL;
-                gp  = gt->getNextInGrid()) {
-               if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
-               n_vld++;
-               if(t.check(v)) n_thr++;
-            }
-         }
-         // Subtract off the bottom edge, shift up, and add the top.
-         else {
-
-            // Subtract points from the the bottom edge
-            for(gp  = gt->getFirstInBotEdge();
-                gp != NULL;
-                gp  = gt->getNextInBotEdge()) {
-               if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
-               n_vld--;
-               if(t.check(v)) n_thr--;
-            }
-
-            // Increment Y
-            gt->incBaseY(1);
+   // Count the valid points and those meeting the threshold criteria
+   build_nbrhd_sums(sums, dp, *gt, &t, false);
 
-            // Add points from the the top edge
-            for(gp  = gt->getFirstInTopEdge();
-                gp != NULL;
-                gp  = gt->getNextInTopEdge()) {
-               if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
-               n_vld++;
-               if(t.check(v)) n_thr++;
-            }
-         }
-
-         // Check for enough valid data and compute fractional coverage
-         if((double)(n_vld)/gt->size() >= vld_t && n_vld != 0) {
-            frac_dp.set((double) n_thr/n_vld, x, y);
-         }
+   // Compute the fractional coverage, one row at a time
+   info.dp     = &dp;
+   info.out_dp = &frac_dp;
+   info.gt     = gt;
+   info.sums   = &sums;
+   info.mthd   = InterpMthd_Nbrhd;
+   info.t      = vld_t;
 
-      } // end for y
-
-      // Increment X
-      if(x < (dp.nx() - 1)) gt->incBaseX(1);
-
-   } // end for x
+   run_thread_tasks(smooth_field_task, &info, dp.ny(), get_num_threads());
 
    delete gt;
 
@@ -547,7 +1150,7 @@ void mask_bad_data(DataPlane &dp, const DataPlane &mask_dp, double v) {
 
    for(int i=0; i<Nxy; i++) {
       if(is_bad_data(mask_dp.data()[i])) {
-         dp.buf()[i] = v;
+         dp.buf()[i] = (dataplane_t) v;
       }
    }
 
@@ -69,17 +69,22 @@ NumArray interp_points(const DataPlane &dp, const GridTemplate &gt, double x_dbl
 
 NumArray interp_points(const DataPlane &dp, const GridTemplate &gt, int x, int y) {
    NumArray points;
+   int i, gx, gy;
+
+   points.extend(gt.size());
 
    // Search the neighborhood, storing any points off the grid as bad data
-   GridPoint *gp = NULL;
-   for(gp = gt.getFirst(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNext()) {
-      if(gp->x < 0 || gp->x >= dp.nx() ||
-         gp->y < 0 || gp->y >= dp.ny()) {
-         points.add(bad_data_double);
-      }
-      else {
-         points.add(dp.get(gp->x, gp->y));
+   for(i=0; i<gt.getNumSpans(); i++) {
+      const GridSpan &span = gt.getSpan(i);
+      gy = y + span.y_offset;
+      for(gx = x + span.x_beg_offset; gx < x + span.x_end_offset; gx++) {
+         if(gx < 0 || gx >= dp.nx() ||
+            gy < 0 || gy >= dp.ny()) {
+            points.add(bad_data_double);
+         }
+         else {
+            points.add(dp.get(gx, gy));
+         }
       }
    }
 
@@ -94,25 +99,30 @@ double interp_min(const DataPlane &dp, const GridTemplate &gt,
    int num_good_points = 0;
    int num_points = gt.size();
    double min_v = bad_data_double;
+   int i, gx, gy, gx_beg, gx_end;
 
-   // Search the neighborhood
-   GridPoint *gp = NULL;
-   for(gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   // Search the neighborhood one row at a time
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
 
-      double v = dp.get(gp->x, gp->y);
-      if(is_bad_data(v)) continue;
+      for(gx=gx_beg; gx<gx_end; gx++) {
 
-      if(is_bad_data(min_v) || v < min_v) {
-         min_v = v;
-      }
-      num_good_points++;
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
 
+         double v = row[gx];
+         if(is_bad_data(v)) continue;
+
+         if(is_bad_data(min_v) || v < min_v) {
+            min_v = v;
+         }
+         num_good_points++;
+      }
    }
 
    // Check whether enough valid grid points were found to trust
@@ -163,23 +173,30 @@ double interp_max(const DataPlane &dp, const GridTemplate &gt,
    int num_good_points = 0;
    int num_points = gt.size();
    double max_v = bad_data_double;
+   int i, gx, gy, gx_beg, gx_end;
 
-   // Search the neighborhood
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   // Search the neighborhood one row at a time
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
+
+      for(gx=gx_beg; gx<gx_end; gx++) {
+
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
 
-      double v = dp.get(gp->x, gp->y);
-      if(is_bad_data(v)) continue;
+         double v = row[gx];
+         if(is_bad_data(v)) continue;
 
-      if(is_bad_data(max_v) || v > max_v) {
-         max_v = v;
+         if(is_bad_data(max_v) || v > max_v) {
+            max_v = v;
+         }
+         num_good_points++;
       }
-      num_good_points++;
    }
 
    // Check whether enough valid grid points were found to trust
@@ -231,24 +248,31 @@ double interp_median(const DataPlane &dp, const GridTemplate &gt,
    int num_good_points = 0;
    int num_points = gt.size();
    double median_v;
+   int i, gx, gy, gx_beg, gx_end;
 
    // Allocate space to store the data points for sorting
    data = new double [gt.size()];
 
-   // Search the neighborhood
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   // Search the neighborhood one row at a time
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
 
-      double v = dp.get(gp->x, gp->y);
-      if(is_bad_data(v)) continue;
+      for(gx=gx_beg; gx<gx_end; gx++) {
 
-      data[num_good_points] = v;
-      num_good_points++;
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
+
+         double v = row[gx];
+         if(is_bad_data(v)) continue;
+
+         data[num_good_points] = v;
+         num_good_points++;
+      }
    }
 
    // Check whether enough valid grid points were found to trust
@@ -317,20 +341,27 @@ double interp_uw_mean(const DataPlane &dp, const GridTemplate &gt,
    int num_good_points = 0;
    int num_points = gt.size();
    double uw_mean_v;
+   int i, gx, gy, gx_beg, gx_end;
 
-   // Sum the valid data in the neighborhood
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   // Sum the valid data in the neighborhood one row at a time
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
+
+      for(gx=gx_beg; gx<gx_end; gx++) {
 
-      double v = dp.get(gp->x, gp->y);
-      if (is_bad_data(v)) continue;
-      sum += v;
-      num_good_points++;
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
+
+         double v = row[gx];
+         if (is_bad_data(v)) continue;
+         sum += v;
+         num_good_points++;
+      }
    }
 
    // Check whether enough valid grid points were found to trust
@@ -395,6 +426,7 @@ double interp_dw_mean(const DataPlane &dp, const GridTemplate &gt,
    double count = 0;
    double wght_sum = 0;
    double numerator = 0;
+   int i, gx, gy, gx_beg, gx_end;
 
    int x = nint(obs_x);
    int y = nint(obs_y);
@@ -405,32 +437,36 @@ double interp_dw_mean(const DataPlane &dp, const GridTemplate &gt,
       y = floor(obs_y);
    }
 
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
 
-      x = gp->x;
-      y = gp->y;
-      double data = dp.get(x, y);
+      for(gx=gx_beg; gx<gx_end; gx++) {
 
-      if(is_bad_data(data)) continue;
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
 
-      double dist = sqrt(pow((obs_x-x), 2.0) + pow((obs_y-y), 2.0));
+         double data = row[gx];
 
-      // if the distance is tiny, just use the value at this point.
-      if(dist <= 0.001) {
-         return data;
-      }
+         if(is_bad_data(data)) continue;
+
+         double dist = sqrt(pow((obs_x-gx), 2.0) + pow((obs_y-gy), 2.0));
+
+         // if the distance is tiny, just use the value at this point.
+         if(dist <= 0.001) {
+            return data;
+         }
 
-      // Otherwise, compute the weight and accumulate numerator and denominator
-      double weight = pow(dist, -1*i_pow);
-      wght_sum  += weight;
-      numerator += (weight * data);
-      count++;
+         // Otherwise, compute the weight and accumulate numerator and denominator
+         double weight = pow(dist, -1*i_pow);
+         wght_sum  += weight;
+         numerator += (weight * data);
+         count++;
+      }
    }
 
    // Check whether enough valid grid points were found to compute
@@ -645,6 +681,7 @@ double interp_geog_match(const DataPlane &dp, const GridTemplate &gt,
    int interp_x, interp_y;
    double d, interp_d;
    double dx, dy, v, interp_v;
+   int i, gx, gy, gx_beg, gx_end;
    int x = nint(obs_x);
    int y = nint(obs_y);
 
@@ -658,32 +695,36 @@ double interp_geog_match(const DataPlane &dp, const GridTemplate &gt,
    interp_x = interp_y = bad_data_int;
    interp_d = interp_v = bad_data_double;
 
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
+
+      for(gx=gx_beg; gx<gx_end; gx++) {
 
-      // Get the current value
-      x = gp->x;
-      y = gp->y;
-      v = dp.get(x, y);
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
 
-      // Skip bad data
-      if(is_bad_data(v)) continue;
+         // Get the current value
+         v = row[gx];
 
-      // Compute the distance
-      dx = obs_x - x;
-      dy = obs_y - y;
-      d  = sqrt(dx*dx + dy*dy);
+         // Skip bad data
+         if(is_bad_data(v)) continue;
 
-      if(is_bad_data(interp_d) || d < interp_d) {
-         interp_d = d;
-         interp_x = x;
-         interp_y = y;
-         interp_v = v;
+         // Compute the distance
+         dx = obs_x - gx;
+         dy = obs_y - gy;
+         d  = sqrt(dx*dx + dy*dy);
+
+         if(is_bad_data(interp_d) || d < interp_d) {
+            interp_d = d;
+            interp_x = gx;
+            interp_y = gy;
+            interp_v = v;
+         }
       }
    }
 
@@ -708,23 +749,30 @@ double interp_nbrhd(const DataPlane &dp, const GridTemplate &gt, int x, int y,
                     double t, const SingleThresh *st, double cmn, double csd,
                     const MaskPlane *mp) {
    int count, count_thr;
+   int i, gx, gy, gx_beg, gx_end;
 
    // Compute the ratio of events within the neighborhood
    count = count_thr = 0;
 
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(gp->x, gp->y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
+
+      for(gx=gx_beg; gx<gx_end; gx++) {
+
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(gx, gy)) continue;
+         }
 
-      double data = dp.get(gp->x, gp->y);
-      if(is_bad_data(data)) continue;
+         double data = row[gx];
+         if(is_bad_data(data)) continue;
 
-      count++;
-      if(st->check(data, cmn, csd)) count_thr++;
+         count++;
+         if(st->check(data, cmn, csd)) count_thr++;
+      }
    }
 
    // Check whether enough valid grid points were found
@@ -865,26 +913,33 @@ double interp_best(const DataPlane &dp, const GridTemplate &gt,
                    const MaskPlane *mp) {
    int count;
    double v, min_d, min_v;
+   int i, gx, gy, gx_beg, gx_end;
 
    // Search the neighborhood for the best match to the observation
    count = 0;
    min_d = min_v = bad_data_double;
-   for(GridPoint *gp = gt.getFirstInGrid(x, y, dp.nx(), dp.ny());
-       gp != NULL; gp = gt.getNextInGrid()) {
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, dp.nx(), dp.ny(),
+                           gy, gx_beg, gx_end)) continue;
 
-      // Check the optional mask
-      if(mp) {
-         if(!(*mp)(x, y)) continue;
-      }
+      const dataplane_t *row = dp.data() + gy*dp.nx();
+
+      for(gx=gx_beg; gx<gx_end; gx++) {
+
+         // Check the optional mask
+         if(mp) {
+            if(!(*mp)(x, y)) continue;
+         }
 
-      v = dp.get(gp->x, gp->y);
-      if (is_bad_data(v)) continue;
+         v = row[gx];
+         if (is_bad_data(v)) continue;
 
-      if(is_bad_data(min_d) || fabs(v - obs_v) < min_d) {
-         min_d = fabs(v - obs_v);
-         min_v = v;
+         if(is_bad_data(min_d) || fabs(v - obs_v) < min_d) {
+            min_d = fabs(v - obs_v);
+            min_v = v;
+         }
+         count++;
       }
-      count++;
    }
 
    // Check whether enough valid grid points were found to trust
@@ -1053,30 +1108,34 @@ MaskPlane compute_sfc_mask(const GridTemplate &gt, int x, int y,
    // Search the neighborhood
    //
    mp.set_size(nx, ny, false);
-   GridPoint *gp = NULL;
-   for(gp = gt.getFirstInGrid(x, y, nx, ny);
-       gp != NULL; gp = gt.getNextInGrid()) {
-
-      // Check the land mask
-      if(sfc_info.land_ptr) {
-         bool is_land_grid = (*sfc_info.land_ptr)(gp->x, gp->y);
-         land_ok = (( is_land_obs &&  is_land_grid) ||
-                    (!is_land_obs && !is_land_grid));
-      }
-      else {
-         land_ok = true;
-      }
+   int i, gx, gy, gx_beg, gx_end;
+   for(i=0; i<gt.getNumSpans(); i++) {
+      if(!gt.getSpanInGrid(i, x, y, nx, ny,
+                           gy, gx_beg, gx_end)) continue;
+
+      for(gx=gx_beg; gx<gx_end; gx++) {
+
+         // Check the land mask
+         if(sfc_info.land_ptr) {
+            bool is_land_grid = (*sfc_info.land_ptr)(gx, gy);
+            land_ok = (( is_land_obs &&  is_land_grid) ||
+                       (!is_land_obs && !is_land_grid));
+         }
+         else {
+            land_ok = true;
+         }
 
-      // Check the topo mask
-      if(sfc_info.topo_ptr) {
-         double topo_grid = sfc_info.topo_ptr->get(gp->x, gp->y);
-         topo_ok = sfc_info.topo_interp_fcst_thresh.check(topo_grid - obs_elv);
-      }
-      else {
-         topo_ok = true;
-      }
+         // Check the topo mask
+         if(sfc_info.topo_ptr) {
+            double topo_grid = sfc_info.topo_ptr->get(gx, gy);
+            topo_ok = sfc_info.topo_interp_fcst_thresh.check(topo_grid - obs_elv);
+         }
+         else {
+            topo_ok = true;
+         }
 
-      mp.put((land_ok & topo_ok), gp->x, gp->y);
+         mp.put((land_ok & topo_ok), gx, gy);
+      }
    }
 
    return(mp);
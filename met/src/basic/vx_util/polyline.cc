@@ -21,6 +21,7 @@
 
 using namespace std;
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <unistd.h>
@@ -553,101 +554,380 @@ void Polyline::sum_second_moments(double x_bar, double y_bar,
 
 ///////////////////////////////////////////////////////////////////////////////
 //
-// Code for misc functions
+// Code for class PolylineIndex
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-double point_dist(double x1, double y1, double x2, double y2) {
-   double dx, dy;
+//
+// Cell boundaries are widened by this fraction of the cell size so that
+// round-off never drops a candidate segment
+//
+static const double polyline_index_tol = 1.0e-6;
 
-   dx = x1 - x2;
-   dy = y1 - y2;
+///////////////////////////////////////////////////////////////////////////////
 
-   return( sqrt( dx*dx + dy*dy ) );
+PolylineIndex::PolylineIndex() {
+
+   clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-double polyline_dist(const Polyline & a, const Polyline & b) {
-   int j, k, j2, k2;
-   double dist, min_dist;
+PolylineIndex::~PolylineIndex() {
+
+   clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PolylineIndex::clear() {
+
+   u.clear();
+   v.clear();
+
+   x_min = x_max = y_min = y_max = 0.0;
+
+   cell_size = 1.0;
+   nx = ny = 0;
+
+   cell_start.clear();
+   cell_seg.clear();
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void PolylineIndex::set(const Polyline &p) {
+   int i, j, k, n, ii, jj, i0, i1, j0, j1;
+   double w, h;
+   vector<int> cell_fill;
+
+   clear();
+
+   n = p.n_points;
+
+   if(n == 0) return;
+
+   u.assign(p.u, p.u + n);
+   v.assign(p.v, p.v + n);
+
+   x_min = x_max = u[0];
+   y_min = y_max = v[0];
+
+   for(i=1; i<n; i++) {
+      x_min = min(x_min, u[i]);
+      x_max = max(x_max, u[i]);
+      y_min = min(y_min, v[i]);
+      y_max = max(y_max, v[i]);
+   }
 
    //
-   //  Check whether one polyline is completely contained inside the other
-   //  i.e. Check each vertex of one polyline to see if it's contained
-   //  in the other
+   // About one cell per segment, but no more cells along a side
+   // than segments
    //
+   w = x_max - x_min;
+   h = y_max - y_min;
+
+   cell_size = max(sqrt(w*h/n), max(w, h)/n);
 
-   for (j=0; j<(a.n_points); ++j)  {
+   if(cell_size <= 0.0) cell_size = 1.0;
 
-      if ( b.is_inside(a.u[j], a.v[j]) )  return ( 0.0 );
+   nx = (int) (w/cell_size) + 1;
+   ny = (int) (h/cell_size) + 1;
+
+   //
+   // Count the segments in each cell and then fill them in.  Segment k
+   // runs from point k to point k + 1, and the last one closes the
+   // polyline.
+   //
+   cell_start.assign(nx*ny + 1, 0);
+
+   for(k=0; k<n; k++) {
+      j = (k + 1)%n;
+      cell_range(min(u[k], u[j]), max(u[k], u[j]),
+                 min(v[k], v[j]), max(v[k], v[j]), i0, i1, j0, j1);
+      for(jj=j0; jj<=j1; jj++) {
+         for(ii=i0; ii<=i1; ii++) cell_start[jj*nx + ii + 1]++;
+      }
    }
 
-   for (j=0; j<(b.n_points); ++j)  {
+   for(i=0; i<nx*ny; i++) cell_start[i + 1] += cell_start[i];
+
+   cell_seg.resize(cell_start[nx*ny]);
+   cell_fill.assign(cell_start.begin(), cell_start.end() - 1);
 
-      if ( a.is_inside(b.u[j], b.v[j]) )  return ( 0.0 );
+   for(k=0; k<n; k++) {
+      j = (k + 1)%n;
+      cell_range(min(u[k], u[j]), max(u[k], u[j]),
+                 min(v[k], v[j]), max(v[k], v[j]), i0, i1, j0, j1);
+      for(jj=j0; jj<=j1; jj++) {
+         for(ii=i0; ii<=i1; ii++) cell_seg[cell_fill[jj*nx + ii]++] = k;
+      }
    }
 
-   //
-   //  Check to see if the polylines intersect
-   //
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Range of cells overlapping the box, clipped to the grid
+//
+///////////////////////////////////////////////////////////////////////////////
+
+void PolylineIndex::cell_range(double x0, double x1, double y0, double y1,
+                               int &i0, int &i1, int &j0, int &j1) const {
+   const double tol = polyline_index_tol*cell_size;
+
+   x0 = (x0 - tol - x_min)/cell_size;
+   x1 = (x1 + tol - x_min)/cell_size;
+   y0 = (y0 - tol - y_min)/cell_size;
+   y1 = (y1 + tol - y_min)/cell_size;
+
+   i0 = (int) floor(max(0.0, min(x0, nx - 1.0)));
+   i1 = (int) floor(max(0.0, min(x1, nx - 1.0)));
+   j0 = (int) floor(max(0.0, min(y0, ny - 1.0)));
+   j1 = (int) floor(max(0.0, min(y1, ny - 1.0)));
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+double PolylineIndex::box_dist(double x, double y) const {
+   double dx, dy;
+
+   dx = max(0.0, max(x_min - x, x - x_max));
+   dy = max(0.0, max(y_min - y, y - y_max));
 
-   for (j=0; j<(a.n_points); ++j)  {
+   return(sqrt(dx*dx + dy*dy));
+}
+
+///////////////////////////////////////////////////////////////////////////////
 
-      j2 = (j + 1)%(a.n_points);
+double PolylineIndex::box_dist(const PolylineIndex &p) const {
+   double dx, dy;
 
-      for (k=0; k<(b.n_points); ++k)  {
+   if(n_points() == 0 || p.n_points() == 0) return(0.0);
 
-         k2 = (k + 1)%(b.n_points);
+   dx = max(0.0, max(p.x_min - x_max, x_min - p.x_max));
+   dy = max(0.0, max(p.y_min - y_max, y_min - p.y_max));
 
-         if ( intersect_linesegment( a.u[j], a.v[j], a.u[j2], a.v[j2],
-                                     b.u[k], b.v[k], b.u[k2], b.v[k2] ) ) {
+   return(sqrt(dx*dx + dy*dy));
+}
 
-            return ( 0.0 );
+///////////////////////////////////////////////////////////////////////////////
 
+int PolylineIndex::is_inside(double u_test, double v_test) const {
+   int i, j;
+   const int n = n_points();
+   double Angle, Angle0, a, b, c, d;
+
+   if(n == 0) return(0);
+
+   a = u[0] - u_test;
+   b = v[0] - v_test;
+
+   Angle = Angle0 = atan2(b, a)/pi;
+
+   for(i=0; i<n; i++) {
+
+      j = (i+1)%n;
+
+      c = u[j] - u_test;
+      d = v[j] - v_test;
+
+      Angle += atan2(a*d - b*c, a*c + b*d)/pi;
+
+      a = c;
+      b = d;
+   }
+
+   return(nint( (Angle - Angle0)/2 ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Search rings of cells outward from the cell nearest the test point.
+// Every cell of a ring is at least as far away as some cell of the
+// ring inside it, so the search stops at the first ring with no cell
+// closer than the current minimum.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+double PolylineIndex::min_dist(double x, double y, double max_dist) const {
+   int i, j, k, m, r, r_max, cx, cy, step;
+   double dx, dy, d, best;
+   bool found;
+   const int n = n_points();
+   const double tol = polyline_index_tol*cell_size;
+
+   best = max_dist;
+
+   if(n == 0 || box_dist(x, y) - tol >= best) return(best);
+
+   cx = (int) floor(max(0.0, min((x - x_min)/cell_size, nx - 1.0)));
+   cy = (int) floor(max(0.0, min((y - y_min)/cell_size, ny - 1.0)));
+
+   r_max = max(max(cx, nx - 1 - cx), max(cy, ny - 1 - cy));
+
+   for(r=0; r<=r_max; r++) {
+
+      found = false;
+
+      for(j=cy-r; j<=cy+r; j++) {
+
+         if(j < 0 || j >= ny) continue;
+
+         // Whole rows at the top and bottom, the two ends otherwise
+         step = (j == cy-r || j == cy+r ? 1 : max(2*r, 1));
+
+         for(i=cx-r; i<=cx+r; i+=step) {
+
+            if(i < 0 || i >= nx) continue;
+
+            dx = max(0.0, max(x_min + i*cell_size - x,
+                              x - (x_min + (i + 1)*cell_size)));
+            dy = max(0.0, max(y_min + j*cell_size - y,
+                              y - (y_min + (j + 1)*cell_size)));
+
+            if(sqrt(dx*dx + dy*dy) - tol >= best) continue;
+
+            found = true;
+
+            for(m=cell_start[j*nx + i]; m<cell_start[j*nx + i + 1]; m++) {
+               k = cell_seg[m];
+               d = min_dist_linesegment(u[k], v[k],
+                                        u[(k + 1)%n], v[(k + 1)%n], x, y);
+               if(d < best) best = d;
+            }
          }
       }
+
+      if(!found) break;
    }
 
-   //
-   //  Find the minimum distance between the polylines
-   //
+   return(best);
+}
 
-   min_dist = 1.0e10;
+///////////////////////////////////////////////////////////////////////////////
 
-   //
-   //  Points of A from sides of B
-   //
+bool PolylineIndex::intersects(const PolylineIndex &p) const {
+   int i, j, k, k2, m, t, t2, i0, i1, j0, j1;
+   double x0, x1, y0, y1;
+   const int n = n_points();
+   const int pn = p.n_points();
+   const double tol = polyline_index_tol*max(cell_size, p.cell_size);
 
-   for (j=0; j<(a.n_points); ++j)  {
+   if(n == 0 || pn == 0 || box_dist(p) > tol) return(false);
 
-      for (k=0; k<(b.n_points); ++k)  {
+   for(k=0; k<n; k++) {
 
-         k2 = (k + 1)%(b.n_points);
+      k2 = (k + 1)%n;
 
-         dist = min_dist_linesegment(b.u[k], b.v[k], b.u[k2], b.v[k2], a.u[j], a.v[j]);
+      x0 = min(u[k], u[k2]);
+      x1 = max(u[k], u[k2]);
+      y0 = min(v[k], v[k2]);
+      y1 = max(v[k], v[k2]);
 
-         if ( dist < min_dist )  min_dist = dist;
+      if(x1 < p.x_min - tol || x0 > p.x_max + tol ||
+         y1 < p.y_min - tol || y0 > p.y_max + tol) continue;
 
-      }
+      p.cell_range(x0, x1, y0, y1, i0, i1, j0, j1);
 
+      for(j=j0; j<=j1; j++) {
+         for(i=i0; i<=i1; i++) {
+            for(m=p.cell_start[j*p.nx + i]; m<p.cell_start[j*p.nx + i + 1]; m++) {
+
+               t  = p.cell_seg[m];
+               t2 = (t + 1)%pn;
+
+               if(max(p.u[t], p.u[t2]) < x0 - tol ||
+                  min(p.u[t], p.u[t2]) > x1 + tol ||
+                  max(p.v[t], p.v[t2]) < y0 - tol ||
+                  min(p.v[t], p.v[t2]) > y1 + tol) continue;
+
+               if(intersect_linesegment(u[k], v[k], u[k2], v[k2],
+                                        p.u[t], p.v[t], p.u[t2], p.v[t2])) {
+                  return(true);
+               }
+            }
+         }
+      }
    }
 
+   return(false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Code for misc functions
+//
+///////////////////////////////////////////////////////////////////////////////
+
+double point_dist(double x1, double y1, double x2, double y2) {
+   double dx, dy;
+
+   dx = x1 - x2;
+   dy = y1 - y2;
+
+   return( sqrt( dx*dx + dy*dy ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+double polyline_dist(const Polyline & a, const Polyline & b) {
+   PolylineIndex a_index, b_index;
+
+   a_index.set(a);
+   b_index.set(b);
+
+   return ( polyline_dist(a_index, b_index) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+double polyline_dist(const PolylineIndex & a, const PolylineIndex & b) {
+   int j;
+   double min_dist;
+
    //
-   //  Points of B from sides of A
+   //  No points of one polyline means no sides to measure from
    //
 
-   for (j=0; j<(b.n_points); ++j)  {
+   min_dist = 1.0e10;
 
-      for (k=0; k<(a.n_points); ++k)  {
+   if ( a.n_points() == 0 || b.n_points() == 0 )  return ( min_dist );
 
-         k2 = (k + 1)%(a.n_points);
+   //
+   //  Check to see if the polylines intersect.  Otherwise, neither
+   //  boundary crosses the other, so every point of one polyline is
+   //  inside the other or none is, and checking one point suffices
+   //  to see whether one polyline is contained inside the other.
+   //
 
-         dist = min_dist_linesegment(a.u[k], a.v[k], a.u[k2], a.v[k2], b.u[j], b.v[j]);
+   if ( a.box_dist(b) <= 0.0 )  {
 
-         if ( dist < min_dist )  min_dist = dist;
+      if ( a.intersects(b) )  return ( 0.0 );
 
-      }
+      if ( b.is_inside(a.point_u(0), a.point_v(0)) ||
+           a.is_inside(b.point_u(0), b.point_v(0)) )  return ( 0.0 );
+   }
+
+   //
+   //  Find the minimum distance between the polylines:
+   //  points of A from sides of B, and points of B from sides of A
+   //
+
+   for (j=0; j<(a.n_points()); ++j)  {
+
+      min_dist = b.min_dist(a.point_u(j), a.point_v(j), min_dist);
+
+   }
+
+   for (j=0; j<(b.n_points()); ++j)  {
+
+      min_dist = a.min_dist(b.point_u(j), b.point_v(j), min_dist);
 
    }
 
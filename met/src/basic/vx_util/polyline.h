@@ -25,6 +25,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <vector>
 
 #include "vx_util.h"
 #include "vx_math.h"
@@ -101,12 +102,90 @@ class Polyline {
 
 };
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Spatial index of the points and segments of a closed polyline, for
+// repeated distance and intersection queries.  The segments are binned
+// into a uniform grid of cells covering the bounding box.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+class PolylineIndex {
+
+   private:
+
+      std::vector<double> u;          //  copy of the points
+      std::vector<double> v;
+
+      double x_min, x_max, y_min, y_max;
+
+      double cell_size;
+      int    nx, ny;
+
+      std::vector<int> cell_start;    //  segments of cell n are cell_seg[cell_start[n]]
+      std::vector<int> cell_seg;      //  up to cell_seg[cell_start[n + 1]]
+
+      void cell_range(double, double, double, double,
+                      int &, int &, int &, int &) const;
+
+   public:
+
+      PolylineIndex();
+     ~PolylineIndex();
+
+      void clear();
+
+      void set(const Polyline &);
+
+      int n_points() const;
+
+      double point_u(int) const;
+      double point_v(int) const;
+
+         //
+         //  distance from the bounding box
+         //
+
+      double box_dist(double, double) const;
+
+      double box_dist(const PolylineIndex &) const;
+
+         //
+         //  same as Polyline::is_inside()
+         //
+
+      int is_inside(double, double) const;
+
+         //
+         //  minimum distance from the test point to the segments,
+         //  if less than max_dist, or max_dist otherwise
+         //
+
+      double min_dist(double, double, double max_dist) const;
+
+         //
+         //  whether any segment crosses a segment of the other
+         //
+
+      bool intersects(const PolylineIndex &) const;
+
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline int PolylineIndex::n_points() const { return ( (int) u.size() ); }
+
+inline double PolylineIndex::point_u(int i) const { return ( u[i] ); }
+inline double PolylineIndex::point_v(int i) const { return ( v[i] ); }
+
 ///////////////////////////////////////////////////////////////////////////////
 
 extern double point_dist(double x1, double y1, double x2, double y2);
 
 extern double polyline_dist(const Polyline &, const Polyline &);
 
+extern double polyline_dist(const PolylineIndex &, const PolylineIndex &);
+
 extern double polyline_pw_ls_mean_dist(const Polyline &, const Polyline &);
 
 extern double polyline_pw_mean_sq_dist(const Polyline &, const Polyline &);
@@ -0,0 +1,275 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "vx_log.h"
+
+#include "scratch_array.h"
+#include "temp_file.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static long long parse_scratch_mem_limit();
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  used when the physical memory size can't be determined
+   //
+
+static const long long fallback_scratch_mem_limit = 1LL << 30;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long get_scratch_mem_limit()
+
+{
+
+static const long long n = parse_scratch_mem_limit();
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long parse_scratch_mem_limit()
+
+{
+
+long long n, n_pages, page_size;
+ConcatString cs;
+
+n_pages   = (long long) sysconf(_SC_PHYS_PAGES);
+page_size = (long long) sysconf(_SC_PAGE_SIZE);
+
+if ( n_pages > 0 && page_size > 0 )  {
+
+   n = (long long) (default_scratch_mem_fraction*n_pages*page_size);
+
+} else {
+
+   n = fallback_scratch_mem_limit;
+
+}
+
+if ( get_env(met_scratch_mem_limit_env, cs) )  {
+
+   if ( atoll(cs.c_str()) < 0 )  {
+
+      mlog << Warning << "\nget_scratch_mem_limit() -> "
+           << "ignoring " << met_scratch_mem_limit_env << " value \""
+           << cs << "\" and using " << n << " bytes.\n\n";
+
+   } else {
+
+      n = atoll(cs.c_str()) << 20;
+
+   }
+
+}
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class ScratchArray
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ScratchArray::ScratchArray()
+
+{
+
+init_from_scratch();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ScratchArray::~ScratchArray()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void ScratchArray::init_from_scratch()
+
+{
+
+Buf    = (double *) 0;
+OnDisk = false;
+Fd     = -1;
+
+clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void ScratchArray::clear()
+
+{
+
+if ( OnDisk )  {
+
+   if ( Buf )  munmap(Buf, (size_t) N*sizeof(double));
+
+   if ( Fd >= 0 )  close(Fd);
+
+   remove_temp_file(FileName);
+
+}
+
+Data.clear();
+
+N      = 0;
+Buf    = (double *) 0;
+OnDisk = false;
+Fd     = -1;
+
+FileName.clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void ScratchArray::set_size(long long n, long long mem_limit,
+                            const char * tmp_dir, const char * prefix)
+
+{
+
+ConcatString cs;
+size_t n_bytes;
+void * p = (void *) 0;
+
+clear();
+
+if ( n < 0 )  {
+
+   mlog << Error << "\nScratchArray::set_size() -> "
+        << "bad size requested (" << n << ")!\n\n";
+
+   exit ( 1 );
+
+}
+
+N = n;
+
+n_bytes = (size_t) N*sizeof(double);
+
+   //
+   //  keep the values in memory when they fit within the limit
+   //
+
+if ( (long long) n_bytes <= mem_limit || N == 0 )  {
+
+   Data.assign((size_t) N, 0.0);
+
+   Buf = Data.data();
+
+   return;
+
+}
+
+   //
+   //  otherwise, map a temporary file of the requested size
+   //
+
+cs << cs_erase << tmp_dir << "/" << prefix;
+
+FileName = make_temp_file_name(cs.c_str(), NULL);
+
+Fd = open(FileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+if ( Fd < 0 || ftruncate(Fd, (off_t) n_bytes) != 0 )  {
+
+   mlog << Error << "\nScratchArray::set_size() -> "
+        << "can't create the " << n_bytes << " byte temporary file \""
+        << FileName << "\": " << strerror(errno) << "\n\n";
+
+   exit ( 1 );
+
+}
+
+OnDisk = true;
+
+p = mmap(0, n_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+
+if ( p == MAP_FAILED )  {
+
+   mlog << Error << "\nScratchArray::set_size() -> "
+        << "can't memory map the temporary file \""
+        << FileName << "\": " << strerror(errno) << "\n\n";
+
+   exit ( 1 );
+
+}
+
+Buf = (double *) p;
+
+mlog << Debug(4) << "Scratch array of " << N << " values exceeds the "
+     << mem_limit << " byte memory limit and is mapped to temp file: "
+     << FileName << "\n";
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
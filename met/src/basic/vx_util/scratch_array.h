@@ -0,0 +1,126 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __SCRATCH_ARRAY_H__
+#define  __SCRATCH_ARRAY_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+
+#include "concat_string.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  environment variable for the memory limit, in megabytes, of a
+   //  scratch array held in memory.  The default is a fraction of the
+   //  physical memory.
+   //
+
+static const char   met_scratch_mem_limit_env [] = "MET_SCRATCH_MEM_LIMIT_MB";
+
+static const double default_scratch_mem_fraction = 0.5;
+
+extern long long get_scratch_mem_limit();   //  in bytes
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Large array of doubles held in memory when it fits within a
+   //  memory limit and otherwise memory mapped from a temporary file
+   //
+
+
+class ScratchArray {
+
+   private:
+
+      void init_from_scratch();
+
+      ScratchArray(const ScratchArray &);
+      ScratchArray & operator=(const ScratchArray &);
+
+      long long N;
+
+      double * Buf;                 //  not allocated, points into Data or the mapping
+
+      std::vector<double> Data;
+
+      bool OnDisk;
+
+      int Fd;
+
+      ConcatString FileName;
+
+   public:
+
+      ScratchArray();
+     ~ScratchArray();
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+      void set_size(long long n, long long mem_limit,
+                    const char * tmp_dir, const char * prefix);
+
+         //
+         //  get stuff
+         //
+
+      long long n() const;
+
+      bool on_disk() const;
+
+      const char * file_name() const;
+
+      double * buf();
+
+      const double * buf() const;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+inline long long ScratchArray::n() const { return ( N ); }
+
+inline bool ScratchArray::on_disk() const { return ( OnDisk ); }
+
+inline const char * ScratchArray::file_name() const { return ( FileName.c_str() ); }
+
+inline double * ScratchArray::buf() { return ( Buf ); }
+
+inline const double * ScratchArray::buf() const { return ( Buf ); }
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __SCRATCH_ARRAY_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,270 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <cstdio>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sidecar_file.h"
+#include "string_fxns.h"
+#include "temp_file.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const int sidecar_bom = 0x01020304;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+unsigned long long sidecar_hash(const char * s)
+
+{
+
+unsigned long long h = 14695981039346656037ULL;
+
+for (; *s; ++s)  {
+
+   h ^= (unsigned char) *s;
+   h *= 1099511628211ULL;
+
+}
+
+return ( h );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString hashed_file_name(const char * dir, const char * prefix,
+                              const char * key, const char * ext)
+
+{
+
+ConcatString cs;
+
+cs << dir << '/' << prefix << str_format("%016llx", sidecar_hash(key)) << ext;
+
+return ( cs );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString sidecar_file_name(const char * path, const char * ext,
+                               const char * dir_env)
+
+{
+
+ConcatString cs, dir;
+const char * short_name = get_short_name(path);
+
+if ( dir_env && get_env(dir_env, dir) && dir.nonempty() )  {
+
+      //
+      //  hash the resolved path so that every spelling of the
+      //  same file shares one sidecar
+      //
+
+   char resolved[PATH_MAX];
+   const char * key = ( realpath(path, resolved) ? resolved : path );
+
+   cs << short_name << '.';
+
+   return ( hashed_file_name(dir.c_str(), cs.c_str(), key, ext) );
+
+}
+
+cs.add(string(path, short_name - path).c_str());
+
+cs << '.' << short_name << ext;
+
+return ( cs );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool open_sidecar(ofstream & out, const char * path, ConcatString & tmp_path)
+
+{
+
+tmp_path = make_temp_file_name(path, NULL);
+
+out.open(tmp_path.c_str(), ios::out | ios::binary | ios::trunc);
+
+return ( (bool) out );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool commit_sidecar(ofstream & out, const char * path, const ConcatString & tmp_path)
+
+{
+
+out.close();
+
+if ( !out || rename(tmp_path.c_str(), path) != 0 )  {
+
+   remove(tmp_path.c_str());
+
+   return ( false );
+
+}
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void write_sidecar_header(ofstream & out, const char * magic, int version)
+
+{
+
+out.write(magic, strlen(magic) + 1);
+
+write_bin_int(out, sidecar_bom);
+write_bin_int(out, version);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool read_sidecar_header(ifstream & in, const char * magic, int version)
+
+{
+
+const size_t n = strlen(magic) + 1;
+string buf(n, '\0');
+int bom, v;
+
+in.read(&buf[0], n);
+
+if ( !in || memcmp(buf.data(), magic, n) != 0 )  return ( false );
+
+return ( read_bin_int(in, bom) && bom == sidecar_bom &&
+         read_bin_int(in, v)   && v   == version );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void write_bin_int(ofstream & out, int i)
+
+{
+
+out.write((const char *) &i, sizeof(i));
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void write_bin_long_long(ofstream & out, long long i)
+
+{
+
+out.write((const char *) &i, sizeof(i));
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void write_bin_double(ofstream & out, double d)
+
+{
+
+out.write((const char *) &d, sizeof(d));
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool read_bin_int(ifstream & in, int & i)
+
+{
+
+in.read((char *) &i, sizeof(i));
+
+return ( !in.fail() );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool read_bin_long_long(ifstream & in, long long & i)
+
+{
+
+in.read((char *) &i, sizeof(i));
+
+return ( !in.fail() );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool read_bin_double(ifstream & in, double & d)
+
+{
+
+in.read((char *) &d, sizeof(d));
+
+return ( !in.fail() );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,105 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __SIDECAR_FILE_H__
+#define  __SIDECAR_FILE_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Sidecar files are binary files written next to an input file,
+   //  or in a cache directory, that save work on later runs, such as
+   //  GRIB record indexes, STAT file caches and regrid plans.
+   //
+   //  Each one starts with a magic string, a byte order mark and a
+   //  version number, and all values are in native byte order.  A file
+   //  that does not match is simply rebuilt.
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <fstream>
+
+#include "concat_string.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  64-bit FNV-1a hash, which is the same on every platform
+   //
+
+extern unsigned long long sidecar_hash(const char *);
+
+   //
+   //  "dir/prefix<hash of key>ext"
+   //
+
+extern ConcatString hashed_file_name(const char * dir, const char * prefix,
+                                     const char * key, const char * ext);
+
+   //
+   //  ".short_name.ext" in the directory of path or, when the dir_env
+   //  environment variable names a directory, "short_name.<hash>.ext"
+   //  in that directory, since short names are often reused.  The hash
+   //  is of the resolved path when the file exists.
+   //
+
+extern ConcatString sidecar_file_name(const char * path, const char * ext,
+                                      const char * dir_env = (const char *) 0);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The output is written to a temporary file that is renamed into
+   //  place when it is committed, so that concurrent runs never read a
+   //  partial file.  commit_sidecar() removes the temporary file if
+   //  anything failed.
+   //
+
+extern bool open_sidecar   (std::ofstream &, const char * path, ConcatString & tmp_path);
+extern bool commit_sidecar (std::ofstream &, const char * path, const ConcatString & tmp_path);
+
+extern void write_sidecar_header (std::ofstream &, const char * magic, int version);
+extern bool read_sidecar_header  (std::ifstream &, const char * magic, int version);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+extern void write_bin_int       (std::ofstream &, int);
+extern void write_bin_long_long (std::ofstream &, long long);
+extern void write_bin_double    (std::ofstream &, double);
+
+extern bool read_bin_int        (std::ifstream &, int &);
+extern bool read_bin_long_long  (std::ifstream &, long long &);
+extern bool read_bin_double     (std::ifstream &, double &);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __SIDECAR_FILE_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
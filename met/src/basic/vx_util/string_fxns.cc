@@ -190,6 +190,7 @@ int num_tokens(const char *test_str, const char *separator)
    int n;
    char *temp_str = (char *) 0;
    char *c = (char *) 0;
+   char *save = (char *) 0;
 
    //
    // Check for an empty string
@@ -211,7 +212,7 @@ int num_tokens(const char *test_str, const char *separator)
    //
    // Compute the number of tokens in the string
    //
-   c = strtok(temp_str, separator);
+   c = strtok_r(temp_str, separator, &save);
 
    //
    // Check for an empty string
@@ -222,7 +223,7 @@ int num_tokens(const char *test_str, const char *separator)
    //
    // Parse remaining tokens
    //
-   while((c = strtok(0, separator)) != NULL) n++;
+   while((c = strtok_r(0, separator, &save)) != NULL) n++;
 
    if(temp_str) { delete [] temp_str; temp_str = (char *) 0; }
 
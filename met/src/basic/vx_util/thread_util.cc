@@ -0,0 +1,240 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#ifdef WITH_THREADS
+#include <thread>
+#endif
+
+#include "vx_log.h"
+
+#include "thread_util.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static int parse_num_threads();
+
+#ifdef WITH_THREADS
+static void run_nested_task(ThreadTaskFunction, void *, int, int, int);
+#endif
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Set while running a task so that nested calls run serially
+   //  rather than multiplying the number of threads.
+   //
+
+#ifdef WITH_THREADS
+static thread_local bool in_thread_task = false;
+#endif
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Number of worker threads requested through the MET_NUM_THREADS
+   //  environment variable.  Always 1 when built without thread support
+   //  or when called from within a running task.
+   //
+
+int get_num_threads()
+
+{
+
+static const int n = parse_num_threads();
+
+#ifdef WITH_THREADS
+if ( in_thread_task )  return ( 1 );
+#endif
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int parse_num_threads()
+
+{
+
+int n = default_num_threads;
+ConcatString cs;
+
+if ( get_env(met_num_threads_env, cs) )  {
+
+   n = atoi(cs.c_str());
+
+   if ( n < 1 )  {
+
+      mlog << Warning << "\nget_num_threads() -> "
+           << "ignoring " << met_num_threads_env << " value \""
+           << cs << "\" and using " << default_num_threads
+           << " thread(s).\n\n";
+
+      n = default_num_threads;
+
+   }
+
+}
+
+#ifndef WITH_THREADS
+
+if ( n > 1 )  {
+
+   mlog << Warning << "\nget_num_threads() -> "
+        << "ignoring " << met_num_threads_env << " since MET was "
+        << "built without thread support.\n\n";
+
+   n = 1;
+
+}
+
+#endif
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Contiguous slice of [0, n_tasks) handled by thread i_thread.
+   //  The split depends only on n_tasks and n_threads, so results that
+   //  depend on the slice boundaries are reproducible.
+   //
+
+void thread_task_range(int n_tasks, int n_threads, int i_thread, int & i_beg, int & i_end)
+
+{
+
+i_beg = (int) (((long long) n_tasks * i_thread      )/n_threads);
+i_end = (int) (((long long) n_tasks * (i_thread + 1))/n_threads);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Split n_tasks across n_threads and run the task function on each
+   //  slice.  The calling thread processes the first slice itself and
+   //  returns once every slice is finished.  Calls made from within a
+   //  running task are processed serially on the calling thread.
+   //
+
+void run_thread_tasks(ThreadTaskFunction f, void * data, int n_tasks, int n_threads)
+
+{
+
+int j, i_beg, i_end;
+
+if ( n_tasks <= 0 )  return;
+
+if ( n_threads < 1 )        n_threads = 1;
+if ( n_threads > n_tasks )  n_threads = n_tasks;
+
+#ifdef WITH_THREADS
+
+if ( in_thread_task )  {
+
+   for (j=0; j<n_threads; ++j)  {
+
+      thread_task_range(n_tasks, n_threads, j, i_beg, i_end);
+
+      f(data, j, i_beg, i_end);
+
+   }
+
+   return;
+
+}
+
+vector<thread> workers;
+
+for (j=1; j<n_threads; ++j)  {
+
+   thread_task_range(n_tasks, n_threads, j, i_beg, i_end);
+
+   workers.push_back(thread(run_nested_task, f, data, j, i_beg, i_end));
+
+}
+
+thread_task_range(n_tasks, n_threads, 0, i_beg, i_end);
+
+run_nested_task(f, data, 0, i_beg, i_end);
+
+for (j=0; j<(int) workers.size(); ++j)  workers[j].join();
+
+#else
+
+for (j=0; j<n_threads; ++j)  {
+
+   thread_task_range(n_tasks, n_threads, j, i_beg, i_end);
+
+   f(data, j, i_beg, i_end);
+
+}
+
+#endif
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifdef WITH_THREADS
+
+void run_nested_task(ThreadTaskFunction f, void * data, int i_thread, int i_beg, int i_end)
+
+{
+
+const bool save = in_thread_task;
+
+in_thread_task = true;
+
+f(data, i_thread, i_beg, i_end);
+
+in_thread_task = save;
+
+return;
+
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,59 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __THREAD_UTIL_H__
+#define  __THREAD_UTIL_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  environment variable for the number of worker threads
+   //
+
+static const char met_num_threads_env [] = "MET_NUM_THREADS";
+
+static const int  default_num_threads    = 1;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  task run on one thread over the index range [i_beg, i_end)
+   //
+
+typedef void (*ThreadTaskFunction)(void * data, int i_thread, int i_beg, int i_end);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+extern int  get_num_threads();
+
+extern void thread_task_range(int n_tasks, int n_threads, int i_thread, int & i_beg, int & i_end);
+
+extern void run_thread_tasks(ThreadTaskFunction, void * data, int n_tasks, int n_threads);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __THREAD_UTIL_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
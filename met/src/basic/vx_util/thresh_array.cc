@@ -260,6 +260,7 @@ void ThreshArray::parse_thresh_str(const char *thresh_str) {
    char *line = (char *) 0;
    char *c    = (char *) 0;
    char *lp   = (char *) 0;
+   char *save = (char *) 0;
    const char delim [] = " ";
    const int n = strlen(thresh_str);
 
@@ -269,7 +270,7 @@ void ThreshArray::parse_thresh_str(const char *thresh_str) {
 
    lp = line;
 
-   while((c = strtok(lp, delim)) != NULL ) {
+   while((c = strtok_r(lp, delim, &save)) != NULL ) {
 
       add(c);
 
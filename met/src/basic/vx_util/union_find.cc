@@ -0,0 +1,278 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+
+#include "vx_log.h"
+
+#include "union_find.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class UnionFind
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+UnionFind::UnionFind()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+UnionFind::~UnionFind()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void UnionFind::clear()
+
+{
+
+   //
+   //  slot 0 of the label arrays is the background
+   //
+
+Parent.assign(1, 0);
+Rank.assign(1, 0);
+SetIndex.assign(1, -1);
+
+SetRoot.clear();
+
+Nlabels = Nsets = 0;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void UnionFind::reserve(int n)
+
+{
+
+Parent.reserve(n + 1);
+Rank.reserve(n + 1);
+SetIndex.reserve(n + 1);
+SetRoot.reserve(n);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void UnionFind::range_check(int label) const
+
+{
+
+if ( (label < 1) || (label > Nlabels) )  {
+
+   mlog << Error << "\nUnionFind::range_check(int) -> "
+        << "bad label " << label << " ... must be from 1 to "
+        << Nlabels << "\n\n";
+
+   exit ( 1 );
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int UnionFind::add()
+
+{
+
+++Nlabels;
+
+Parent.push_back(Nlabels);
+Rank.push_back(0);
+SetIndex.push_back(Nsets);
+
+SetRoot.push_back(Nlabels);
+
+++Nsets;
+
+return ( Nlabels );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int UnionFind::find(int label)
+
+{
+
+range_check(label);
+
+int root, next;
+
+root = label;
+
+while ( Parent[root] != root )  root = Parent[root];
+
+   //
+   //  path compression
+   //
+
+while ( Parent[label] != root )  {
+
+   next = Parent[label];
+
+   Parent[label] = root;
+
+   label = next;
+
+}
+
+return ( root );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int UnionFind::set_index(int label)
+
+{
+
+return ( SetIndex[find(label)] );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void UnionFind::merge(int label_1, int label_2)
+
+{
+
+int root_1, root_2, root;
+int j_min, j_max, last;
+
+root_1 = find(label_1);
+root_2 = find(label_2);
+
+if ( root_1 == root_2 )  return;
+
+j_min = min(SetIndex[root_1], SetIndex[root_2]);
+j_max = max(SetIndex[root_1], SetIndex[root_2]);
+
+   //
+   //  union by rank
+   //
+
+if ( Rank[root_1] < Rank[root_2] )  {
+
+   Parent[root_1] = root = root_2;
+
+} else {
+
+   Parent[root_2] = root = root_1;
+
+   if ( Rank[root_1] == Rank[root_2] )  ++Rank[root_1];
+
+}
+
+   //
+   //  the merged set takes the lower index, and the last
+   //  set moves into the higher one
+   //
+
+SetIndex[root]  = j_min;
+SetRoot[j_min]  = root;
+
+if ( j_max < (Nsets - 1) )  {
+
+   last = SetRoot[Nsets - 1];
+
+   SetIndex[last]  = j_max;
+   SetRoot[j_max]  = last;
+
+}
+
+SetRoot.pop_back();
+
+--Nsets;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void UnionFind::ordered_set_index(vector<int> & index)
+
+{
+
+int j, root, n;
+vector<int> root_index(Nlabels + 1, -1);
+
+index.assign(Nlabels + 1, -1);
+
+for (j=1,n=0; j<=Nlabels; ++j)  {
+
+   root = find(j);
+
+   if ( root_index[root] < 0 )  root_index[root] = n++;
+
+   index[j] = root_index[root];
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
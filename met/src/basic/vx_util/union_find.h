@@ -0,0 +1,111 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __UNION_FIND_H__
+#define  __UNION_FIND_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Disjoint sets of the object labels 1, 2, ..., n used by
+   //  connected component labeling.  Label 0 is the background.
+   //
+   //  Each set also has an index from 0 to n_sets() - 1 that stays
+   //  compact as sets merge:  the merged set keeps the lower of the
+   //  two indices, and the set with the highest index moves into
+   //  the one vacated.
+   //
+
+
+class UnionFind {
+
+   private:
+
+      std::vector<int> Parent;     //  indexed by label
+      std::vector<int> Rank;       //  indexed by label
+
+      std::vector<int> SetIndex;   //  indexed by the root label of each set
+      std::vector<int> SetRoot;    //  indexed by set index
+
+      int Nlabels;
+
+      int Nsets;
+
+      void range_check(int) const;
+
+   public:
+
+      UnionFind();
+     ~UnionFind();
+
+      void clear();
+
+      void reserve(int);
+
+         //
+         //  get stuff
+         //
+
+      int n_labels() const;
+
+      int n_sets() const;
+
+      int find(int);
+
+      int set_index(int);
+
+         //
+         //  fills index[label] with the number of its set, from 0 to
+         //  n_sets() - 1, ordered by the smallest label in each set,
+         //  and index[0] with -1
+         //
+
+      void ordered_set_index(std::vector<int> & index);
+
+         //
+         //  do stuff
+         //
+
+      int add();                   //  returns the label of the new singleton set
+
+      void merge(int, int);
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+inline int UnionFind::n_labels() const { return ( Nlabels ); }
+
+inline int UnionFind::n_sets() const { return ( Nsets ); }
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __UNION_FIND_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -47,12 +47,16 @@
 #include "num_array.h"
 #include "ordinal.h"
 #include "roman_numeral.h"
+#include "scratch_array.h"
+#include "sidecar_file.h"
 #include "string_fxns.h"
 #include "substring.h"
 #include "temp_file.h"
 #include "thresh_array.h"
+#include "thread_util.h"
 #include "util_constants.h"
 #include "two_to_one.h"
+#include "union_find.h"
 #include "bool_to_string.h"
 #include "empty_string.h"
 #include "polyline.h"
@@ -0,0 +1,663 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cstdio>
+
+#include "stat_cache_file.h"
+#include "stat_line.h"
+
+#include "vx_util.h"
+#include "vx_log.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Cache file layout, all values in native byte order:
+   //
+   //     magic, byte order mark, version, source size and mtime
+   //     dictionary:  count, then length and characters of each entry
+   //     lines:       count, then the block and line number of each
+   //     blocks:      count, then for each block the number of columns,
+   //                  header columns and rows, the dictionary index of
+   //                  each header column and the byte count and
+   //                  characters of each value column
+   //
+
+static const char stat_cache_magic [] = "METSTATC";
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static bool read_count (ifstream &, int &, long long max_val);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class STATCacheFile
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATCacheFile::STATCacheFile()
+
+{
+
+init_from_scratch();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATCacheFile::~STATCacheFile()
+
+{
+
+close();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATCacheFile::STATCacheFile(const STATCacheFile &)
+
+{
+
+mlog << Error << "\nSTATCacheFile::STATCacheFile(const STATCacheFile &) -> should never be called!\n\n";
+
+exit ( 1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+STATCacheFile & STATCacheFile::operator=(const STATCacheFile &)
+
+{
+
+mlog << Error << "\nSTATCacheFile::operator=(const STATCacheFile &) -> should never be called!\n\n";
+
+exit ( 1 );
+
+return ( * this );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATCacheFile::init_from_scratch()
+
+{
+
+close();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATCacheFile::close()
+
+{
+
+LineDataFile::close();
+
+SrcSize = SrcMtime = 0;
+
+clear_lines();
+
+FromCache = false;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void STATCacheFile::clear_lines()
+
+{
+
+Dict.clear();
+Blocks.clear();
+
+LineBlock.clear();
+LineRow.clear();
+LineNum.clear();
+
+Items.clear();
+
+CurLine = 0;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int STATCacheFile::open(const char * path)
+
+{
+
+struct stat sbuf;
+ConcatString cache_path;
+
+close();
+
+   //
+   //  the size and modification time of the STAT file identify the
+   //  cache contents, so read them before the STAT file itself
+   //
+
+if ( stat(path, &sbuf) != 0 )  return ( 0 );
+
+SrcSize  = (long long) sbuf.st_size;
+SrcMtime = (long long) sbuf.st_mtime;
+
+Filename.assign(path);
+ShortFilename.assign(get_short_name(path));
+
+cache_path = sidecar_file_name(path, stat_cache_file_ext);
+
+if ( read_cache(cache_path.c_str()) )  {
+
+   FromCache = true;
+
+   mlog << Debug(4) << "Read STAT cache file \"" << cache_path << "\"\n";
+
+}
+else  {
+
+   if ( ! parse_stat_file(path) )  { close();  return ( 0 ); }
+
+   if ( write_cache(cache_path.c_str()) )  {
+
+      mlog << Debug(4) << "Wrote STAT cache file \"" << cache_path << "\"\n";
+
+   }
+   else  {
+
+      mlog << Debug(3) << "Unable to write STAT cache file \""
+           << cache_path << "\"\n";
+
+   }
+
+}
+
+CurLine = 0;
+
+Last_Line_Number = 0;
+
+return ( 1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int STATCacheFile::operator>>(DataLine & a)
+
+{
+
+int j, r, status;
+
+do {
+
+   if ( CurLine >= (int) LineBlock.size() )  return ( 0 );
+
+   const STATCacheBlock & b = Blocks[LineBlock[CurLine]];
+
+   r = LineRow[CurLine];
+
+   Items.resize(b.NCols);
+
+   for (j=0; j<b.NHdr; ++j)  {
+
+      Items[j] = Dict[b.HdrCols[j][r]].c_str();
+
+   }
+
+   for (j=b.NHdr; j<b.NCols; ++j)  {
+
+      Items[j] = b.ValCols[j - b.NHdr].c_str() + b.ValOff[j - b.NHdr][r];
+
+   }
+
+   status = a.set_items(Items.data(), b.NCols, this, LineNum[CurLine]);
+
+   Last_Line_Number = LineNum[CurLine];
+
+   ++CurLine;
+
+   if ( !status )  return ( 0 );
+
+   if ( a.is_header() )  set_header(a);
+
+} while ( !(a.is_ok()) );
+
+
+return ( 1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Read the STAT file as text and sort its columns into blocks by
+   //  line type and width.
+   //
+
+bool STATCacheFile::parse_stat_file(const char * path)
+
+{
+
+int j, n, n_hdr, offset;
+STATLine line;
+LineDataFile f;
+ConcatString key;
+map<string, int> dict_index;
+map<string, int> block_index;
+map<string, int>::const_iterator it;
+
+if ( !(f.open(path)) )  return ( false );
+
+while ( f >> line )  {
+
+   n = line.n_items();
+
+      //
+      //  dictionary encode the columns through LINE_TYPE
+      //
+
+   n_hdr = n;
+
+   if ( !line.is_header() )  {
+
+      offset = METHdrTable.col_offset(line.get_item(0, false), "STAT",
+                                      na_str, "LINE_TYPE");
+
+      if ( !is_bad_data(offset) && offset < n )  n_hdr = offset + 1;
+
+   }
+
+   key << cs_erase << statlinetype_to_string(line.type())
+       << ':' << n << ':' << n_hdr;
+
+   it = block_index.find(key.text());
+
+   if ( it == block_index.end() )  {
+
+      STATCacheBlock b;
+
+      b.NCols = n;
+      b.NHdr  = n_hdr;
+      b.NRows = 0;
+
+      b.HdrCols.resize(n_hdr);
+      b.ValCols.resize(n - n_hdr);
+      b.ValOff.resize(n - n_hdr);
+
+      block_index[key.text()] = Blocks.size();
+
+      Blocks.push_back(b);
+
+      it = block_index.find(key.text());
+
+   }
+
+   STATCacheBlock & b = Blocks[it->second];
+
+   for (j=0; j<b.NHdr; ++j)  {
+
+      map<string, int>::const_iterator d = dict_index.find(line.get_item(j, false));
+
+      if ( d == dict_index.end() )  {
+
+         dict_index[line.get_item(j, false)] = Dict.size();
+
+         b.HdrCols[j].push_back(Dict.size());
+
+         Dict.push_back(line.get_item(j, false));
+
+      }
+      else  {
+
+         b.HdrCols[j].push_back(d->second);
+
+      }
+
+   }
+
+   for (j=b.NHdr; j<b.NCols; ++j)  {
+
+      b.ValOff[j - b.NHdr].push_back(b.ValCols[j - b.NHdr].size());
+
+      b.ValCols[j - b.NHdr].append(line.get_item(j, false));
+      b.ValCols[j - b.NHdr].push_back('\0');
+
+   }
+
+   LineBlock.push_back(it->second);
+   LineRow.push_back(b.NRows++);
+   LineNum.push_back(line.line_number());
+
+}
+
+f.close();
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool STATCacheFile::read_cache(const char * path)
+
+{
+
+ifstream in;
+long long src_size, src_mtime, file_size, n_bytes;
+int i, j, k, n;
+size_t pos;
+
+in.open(path, ios::in | ios::binary);
+
+if ( !in )  return ( false );
+
+in.seekg(0, ios::end);
+file_size = (long long) in.tellg();
+in.seekg(0, ios::beg);
+
+   //
+   //  header
+   //
+
+if ( !read_sidecar_header(in, stat_cache_magic, stat_cache_version) ||
+     !read_bin_long_long(in, src_size)  || src_size  != SrcSize       ||
+     !read_bin_long_long(in, src_mtime) || src_mtime != SrcMtime )  return ( false );
+
+   //
+   //  dictionary
+   //
+
+if ( !read_count(in, n, file_size) )  return ( false );
+
+Dict.resize(n);
+
+for (i=0; i<n; ++i)  {
+
+   if ( !read_count(in, k, file_size) )  { clear_lines();  return ( false ); }
+
+   Dict[i].resize(k);
+
+   if ( k > 0 )  in.read(&Dict[i][0], k);
+
+   if ( !in )  { clear_lines();  return ( false ); }
+
+}
+
+   //
+   //  line order
+   //
+
+if ( !read_count(in, n, file_size) )  { clear_lines();  return ( false ); }
+
+LineBlock.resize(n);
+LineRow.resize(n);
+LineNum.resize(n);
+
+in.read((char *) LineBlock.data(), (streamsize) n*sizeof(int));
+in.read((char *) LineNum.data(),   (streamsize) n*sizeof(int));
+
+if ( !in )  { clear_lines();  return ( false ); }
+
+   //
+   //  blocks
+   //
+
+if ( !read_count(in, n, file_size) )  { clear_lines();  return ( false ); }
+
+Blocks.resize(n);
+
+for (i=0; i<n; ++i)  {
+
+   STATCacheBlock & b = Blocks[i];
+
+   if ( !read_count(in, b.NCols, file_size) ||
+        !read_count(in, b.NHdr,  b.NCols)    ||
+        !read_count(in, b.NRows, file_size) )  { clear_lines();  return ( false ); }
+
+   b.HdrCols.resize(b.NHdr);
+   b.ValCols.resize(b.NCols - b.NHdr);
+   b.ValOff.resize(b.NCols - b.NHdr);
+
+   for (j=0; j<b.NHdr; ++j)  {
+
+      b.HdrCols[j].resize(b.NRows);
+
+      in.read((char *) b.HdrCols[j].data(), (streamsize) b.NRows*sizeof(int));
+
+      if ( !in )  { clear_lines();  return ( false ); }
+
+      for (k=0; k<b.NRows; ++k)  {
+
+         if ( b.HdrCols[j][k] < 0 || b.HdrCols[j][k] >= (int) Dict.size() )  {
+
+            clear_lines();
+
+            return ( false );
+
+         }
+
+      }
+
+   }
+
+   for (j=0; j<(b.NCols - b.NHdr); ++j)  {
+
+      if ( !read_bin_long_long(in, n_bytes) || n_bytes < 0 || n_bytes > file_size )  {
+
+         clear_lines();
+
+         return ( false );
+
+      }
+
+      b.ValCols[j].resize(n_bytes);
+
+      if ( n_bytes > 0 )  in.read(&b.ValCols[j][0], n_bytes);
+
+      if ( !in )  { clear_lines();  return ( false ); }
+
+         //
+         //  locate the start of each value
+         //
+
+      b.ValOff[j].reserve(b.NRows);
+
+      for (pos=0; pos<b.ValCols[j].size(); ++pos)  {
+
+         b.ValOff[j].push_back(pos);
+
+         pos = b.ValCols[j].find('\0', pos);
+
+         if ( pos == string::npos )  { clear_lines();  return ( false ); }
+
+      }
+
+      if ( (int) b.ValOff[j].size() != b.NRows )  { clear_lines();  return ( false ); }
+
+   }
+
+}
+
+   //
+   //  row of each line within its block
+   //
+
+vector<int> n_rows(Blocks.size(), 0);
+
+for (i=0; i<(int) LineBlock.size(); ++i)  {
+
+   if ( LineBlock[i] < 0 || LineBlock[i] >= (int) Blocks.size() )  { clear_lines();  return ( false ); }
+
+   LineRow[i] = n_rows[LineBlock[i]]++;
+
+}
+
+for (i=0; i<(int) Blocks.size(); ++i)  {
+
+   if ( n_rows[i] != Blocks[i].NRows )  { clear_lines();  return ( false ); }
+
+}
+
+in.close();
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool STATCacheFile::write_cache(const char * path) const
+
+{
+
+ofstream out;
+ConcatString tmp_path;
+int i, j, n;
+
+if ( !open_sidecar(out, path, tmp_path) )  return ( false );
+
+write_sidecar_header(out, stat_cache_magic, stat_cache_version);
+
+write_bin_long_long(out, SrcSize);
+write_bin_long_long(out, SrcMtime);
+
+write_bin_int(out, Dict.size());
+
+for (i=0; i<(int) Dict.size(); ++i)  {
+
+   write_bin_int(out, Dict[i].size());
+
+   out.write(Dict[i].data(), Dict[i].size());
+
+}
+
+n = LineBlock.size();
+
+write_bin_int(out, n);
+
+out.write((const char *) LineBlock.data(), (streamsize) n*sizeof(int));
+out.write((const char *) LineNum.data(),   (streamsize) n*sizeof(int));
+
+write_bin_int(out, Blocks.size());
+
+for (i=0; i<(int) Blocks.size(); ++i)  {
+
+   const STATCacheBlock & b = Blocks[i];
+
+   write_bin_int(out, b.NCols);
+   write_bin_int(out, b.NHdr);
+   write_bin_int(out, b.NRows);
+
+   for (j=0; j<b.NHdr; ++j)  {
+
+      out.write((const char *) b.HdrCols[j].data(), (streamsize) b.NRows*sizeof(int));
+
+   }
+
+   for (j=0; j<(b.NCols - b.NHdr); ++j)  {
+
+      write_bin_long_long(out, b.ValCols[j].size());
+
+      out.write(b.ValCols[j].data(), b.ValCols[j].size());
+
+   }
+
+}
+
+return ( commit_sidecar(out, path, tmp_path) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for misc functions
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Read a non-negative count no larger than max_val
+   //
+
+bool read_count(ifstream & in, int & i, long long max_val)
+
+{
+
+if ( !read_bin_int(in, i) )  return ( false );
+
+if ( i < 0 || i > max_val )  return ( false );
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
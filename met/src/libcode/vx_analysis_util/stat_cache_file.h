@@ -0,0 +1,136 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __STAT_CACHE_FILE_H__
+#define  __STAT_CACHE_FILE_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <string>
+#include <vector>
+
+#include "vx_util.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Suffix of the binary cache file written alongside each STAT file.
+   //  The cache for "dir/file.stat" is named "dir/.file.stat.cache".
+   //
+
+static const char stat_cache_file_ext [] = ".cache";
+
+static const int  stat_cache_version     = 1;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Lines of one line type and width, stored column by column.
+   //  The header columns are dictionary encoded and the remaining
+   //  columns are kept as nul-terminated strings.
+   //
+
+struct STATCacheBlock {
+
+   int NCols;                                 //  number of columns
+   int NHdr;                                  //  number of dictionary encoded columns
+   int NRows;                                 //  number of lines
+
+   std::vector< std::vector<int> > HdrCols;   //  [col][row] dictionary index
+
+   std::vector< std::string > ValCols;        //  [col - NHdr] values
+
+   std::vector< std::vector<size_t> > ValOff; //  [col - NHdr][row] offset into ValCols
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Serves the lines of a STAT file from a binary cache of its
+   //  already parsed columns.  The cache is rebuilt from the STAT file
+   //  whenever the size or modification time of that file changes.
+   //
+
+class STATCacheFile : public LineDataFile {
+
+   private:
+
+      void init_from_scratch();
+
+      STATCacheFile(const STATCacheFile &);
+      STATCacheFile & operator=(const STATCacheFile &);
+
+      long long SrcSize;
+      long long SrcMtime;
+
+      std::vector<std::string> Dict;
+
+      std::vector<STATCacheBlock> Blocks;
+
+      std::vector<int> LineBlock;    //  block and row of each line
+      std::vector<int> LineRow;      //  in file order
+      std::vector<int> LineNum;
+
+      std::vector<const char *> Items;
+
+      int CurLine;
+
+      bool FromCache;
+
+      void clear_lines();
+
+      bool parse_stat_file(const char *);
+
+      bool read_cache(const char *);
+
+      bool write_cache(const char *) const;
+
+   public:
+
+      STATCacheFile();
+     ~STATCacheFile();
+
+      int open(const char *);
+
+      void close();   //  virtual from base class
+
+      int operator>>(DataLine &);   //  virtual from base class
+
+      bool from_cache() const;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+inline bool STATCacheFile::from_cache() const { return ( FromCache ); }
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __STAT_CACHE_FILE_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -1584,6 +1584,7 @@ void STATAnalysisJob::set_mask_sid(const char *c) {
         << "Station ID Mask: " << mask_sid_str << "\n";
 
    parse_sid_mask(mask_sid_str, mask_sid, mask_name);
+   mask_sid.set_hashed(true);
 
    // List the length of the station ID mask
    mlog << Debug(2)
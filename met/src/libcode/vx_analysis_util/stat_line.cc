@@ -241,7 +241,7 @@ int STATLine::read_line(LineDataFile * ldf)
 
 {
 
-int status, offset;
+int status;
 
 clear();
 
@@ -259,6 +259,47 @@ if ( !status || n_items() == 0 )  {
 
 }
 
+return ( set_type() );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int STATLine::set_items(const char * const * items, int n_items,
+                        LineDataFile * ldf, int line_number)
+
+{
+
+int status;
+
+clear();
+
+status = DataLine::set_items(items, n_items, ldf, line_number);
+
+if ( !status )  {
+
+   clear();
+
+   return ( 0 );
+
+}
+
+return ( set_type() );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int STATLine::set_type()
+
+{
+
+int offset;
+
 //
 // Check for a header line
 //
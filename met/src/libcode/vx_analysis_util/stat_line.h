@@ -40,6 +40,8 @@ class STATLine : public DataLine {
 
       void assign(const STATLine &);
 
+      int set_type();
+
    public:
 
       STATLine();
@@ -53,6 +55,9 @@ class STATLine : public DataLine {
 
       int read_line(LineDataFile *);   //  virtual from base class
 
+      int set_items(const char * const *, int,
+                    LineDataFile *, int);  //  virtual from base class
+
       bool is_ok() const;               //  virtual from base class
 
       bool is_header() const;           //  virtual from base class
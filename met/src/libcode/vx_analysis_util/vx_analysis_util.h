@@ -22,6 +22,7 @@
 #include "mode_job.h"
 #include "mode_line.h"
 #include "time_series.h"
+#include "stat_cache_file.h"
 #include "stat_job.h"
 #include "stat_line.h"
 
@@ -266,6 +266,33 @@ return;
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Reads the requests one at a time.  File types that can decode
+   //  several fields at once override this.
+   //
+
+int Met2dDataFile::data_plane_list(VarInfo ** vinfo, int n, DataPlane * dp, bool * status)
+
+{
+
+int j, n_found = 0;
+
+for (j=0; j<n; ++j)  {
+
+   status[j] = data_plane(*(vinfo[j]), dp[j]);
+
+   if ( status[j] )  ++n_found;
+
+}
+
+return ( n_found );
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -148,6 +148,12 @@ class Met2dDataFile : public Met2dData {
 
       virtual int data_plane_array(VarInfo &, DataPlaneArray &) = 0;
 
+         //  retrieve the first matching data plane for each of n
+         //  requests, setting the status of each and returning the
+         //  number found
+
+      virtual int data_plane_list(VarInfo **, int n, DataPlane *, bool *);
+
          //  retrieve the indexes of the first matching data plane
 
       virtual int index(VarInfo &) = 0;
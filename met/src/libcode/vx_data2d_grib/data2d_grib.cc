@@ -308,9 +308,13 @@ exit ( 1 );
 GF->seek_record(n);
 
    //
-   // read it into rec
+   // read it into rec, skipping the bitmap and data
+   // when only the header is needed
    //
-if ( ! ( (*GF) >> CurrentRecord) )  {
+int status = ( read_plane ? ((*GF) >> CurrentRecord)
+                          : GF->read_header(CurrentRecord) );
+
+if ( status <= 0 )  {
 
 mlog << Error << "\nMetGrib1DataFile::read_record() -> "
      << "trouble reading record number " << n << "\n\n";
@@ -322,7 +326,9 @@ return (false);
    //
    // put the current record into the plane
    //
-if( read_plane ) get_data_plane(CurrentRecord, Plane);
+if ( !read_plane )  return (true);
+
+get_data_plane(CurrentRecord, Plane);
 
 if ( ShiftRight != 0 )  Plane.shift_right(ShiftRight);
 
@@ -359,7 +365,7 @@ j_match = -1;
 
 for (j=0; j<(GF->n_records()); ++j)  {
 
-   if ( ! read_record(j) )  {
+   if ( ! read_record(j, false) )  {
 
       mlog << Error << "\nMetGrib1DataFile::read_record(const VarInfoGrib &) -> trouble reading record!\n\n";
 
@@ -494,13 +500,17 @@ int MetGrib1DataFile::data_plane_array(VarInfo &vinfo,
    // Loop through the records in the GRIB file looking for matches
    for(i=0; i<GF->n_records(); i++) {
 
-      // Read the current record
+      // Read the header of the current record
       GF->seek_record(i);
-      (*GF) >> r;
+      GF->read_header(r);
 
       // Check for a range match
       if(is_range_match(*vinfo_grib, r)) {
 
+         // Read the bitmap and data of the matching record
+         GF->seek_record(i);
+         (*GF) >> r;
+
          exact = is_exact_match(*vinfo_grib, r);
          mlog << Debug(3) << "MetGrib1DataFile::data_plane_array() -> "
               << "Found " << ( exact ? "exact" : "range" )
@@ -696,13 +706,17 @@ bool MetGrib1DataFile::data_plane_scalar(VarInfoGrib &vinfo_grib,
    // Loop through the records in the GRIB file looking for a match
    for(i=0; i<GF->n_records(); i++) {
 
-      // Read the current record.
+      // Read the header of the current record.
       GF->seek_record(i);
-      (*GF) >> r;
+      GF->read_header(r);
 
       // Check for an exact match
       if(is_exact_match(vinfo_grib, r)) {
 
+         // Read the bitmap and data of the matching record.
+         GF->seek_record(i);
+         (*GF) >> r;
+
          mlog << Debug(3) << "MetGrib1DataFile::data_plane_scalar() -> "
               << "Found exact match for VarInfo \""
               << vinfo_grib.magic_str() << "\" in GRIB record "
@@ -498,7 +498,7 @@ bool get_data_plane(const GribRecord & r, DataPlane & plane)
 
 {
 
-int j;
+int j, n;
 int x, y;
 int count;
 double value;
@@ -508,10 +508,32 @@ const int nxy = nx*ny;
 const bool has_bms = r.bms_flag;
 unixtime init_ut, valid_ut;
 int bms_flag, accum;
+vector<double> values;
 
 
 plane.set_size(nx, ny);
 
+   //
+   //  unpack the packed values all at once, then
+   //  place them on the grid, honoring the bitmap
+   //
+
+if ( has_bms )  {
+
+   for (j=0,n=0; j<nxy; ++j)  if ( r.bms_bit(j) )  ++n;
+
+} else {
+
+   n = nxy;
+
+}
+
+values.resize(n);
+
+r.unpack_data(values.data(), n);
+
+vector<dataplane_t> & buf = plane.buf();
+
 count = 0;
 
 for (j=0; j<nxy; ++j)  {
@@ -520,16 +542,16 @@ for (j=0; j<nxy; ++j)  {
 
    if ( has_bms )  {
 
-      if ( r.bms_bit(j) )  value = r.data_value(count++);
+      if ( r.bms_bit(j) )  value = values[count++];
       else                 value = bad_data_double;
 
    } else {
 
-      value = r.data_value(j);
+      value = values[j];
 
    }
 
-   plane.set(value, x, y);
+   buf[y*nx + x] = (dataplane_t) value;
 
 }   //  for j
 
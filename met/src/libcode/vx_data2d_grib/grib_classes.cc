@@ -19,6 +19,7 @@ using namespace std;
 #include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <cmath>
 
@@ -47,6 +48,19 @@ static int calc_lead_time(Section1_Header *);
 static void ibm_to_ieee(const uint4 *, uint4 *);
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Index file layout, all values in native byte order:
+   //
+   //     magic, byte order mark, version, GRIB1 file size and mtime,
+   //     record count, then the offset and grib code of each record
+   //
+
+static const char grib1_index_magic [] = "METG1IDX";
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -383,6 +397,86 @@ return ( y );
 ////////////////////////////////////////////////////////////////////////
 
 
+void GribRecord::unpack_data(double *values, int n) const
+
+{
+
+   //
+   //  Unpacks the first n data values in one pass, rather than one
+   //  data_value() call per point.  The byte aligned word sizes get
+   //  their own loops, and the rest are read through a bit buffer.
+   //  Values past the end of the data section are set to the
+   //  reference value.
+   //
+
+int j, k, n_bits, n_avail;
+uint4 u;
+unsigned long long bits;
+const unsigned char *c = data.data();
+
+if ( n <= 0 )  return;
+
+if ( word_size <= 0 )  n_avail = 0;
+else                   n_avail = (int) ((8*((long long) data.size()))/word_size);
+
+n_avail = min(n, n_avail);
+
+switch ( word_size )  {
+
+   case 8:
+      for (j=0; j<n_avail; ++j)  {
+         values[j] = m_value*c[j] + b_value;
+      }
+      break;
+
+   case 16:
+      for (j=0; j<n_avail; ++j, c+=2)  {
+         u = (((uint4) c[0]) << 8) | c[1];
+         values[j] = m_value*u + b_value;
+      }
+      break;
+
+   case 24:
+      for (j=0; j<n_avail; ++j, c+=3)  {
+         u = (((uint4) c[0]) << 16) | (((uint4) c[1]) << 8) | c[2];
+         values[j] = m_value*u + b_value;
+      }
+      break;
+
+   case 32:
+      for (j=0; j<n_avail; ++j, c+=4)  {
+         u = (((uint4) c[0]) << 24) | (((uint4) c[1]) << 16) |
+             (((uint4) c[2]) <<  8) | c[3];
+         values[j] = m_value*u + b_value;
+      }
+      break;
+
+   default:
+      bits = 0;
+      n_bits = k = 0;
+      for (j=0; j<n_avail; ++j)  {
+         while ( n_bits < word_size )  {
+            bits = (bits << 8) | c[k++];
+            n_bits += 8;
+         }
+         n_bits -= word_size;
+         u = (uint4) ((bits >> n_bits) & mask);
+         values[j] = m_value*u + b_value;
+      }
+      break;
+
+}   //  switch
+
+for (j=n_avail; j<n; ++j)  values[j] = b_value;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 void GribRecord::reset()
 
 {
@@ -535,6 +629,10 @@ referenceCount = buf_size = n_alloc = n_records = issue = lead = 0;
 
 buf = (unsigned char *) 0;
 
+map = (unsigned char *) 0;
+
+map_size = map_pos = (off_t) 0;
+
 record_info = (RecordInfo *) 0;
 
 }
@@ -547,6 +645,8 @@ GribFileRep::~GribFileRep()
 
 {
 
+if ( map )  { munmap(map, map_size);  map = (unsigned char *) 0; }
+
 if ( fd >= 0 )  { ::close(fd);  fd = -1; }
 
 if ( buf )  { delete [] buf;  buf = (unsigned char *) 0; }
@@ -735,12 +835,74 @@ if ( !(rep->buf = new unsigned char [default_gribfile_buf_size]) )  {
 
 rep->buf_size = default_gribfile_buf_size;
 
+   //
+   //  Map the file into memory, when possible, so that records are
+   //  parsed in place rather than read into the buffer
+   //
+
+struct stat sbuf;
+long long src_size = -1, src_mtime = -1;
+void *p = (void *) 0;
+
+if ( fstat(rep->fd, &sbuf) == 0 )  {
+
+   src_size  = (long long) sbuf.st_size;
+   src_mtime = (long long) sbuf.st_mtime;
+
+   if ( sbuf.st_size > 0 )  {
+
+      p = mmap(0, sbuf.st_size, PROT_READ, MAP_PRIVATE, rep->fd, 0);
+
+      if ( p != MAP_FAILED )  {
+         rep->map      = (unsigned char *) p;
+         rep->map_size = sbuf.st_size;
+      }
+
+   }
+
+}
+
 if(!skip_header()) return ( false );
 
-index_records();
+   //
+   //  Use the index file, when it matches the size and modification
+   //  time of this file, rather than walking all of the records
+   //
+
+ConcatString index_path;
+
+if ( src_size > 0 )  index_path = sidecar_file_name(filename, grib1_index_file_ext,
+                                                      met_grib1_index_dir_env);
+
+if ( index_path.nonempty() &&
+     read_index(index_path.c_str(), src_size, src_mtime) )  {
+
+   mlog << Debug(4) << "GribFile::open() -> "
+        << "read GRIB1 index file \"" << index_path << "\"\n";
+
+} else {
+
+   index_records();
+
+   if ( index_path.nonempty() && rep->n_records > 0 )  {
+
+      if ( write_index(index_path.c_str(), src_size, src_mtime) )  {
+         mlog << Debug(4) << "GribFile::open() -> "
+              << "wrote GRIB1 index file \"" << index_path << "\"\n";
+      } else {
+         mlog << Debug(3) << "GribFile::open() -> "
+              << "unable to write GRIB1 index file \""
+              << index_path << "\"\n";
+      }
+
+   }
+
+}
 
 lseek(rep->fd, rep->file_start, SEEK_SET);
 
+rep->map_pos = rep->file_start;
+
 return ( true );
 
 }
@@ -813,12 +975,30 @@ return ( 0 );
 ////////////////////////////////////////////////////////////////////////
 
 
-int GribFile::read_record(GribRecord & g)
+int GribFile::read_header(GribRecord &g)
+
+{
+
+int j = read_record(g, false);
+
+if ( j < 0 )  return ( -1 );
+
+if ( j > 0 )  return ( 1 );
+
+return ( 0 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int GribFile::read_record(GribRecord & g, bool read_data)
 
 {
 
 size_t len, bytes, n_read, s;
-int j;
+int j, lo, hi;
 int m, d, y, hh, mm;
 int D, E;
 off_t file_pos;
@@ -827,27 +1007,51 @@ unsigned char *c = (unsigned char *) 0, c3[3];
 double t;
 float r[4];
 uint4 ibm;
+const unsigned char *rec_buf = (const unsigned char *) 0;
 
 
 g.reset();
 
-file_pos = find_magic_cookie(rep->fd);
+if ( rep->map )  {
+
+   file_pos = find_record(rep->map_pos);
+
+   if ( (file_pos < 0) || ((file_pos + 8) > rep->map_size) )  return ( 0 );
+
+   rec_buf = rep->map + file_pos;
+
+} else {
+
+   file_pos = find_magic_cookie(rep->fd);
+
+   lseek(rep->fd, file_pos, SEEK_SET);
 
-lseek(rep->fd, file_pos, SEEK_SET);
+}
 
 bytes_processed = 0;
 
    //
-   //  Infer the record number by the current file position
+   //  Infer the record number by the current file position,
+   //  using a binary search of the increasing record offsets
    //
 
-for (g.rec_num=0,j=0; j<(rep->n_records); ++j)  {
+g.rec_num = 0;
+
+lo = 0;
+hi = (int) (rep->n_records) - 1;
 
-   if ( file_pos == rep->record_info[j].lseek_offset )  {
+while ( lo <= hi )  {
+
+   j = (lo + hi)/2;
+
+   if ( rep->record_info[j].lseek_offset == file_pos )  {
       g.rec_num = j+1;
       break;
    }
 
+   if ( rep->record_info[j].lseek_offset < file_pos )  lo = j + 1;
+   else                                                hi = j - 1;
+
 }
 
    //
@@ -859,15 +1063,23 @@ g.Sec0_offset_in_record = bytes_processed;
 
 bytes = sizeof(Section0_Header);
 
-if ( (n_read = read(rep->buf, bytes)) == 0 ) return ( 0 );
+if ( rep->map )  {
 
-memcpy(g.is, rep->buf, 8);
+   memcpy(g.is, rec_buf, 8);
 
-if ( (n_read < 0) || (n_read != bytes) )  {
+} else {
+
+   if ( (n_read = read(rep->buf, bytes)) == 0 ) return ( 0 );
+
+   memcpy(g.is, rep->buf, 8);
 
-   mlog << Error << "\nGribFile::read_record() -> error reading section 0 header ... nread = " << n_read << "\n\n";
+   if ( (n_read < 0) || (n_read != bytes) )  {
 
-   return ( -1 );
+      mlog << Error << "\nGribFile::read_record() -> error reading section 0 header ... nread = " << n_read << "\n\n";
+
+      return ( -1 );
+
+   }
 
 }
 
@@ -889,8 +1101,6 @@ s = char3_to_int(g.is->length);
 
 g.record_lseek_offset = file_pos;
 
-if ( s > (rep->buf_size) )  rep->realloc_buf(s);
-
 // if ( s > (rep->buf_size) )  {
 // 
 //    mlog << Error << "\nGribFile::read_record(GribRecord &) -> "
@@ -907,9 +1117,31 @@ if ( s > (rep->buf_size) )  rep->realloc_buf(s);
 
 // }
 
-if ( read(8, s - 8) == 0 )  return ( 0 );
+if ( rep->map )  {
+
+   if ( (s < 8) || ((file_pos + (off_t) s) > rep->map_size) )  {
+
+      mlog << Error << "\nGribFile::read_record(GribRecord &) -> "
+           << "grib record of " << s << " bytes at file offset "
+           << file_pos << " runs past the end of the file\n\n";
+
+      return ( 0 );
+
+   }
+
+   rep->map_pos = file_pos + s;
+
+} else {
+
+   if ( s > (rep->buf_size) )  rep->realloc_buf(s);
+
+   if ( read(8, s - 8) == 0 )  return ( 0 );
+
+   rec_buf = rep->buf;
+
+}
 
-if ( strncmp((char *) (rep->buf + (s - 4)), "7777", 4) != 0 )  {
+if ( strncmp((const char *) (rec_buf + (s - 4)), "7777", 4) != 0 )  {
 
    mlog << Error << "\nGribFile::read_record(GribRecord &) -> trailing \"7777\" not found in grib record\n\n";
 
@@ -930,14 +1162,14 @@ g.Sec1_offset_in_record = bytes_processed;
    //
    //  Extract the PDS length
    //
-c3[0] = *(rep->buf + bytes_processed);
-c3[1] = *(rep->buf + bytes_processed + 1);
-c3[2] = *(rep->buf + bytes_processed + 2);
+c3[0] = *(rec_buf + bytes_processed);
+c3[1] = *(rec_buf + bytes_processed + 1);
+c3[2] = *(rec_buf + bytes_processed + 2);
 len = char3_to_int(c3);
 
 g.pds = new unsigned char [len];
 
-memcpy(g.pds, rep->buf + bytes_processed, sizeof(unsigned char)*len);
+memcpy(g.pds, rec_buf + bytes_processed, sizeof(unsigned char)*len);
 
 Section1_Header *pds_ptr = (Section1_Header *) g.pds;
 
@@ -982,7 +1214,7 @@ if ( (pds_ptr->flag) & 128 )  {
 //
 //  ????? Need to change this?????
 //
-   memcpy(g.gds, rep->buf + bytes_processed, sizeof(Section2_Header));
+   memcpy(g.gds, rec_buf + bytes_processed, sizeof(Section2_Header));
 
    g.nx = char2_to_int(g.gds->nx);
    g.ny = char2_to_int(g.gds->ny);
@@ -1008,15 +1240,17 @@ if ( pds_ptr->flag & 64 )  {
 
    g.bms_flag = 1;
 
-   memcpy(g.bms, rep->buf + bytes_processed, sizeof(Section3_Header));
+   memcpy(g.bms, rec_buf + bytes_processed, sizeof(Section3_Header));
 
    s = char3_to_int(g.bms->length) - 6;
 
-   g.extend_bitmap(s);
+   if ( read_data )  {
+      g.extend_bitmap(s);
 
-   g.bitmap.clear();
-   unsigned char *begin = rep->buf + bytes_processed + 6;
-   g.bitmap.assign(begin, begin+s);
+      g.bitmap.clear();
+      const unsigned char *begin = rec_buf + bytes_processed + 6;
+      g.bitmap.assign(begin, begin+s);
+   }
    
    // mlog << Debug(1) << "\n\n  reading " << s << " bytes into bitmap at file location " << (bytes_processed + 6) << "\n\n";
 
@@ -1035,7 +1269,7 @@ if ( pds_ptr->flag & 64 )  {
 g.Sec4_offset_in_file   = file_pos + bytes_processed;
 g.Sec4_offset_in_record = bytes_processed;
 
-memcpy(g.bds, rep->buf + bytes_processed, sizeof(Section4_Header));
+memcpy(g.bds, rec_buf + bytes_processed, sizeof(Section4_Header));
 
 c = (unsigned char *) (&E);
 E = 0;
@@ -1113,11 +1347,13 @@ g.data_lseek_offset = (long) (g.record_lseek_offset + bytes_processed + 11);
 
 bytes = char3_to_int(g.bds->length) - 11;
 
-g.extend_data(bytes);
-g.data.clear();
+if ( read_data )  {
+   g.extend_data(bytes);
+   g.data.clear();
 
-unsigned char *begin = rep->buf + bytes_processed + 11;
-g.data.assign(begin, begin+bytes);
+   const unsigned char *begin = rec_buf + bytes_processed + 11;
+   g.data.assign(begin, begin+bytes);
+}
 
 g.mask = 0L;
 
@@ -1211,7 +1447,7 @@ rep->record_extend(1);
 
 rep->n_records = 0;
 
-while ( read_record(*g) )  {
+while ( read_header(*g) > 0 )  {
 
    rep->record_info[rep->n_records].lseek_offset = g->record_lseek_offset;
 
@@ -1233,6 +1469,125 @@ delete g;
 ////////////////////////////////////////////////////////////////////////
 
 
+bool GribFile::read_index(const char *path, long long src_size, long long src_mtime)
+
+{
+
+ifstream in;
+long long size, mtime, offset;
+int j, n, code;
+
+in.open(path, ios::in | ios::binary);
+
+if ( !in )  return ( false );
+
+if ( !read_sidecar_header(in, grib1_index_magic, grib1_index_version) ||
+     !read_bin_long_long(in, size)   || size    != src_size            ||
+     !read_bin_long_long(in, mtime)  || mtime   != src_mtime           ||
+     !read_bin_int(in, n)            || n < 1                          ||
+     n > src_size )  return ( false );
+
+rep->n_records = 0;
+
+rep->record_extend(n);
+
+   //
+   //  the offsets must be increasing and within the file
+   //
+
+for (j=0; j<n; ++j)  {
+
+   if ( !read_bin_long_long(in, offset) || !read_bin_int(in, code) ||
+        offset < rep->file_start || offset >= src_size     ||
+        (j > 0 && offset <= rep->record_info[j - 1].lseek_offset) )  {
+
+      return ( false );
+
+   }
+
+   rep->record_info[j].lseek_offset = (off_t) offset;
+   rep->record_info[j].gribcode     = code;
+
+}
+
+in.close();
+
+rep->n_records = n;
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool GribFile::write_index(const char *path, long long src_size, long long src_mtime) const
+
+{
+
+ofstream out;
+ConcatString tmp_path;
+int j;
+
+if ( !open_sidecar(out, path, tmp_path) )  return ( false );
+
+write_sidecar_header(out, grib1_index_magic, grib1_index_version);
+
+write_bin_long_long (out, src_size);
+write_bin_long_long (out, src_mtime);
+write_bin_int       (out, rep->n_records);
+
+for (j=0; j<(int) (rep->n_records); ++j)  {
+
+   write_bin_long_long (out, rep->record_info[j].lseek_offset);
+   write_bin_int       (out, rep->record_info[j].gribcode);
+
+}
+
+return ( commit_sidecar(out, path, tmp_path) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Search the mapped file for the next "GRIB" magic cookie
+   //  at or after the given offset
+   //
+
+
+off_t GribFile::find_record(off_t pos)
+
+{
+
+const unsigned char *c = rep->map;
+const unsigned char *p = (const unsigned char *) 0;
+
+while ( (pos + 4) <= rep->map_size )  {
+
+   p = (const unsigned char *) memchr(c + pos, 'G', rep->map_size - pos - 3);
+
+   if ( !p )  return ( -1 );
+
+   pos = p - c;
+
+   if ( (p[1] == 'R') && (p[2] == 'I') && (p[3] == 'B') )  return ( pos );
+
+   ++pos;
+
+}
+
+return ( -1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 size_t GribFile::read()
 
 {
@@ -1479,6 +1834,8 @@ if ( (n < 0) || (n >= (rep->n_records)) )  {
 
 lseek(rep->fd, rep->record_info[n].lseek_offset, SEEK_SET);
 
+rep->map_pos = rep->record_info[n].lseek_offset;
+
 return;
 
 }
@@ -102,6 +102,23 @@ inline GribError::GribError(int ErrType, int LineNo, const char *FileName, const
 static const int default_gribfile_buf_size = (1 << 10);
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The record offsets of each GRIB1 file are saved to an index file
+   //  that is read instead of walking the GRIB1 file on later opens.
+   //  The index for "dir/file.grb" is "dir/.file.grb.g1idx", or is
+   //  kept in the directory named by MET_GRIB1_INDEX_DIR, when set.
+   //
+
+static const char met_grib1_index_dir_env [] = "MET_GRIB1_INDEX_DIR";
+
+static const char grib1_index_file_ext [] = ".g1idx";
+
+static const int  grib1_index_version     = 1;
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -412,6 +429,8 @@ class GribRecord  {
       uint4  long_data_value (int n) const;
       double data_value      (int n) const;
 
+      void   unpack_data     (double *, int n) const;   //  first n data values
+
       uint4  long_data_value (int x, int y) const;
       double data_value      (int x, int y) const;
 
@@ -469,6 +488,15 @@ class GribFileRep {
       unsigned char * buf;
       size_t buf_size;
 
+         //
+         //  whole file mapped into memory, when possible,
+         //  and the current read position in it
+         //
+
+      unsigned char * map;
+      off_t map_size;
+      off_t map_pos;
+
       unsigned int n_records;
       int n_alloc;
 
@@ -516,13 +544,25 @@ class GribFile {
 
       virtual int operator>>(GribRecord &);
 
+         //
+         //  read the next record without its bitmap and data
+         //
+
+      virtual int read_header(GribRecord &);
+
    protected:
 
       int skip_header();
 
       void index_records();
 
-      int read_record(GribRecord &);
+      bool read_index(const char *, long long size, long long mtime);
+
+      bool write_index(const char *, long long size, long long mtime) const;
+
+      int read_record(GribRecord &, bool read_data = true);
+
+      off_t find_record(off_t);
 
    protected:
 
@@ -12,6 +12,9 @@
 using namespace std;
 
 #include <iostream>
+#include <fstream>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -24,12 +27,15 @@ using namespace std;
 #include <utility>
 #include <limits>
 #include <list>
+#include <algorithm>
+#include <set>
 
 #include "data2d_grib2.h"
 #include "grib_strings.h"
 #include "vx_data2d.h"
 #include "vx_math.h"
 #include "vx_log.h"
+#include "thread_util.h"
 
 extern "C" {
   #include "grib2.h"
@@ -42,6 +48,57 @@ using namespace std;
 
 double scaled2dbl(int scale_factor, int scale_value);
 
+static long long parm_key(int discipline, int parm_cat, int parm);
+
+////////////////////////////////////////////////////////////////////////
+//
+// Index file layout, all values in native byte order:
+//
+//    magic, byte order mark, version, GRIB2 file size and mtime
+//    records:  count, then the fields of each Grib2Record except for
+//              the parameter name, which is looked up again on read
+//              in case the GRIB2 tables in use have changed
+//
+////////////////////////////////////////////////////////////////////////
+
+static const char grib2_index_magic [] = "METG2IDX";
+
+////////////////////////////////////////////////////////////////////////
+//
+// Raw GRIB2 message read from the file and the field decoded from it.
+// The messages are read serially and then decoded concurrently, except
+// for JPEG2000 and PNG packed fields.  Those are unpacked by JasPer and
+// libpng, which are not known to be thread safe as g2clib calls them, so
+// they are decoded one at a time by the calling thread as before.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct Grib2DecodeTask {
+   vector<unsigned char> Msg;
+   int FieldNum;
+   bool Serial;
+   DataPlane Plane;
+   int BitmapFlag;
+   int NMiss;
+   float VMiss[2];
+   bool Status;
+};
+
+struct Grib2DecodeInfo {
+   vector<Grib2DecodeTask> *Tasks;
+   int Nx;
+   int Ny;
+   int ScanMode;
+};
+
+static bool is_supported_scan_mode(int scan_mode);
+
+static bool is_serial_drs(const vector<unsigned char> &msg, int field_num);
+
+static void decode_grib2_message(Grib2DecodeTask &task, int n_x, int n_y, int scan_mode);
+
+static void decode_grib2_task(void *, int i_thread, int i_beg, int i_end);
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Code for class MetGrib2DataFile
@@ -97,6 +154,9 @@ void MetGrib2DataFile::grib2_init_from_scratch() {
 void MetGrib2DataFile::close() {
    fclose(FileGrib2);
 
+   PlaneCache.clear();
+   PlaneBatch.clear();
+
    return;
 }
 
@@ -110,7 +170,45 @@ bool MetGrib2DataFile::open(const char * _filename) {
       exit(1);
    }
 
-   if( 1 > RecList.size() ) read_grib2_record_list();
+   if( 1 > RecList.size() ){
+
+      //  the size and modification time of the GRIB2 file identify
+      //  the index contents
+      struct stat sbuf;
+      ConcatString index_path;
+      long long src_size = -1, src_mtime = -1;
+
+      if( 0 == stat(Filename.c_str(), &sbuf) ){
+         src_size   = (long long) sbuf.st_size;
+         src_mtime  = (long long) sbuf.st_mtime;
+         index_path = sidecar_file_name(Filename.c_str(), grib2_index_file_ext,
+                                         met_grib2_index_dir_env);
+      }
+
+      if( index_path.nonempty() &&
+          read_grib2_index(index_path.c_str(), src_size, src_mtime) ){
+
+         mlog << Debug(4) << "MetGrib2DataFile::open() -> "
+              << "read GRIB2 index file \"" << index_path << "\"\n";
+
+      } else {
+
+         read_grib2_record_list();
+
+         if( index_path.nonempty() && 0 < RecList.size() ){
+            if( write_grib2_index(index_path.c_str(), src_size, src_mtime) ){
+               mlog << Debug(4) << "MetGrib2DataFile::open() -> "
+                    << "wrote GRIB2 index file \"" << index_path << "\"\n";
+            } else {
+               mlog << Debug(3) << "MetGrib2DataFile::open() -> "
+                    << "unable to write GRIB2 index file \""
+                    << index_path << "\"\n";
+            }
+         }
+      }
+
+      build_record_lookup();
+   }
 
    bool status = ( 0 < RecList.size() );
    if( !status ){
@@ -360,6 +458,61 @@ int MetGrib2DataFile::data_plane_array( VarInfo &vinfo,
 
 ////////////////////////////////////////////////////////////////////////
 
+int MetGrib2DataFile::data_plane_list(VarInfo **vinfo, int n,
+                                      DataPlane *planes, bool *status) {
+
+   //  find the records needed for the requests, including the U/V
+   //  wind pairs used for rotation, that haven't been decoded yet
+   vector<Grib2Record*> listMatch, listMatchRange, listDecode;
+   set<int> setDecode;
+   ConcatString pair_mag;
+
+   for(int i=0; i < n; i++){
+
+      VarInfoGrib2* vinfo_g2 = (VarInfoGrib2*)(vinfo[i]);
+      find_record_matches(vinfo_g2, listMatch, listMatchRange);
+      if( 1 > listMatch.size() ) continue;
+
+      Grib2Record *listRec[2];
+      listRec[0] = listMatch[0];
+      listRec[1] = find_uv_pair(vinfo_g2, listMatch[0], pair_mag);
+
+      for(int j=0; j < 2; j++){
+         if( !listRec[j] || 0 < setDecode.count(listRec[j]->Index) ) continue;
+
+         bool cached = false;
+         for( list< pair<int, DataPlane> >::iterator it = PlaneCache.begin();
+              it != PlaneCache.end();
+              it++ ){
+            if( it->first == listRec[j]->Index ){ cached = true; break; }
+         }
+         if( cached ) continue;
+
+         setDecode.insert(listRec[j]->Index);
+         listDecode.push_back(listRec[j]);
+      }
+   }
+
+   //  decode them up front and then handle each request as usual
+   if( 0 < listDecode.size() ){
+
+      vector<DataPlane> listPlane;
+      decode_grib2_records(listDecode, listPlane);
+
+      for(size_t j=0; j < listDecode.size(); j++){
+         PlaneBatch[listDecode[j]->Index] = listPlane[j];
+      }
+   }
+
+   int n_found = Met2dDataFile::data_plane_list(vinfo, n, planes, status);
+
+   PlaneBatch.clear();
+
+   return n_found;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void MetGrib2DataFile::find_record_matches( VarInfoGrib2* vinfo,
                                             vector<Grib2Record*> &listMatchExact,
                                             vector<Grib2Record*> &listMatchRange
@@ -409,10 +562,30 @@ void MetGrib2DataFile::find_record_matches( VarInfoGrib2* vinfo,
       }
    }
 
-   //  check each record for a match against the VarInfo
-   for( vector<Grib2Record*>::iterator it = RecList.begin();
-        it < RecList.end();
-        it++ ) {
+   //  gather the records matching the record number, parameter
+   //  indexes or name, in file order, so only those are tested
+   vector<int> listCand;
+   unordered_map<int, vector<int> >::const_iterator       it_num;
+   unordered_map<long long, vector<int> >::const_iterator it_parm;
+   unordered_map<string, vector<int> >::const_iterator    it_name;
+
+   it_num  = RecNumLookup.find(vinfo->record());
+   it_parm = ParmLookup.find(parm_key(vinfo->discipline(), vinfo->parm_cat(), vinfo->parm()));
+   it_name = NameLookup.find(vinfo->name().text());
+
+   if( it_num  != RecNumLookup.end() ) listCand.insert(listCand.end(), it_num->second.begin(),  it_num->second.end());
+   if( it_parm != ParmLookup.end()   ) listCand.insert(listCand.end(), it_parm->second.begin(), it_parm->second.end());
+   if( it_name != NameLookup.end()   ) listCand.insert(listCand.end(), it_name->second.begin(), it_name->second.end());
+
+   sort(listCand.begin(), listCand.end());
+   listCand.erase(unique(listCand.begin(), listCand.end()), listCand.end());
+
+   //  check each candidate record for a match against the VarInfo
+   for( vector<int>::iterator it_cand = listCand.begin();
+        it_cand < listCand.end();
+        it_cand++ ) {
+
+      vector<Grib2Record*>::iterator it = RecList.begin() + *it_cand;
 
       bool rec_match_ex = false;
       bool rec_match_rn = false;
@@ -562,37 +735,55 @@ void MetGrib2DataFile::find_record_matches( VarInfoGrib2* vinfo,
       if( rec_match_ex )                 listMatchExact.push_back(*it);
       if( rec_match_ex || rec_match_rn ) listMatchRange.push_back(*it);
 
-   }  //  END:  for( vector<Grib2Record*>::iterator it = RecList.begin(); ...)
+   }  //  END:  for( vector<int>::iterator it_cand = listCand.begin(); ...)
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-DataPlane MetGrib2DataFile::check_uv_rotation(VarInfoGrib2 *vinfo, Grib2Record *rec, DataPlane plane){
+Grib2Record * MetGrib2DataFile::find_uv_pair(VarInfoGrib2 *vinfo, Grib2Record *rec,
+                                             ConcatString &pair_mag){
+
+   pair_mag.clear();
 
    //  check that the field is present in the pair map
    string parm_name = vinfo->name().text();
    if( 0 == PairMap.count( parm_name ) ||
        0 == (rec->ResCompFlag & 8) ) {
-      return plane;
+      return (Grib2Record *) 0;
    }
 
    //  build the magic string of the pair field, and check it
-   ConcatString pair_mag = build_magic( rec );
+   pair_mag = build_magic( rec );
    pair_mag.replace(parm_name.data(), PairMap[parm_name].data());
    if( 0 == NameRecMap.count( string(pair_mag.text()) ) ){
-      mlog << Debug(3) << "MetGrib2DataFile::check_uv_rotation -> "
-           << "UV rotation pair record not found: '" << pair_mag
-           << "'\n";
+      return (Grib2Record *) 0;
+   }
+
+   return NameRecMap[pair_mag.text()];
+}
+
+////////////////////////////////////////////////////////////////////////
+
+DataPlane MetGrib2DataFile::check_uv_rotation(VarInfoGrib2 *vinfo, Grib2Record *rec, DataPlane plane){
+
+   //  find the pair record, if the field needs to be rotated
+   string parm_name = vinfo->name().text();
+   ConcatString pair_mag;
+   Grib2Record *rec_pair = find_uv_pair(vinfo, rec, pair_mag);
+   if( !rec_pair ){
+      if( pair_mag.nonempty() ){
+         mlog << Debug(3) << "MetGrib2DataFile::check_uv_rotation -> "
+              << "UV rotation pair record not found: '" << pair_mag
+              << "'\n";
+      }
       return plane;
    }
 
    //  read the data plane for the pair record
-   Grib2Record *rec_pair = NameRecMap[pair_mag.text()];
    DataPlane plane_pair;
-   read_grib2_record_data_plane(NameRecMap[pair_mag.text()],
-                                plane_pair);
+   read_grib2_record_data_plane(rec_pair, plane_pair);
 
    mlog << Debug(3) << "MetGrib2DataFile::check_uv_rotation() -> "
         << "Found pair match \"" << pair_mag << "\" in GRIB2 record "
@@ -720,6 +911,9 @@ void MetGrib2DataFile::read_grib2_record_list() {
          rec->ParmCat      = gfld->ipdtmpl[0];
          rec->Parm         = gfld->ipdtmpl[1];
          rec->Process      = gfld->ipdtmpl[2];
+         rec->Center       = gfld->idsect[0];
+         rec->MasterTable  = gfld->idsect[2];
+         rec->LocalTable   = gfld->idsect[3];
 
          //  get the level type
          if( gfld->ipdtnum == 46 ) {
@@ -893,30 +1087,12 @@ void MetGrib2DataFile::read_grib2_record_list() {
          double sec_accum_unit = VarInfoGrib2::g2_time_range_unit_to_sec( range_typ );
          rec->Accum = range_val * (int)sec_accum_unit;
 
-         //  build the parameter "name"
-         ConcatString id;
-         id << rec->Discipline << "_" << rec->ParmCat << "_" << rec->Parm;
-
-         //  use the index to look up the parameter name
-         Grib2TableEntry tab;
-         if( !GribTable.lookup_grib2(rec->Discipline, rec->ParmCat, rec->Parm,
-                                     gfld->idsect[2], gfld->idsect[0], gfld->idsect[3], tab) ){
-            mlog << Debug(4) << "MetGrib2DataFile::read_grib2_record_list() - unrecognized GRIB2 "
-                 << "field indexes - disc: " << rec->Discipline << ", master table: " << gfld->idsect[2]
-                 << ", center: " << gfld->idsect[0] << ", local table: " << gfld->idsect[3]
-                 << ", parm_cat: " << rec->ParmCat << ", parm: " << rec->Parm << "\n";
-            rec->ParmName = str_format("DISC%d_CAT%d_PARM%d", rec->Discipline, rec->ParmCat, rec->Parm);
-         } else {
-            rec->ParmName = tab.parm_name.text();
-         }
+         //  look up the parameter name
+         set_grib2_parm_name(rec);
 
          //  add the record to the list
          RecList.push_back(rec);
 
-         //  build data structure for U/V wind pairs
-         string rec_mag = build_magic(rec).text();
-         NameRecMap[rec_mag] = rec;
-
          g2_free(gfld);
 
          //  if there are more fields in the current record, read the next one
@@ -935,6 +1111,206 @@ void MetGrib2DataFile::read_grib2_record_list() {
 
 ////////////////////////////////////////////////////////////////////////
 
+void MetGrib2DataFile::set_grib2_parm_name(Grib2Record *rec) {
+
+   //  use the index to look up the parameter name
+   Grib2TableEntry tab;
+   if( !GribTable.lookup_grib2(rec->Discipline, rec->ParmCat, rec->Parm,
+                               rec->MasterTable, rec->Center, rec->LocalTable, tab) ){
+      mlog << Debug(4) << "MetGrib2DataFile::read_grib2_record_list() - unrecognized GRIB2 "
+           << "field indexes - disc: " << rec->Discipline << ", master table: " << rec->MasterTable
+           << ", center: " << rec->Center << ", local table: " << rec->LocalTable
+           << ", parm_cat: " << rec->ParmCat << ", parm: " << rec->Parm << "\n";
+      rec->ParmName = str_format("DISC%d_CAT%d_PARM%d", rec->Discipline, rec->ParmCat, rec->Parm);
+   } else {
+      rec->ParmName = tab.parm_name.text();
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::build_record_lookup() {
+
+   NameRecMap.clear();
+   RecNumLookup.clear();
+   ParmLookup.clear();
+   NameLookup.clear();
+
+   for(int i=0; i < (int) RecList.size(); i++){
+      Grib2Record *rec = RecList[i];
+
+      //  build data structure for U/V wind pairs
+      string rec_mag = build_magic(rec).text();
+      NameRecMap[rec_mag] = rec;
+
+      //  build the lookup tables used to find matching records
+      RecNumLookup[rec->RecNum].push_back(i);
+      ParmLookup[parm_key(rec->Discipline, rec->ParmCat, rec->Parm)].push_back(i);
+      NameLookup[rec->ParmName].push_back(i);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool MetGrib2DataFile::read_grib2_index(const char *path, long long src_size,
+                                        long long src_mtime) {
+   ifstream in;
+   long long size, mtime, offset, init_time, valid_time;
+   int i, j, n, n_tmpl, val, prob_flag;
+
+   in.open(path, ios::in | ios::binary);
+   if( !in ) return false;
+
+   //  header
+   if( !read_sidecar_header(in, grib2_index_magic, grib2_index_version) ||
+       !read_bin_long_long(in, size)    || size    != src_size            ||
+       !read_bin_long_long(in, mtime)   || mtime   != src_mtime           ||
+       !read_bin_int(in, n)             || n < 1                          ||
+       n > src_size ) return false;
+
+   //  records
+   vector<Grib2Record*> list;
+   bool status = true;
+
+   for(i=0; status && i < n; i++){
+      Grib2Record *rec = new Grib2Record;
+      list.push_back(rec);
+
+      status = read_bin_long_long(in, offset)         &&
+               read_bin_int(in, rec->Index)           &&
+               read_bin_int(in, rec->NumFields)       &&
+               read_bin_int(in, rec->RecNum)          &&
+               read_bin_int(in, rec->FieldNum)        &&
+               read_bin_int(in, rec->Discipline)      &&
+               read_bin_int(in, rec->PdsTmpl)         &&
+               read_bin_int(in, rec->ParmCat)         &&
+               read_bin_int(in, rec->Parm)            &&
+               read_bin_int(in, rec->Process)         &&
+               read_bin_int(in, rec->LvlTyp)          &&
+               read_bin_double(in, rec->LvlVal1)      &&
+               read_bin_double(in, rec->LvlVal2)      &&
+               read_bin_int(in, rec->RangeTyp)        &&
+               read_bin_int(in, rec->RangeVal)        &&
+               read_bin_int(in, rec->ResCompFlag)     &&
+               read_bin_int(in, prob_flag)            &&
+               read_bin_double(in, rec->ProbLower)    &&
+               read_bin_double(in, rec->ProbUpper)    &&
+               read_bin_int(in, rec->ProbType)        &&
+               read_bin_long_long(in, init_time)      &&
+               read_bin_long_long(in, valid_time)     &&
+               read_bin_int(in, rec->LeadTime)        &&
+               read_bin_int(in, rec->Accum)           &&
+               read_bin_int(in, rec->EnsType)         &&
+               read_bin_int(in, rec->EnsNumber)       &&
+               read_bin_int(in, rec->DerType)         &&
+               read_bin_int(in, rec->StatType)        &&
+               read_bin_int(in, rec->Center)          &&
+               read_bin_int(in, rec->MasterTable)     &&
+               read_bin_int(in, rec->LocalTable)      &&
+               read_bin_int(in, n_tmpl)               &&
+               0 <= offset && offset < src_size       &&
+               0 <= n_tmpl && n_tmpl < src_size;
+
+      for(j=0; status && j < n_tmpl; j++){
+         status = read_bin_int(in, val);
+         rec->IPDTmpl.add(val);
+      }
+
+      if( !status ) break;
+
+      rec->ByteOffset = (long) offset;
+      rec->ProbFlag   = ( 0 != prob_flag );
+      rec->InitTime   = (unixtime) init_time;
+      rec->ValidTime  = (unixtime) valid_time;
+
+      set_grib2_parm_name(rec);
+   }
+
+   in.close();
+
+   //  read the grid information from the first record
+   gribfield *gfld;
+   g2int numfields;
+
+   if( status && 0 > read_grib2_record(list[0]->ByteOffset, 0, 1, gfld, numfields) ){
+      status = false;
+   }
+
+   if( !status ){
+      for(i=0; i < (int) list.size(); i++) delete list[i];
+      return false;
+   }
+
+   if( !Raw_Grid || 1 > Raw_Grid->nx() || 1 > Raw_Grid->ny() ) read_grib2_grid(gfld);
+   g2_free(gfld);
+
+   RecList = list;
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool MetGrib2DataFile::write_grib2_index(const char *path, long long src_size,
+                                         long long src_mtime) const {
+   ofstream out;
+   ConcatString tmp_path;
+
+   if( !open_sidecar(out, path, tmp_path) ) return false;
+
+   write_sidecar_header(out, grib2_index_magic, grib2_index_version);
+
+   write_bin_long_long(out, src_size);
+   write_bin_long_long(out, src_mtime);
+   write_bin_int(out, (int) RecList.size());
+
+   for(size_t i=0; i < RecList.size(); i++){
+      const Grib2Record *rec = RecList[i];
+
+      write_bin_long_long(out, rec->ByteOffset);
+      write_bin_int(out, rec->Index);
+      write_bin_int(out, rec->NumFields);
+      write_bin_int(out, rec->RecNum);
+      write_bin_int(out, rec->FieldNum);
+      write_bin_int(out, rec->Discipline);
+      write_bin_int(out, rec->PdsTmpl);
+      write_bin_int(out, rec->ParmCat);
+      write_bin_int(out, rec->Parm);
+      write_bin_int(out, rec->Process);
+      write_bin_int(out, rec->LvlTyp);
+      write_bin_double(out, rec->LvlVal1);
+      write_bin_double(out, rec->LvlVal2);
+      write_bin_int(out, rec->RangeTyp);
+      write_bin_int(out, rec->RangeVal);
+      write_bin_int(out, rec->ResCompFlag);
+      write_bin_int(out, rec->ProbFlag ? 1 : 0);
+      write_bin_double(out, rec->ProbLower);
+      write_bin_double(out, rec->ProbUpper);
+      write_bin_int(out, rec->ProbType);
+      write_bin_long_long(out, rec->InitTime);
+      write_bin_long_long(out, rec->ValidTime);
+      write_bin_int(out, rec->LeadTime);
+      write_bin_int(out, rec->Accum);
+      write_bin_int(out, rec->EnsType);
+      write_bin_int(out, rec->EnsNumber);
+      write_bin_int(out, rec->DerType);
+      write_bin_int(out, rec->StatType);
+      write_bin_int(out, rec->Center);
+      write_bin_int(out, rec->MasterTable);
+      write_bin_int(out, rec->LocalTable);
+      write_bin_int(out, rec->IPDTmpl.n());
+      for(int j=0; j < rec->IPDTmpl.n(); j++) write_bin_int(out, rec->IPDTmpl[j]);
+   }
+
+   return commit_sidecar(out, path, tmp_path);
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void MetGrib2DataFile::read_grib2_grid( gribfield *gfld) {
 
    double d, r_km;
@@ -1285,84 +1661,118 @@ void MetGrib2DataFile::read_grib2_grid( gribfield *gfld) {
 bool MetGrib2DataFile::read_grib2_record_data_plane(Grib2Record *rec,
                                                      DataPlane &plane) {
 
-   //  attempt to read the record
-   gribfield *gfld;
-   g2int numfields;
-   float v, v_miss[2];
-   int n_miss, i;
-   if( -1 == read_grib2_record(rec->ByteOffset, 1, rec->FieldNum, gfld,
-                               numfields) ){
-      mlog << Error
-           << "\nMetGrib2DataFile::read_grib2_record_data_plane() -> "
-           << "failed to read record at offset " << rec->ByteOffset
-           << " and field number " << rec->FieldNum << "\n\n";
-      exit(1);
+   //  use the field decoded for the current data_plane_list() call
+   map<int, DataPlane>::iterator it = PlaneBatch.find(rec->Index);
+   if( it != PlaneBatch.end() ){
+      plane = it->second;
+      add_cached_plane(rec->Index, plane);
+      return true;
    }
 
-   //  ensure the grid has been read, and initialize the grid size
+   //  or one that was recently requested
+   if( get_cached_plane(rec->Index, plane) ) return true;
+
+   //  otherwise, decode it
+   vector<Grib2Record*> listRec(1, rec);
+   vector<DataPlane> listPlane;
+   decode_grib2_records(listRec, listPlane);
+
+   plane = listPlane[0];
+   add_cached_plane(rec->Index, plane);
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::decode_grib2_records(const vector<Grib2Record*> &listRec,
+                                            vector<DataPlane> &listPlane) {
+   int n = (int) listRec.size();
+
+   listPlane.clear();
+   if( 1 > n ) return;
+
+   //  ensure the grid has been read
    if( !Raw_Grid || 1 > Raw_Grid->nx() || 1 > Raw_Grid->ny() ) {
+      gribfield *gfld;
+      g2int numfields;
+      if( -1 == read_grib2_record(listRec[0]->ByteOffset, 0, listRec[0]->FieldNum,
+                                  gfld, numfields) ){
+         mlog << Error
+              << "\nMetGrib2DataFile::read_grib2_record_data_plane() -> "
+              << "failed to read record at offset " << listRec[0]->ByteOffset
+              << " and field number " << listRec[0]->FieldNum << "\n\n";
+         exit(1);
+      }
       read_grib2_grid(gfld);
+      g2_free(gfld);
    }
-   int n_x = Raw_Grid->nx();
-   int n_y = Raw_Grid->ny();
 
-   //  determine whether or not the data bitmap applies
-   bool apply_bmap = ( 0 == gfld->ibmap || 254 == gfld->ibmap );
+   if( !is_supported_scan_mode(ScanMode) ){
+      mlog << Error << "\nMetGrib2DataFile::data_plane() -> "
+           << "found unrecognized ScanMode (" << ScanMode << ")\n\n";
+      exit(1);
+   }
 
-   //
-   //  * * * *  read grid data  * * * *
-   //
+   //  read the messages from the file one at a time
+   vector<Grib2DecodeTask> tasks(n);
+   for(int i=0; i < n; i++){
+      if( -1 == read_grib2_message(listRec[i]->ByteOffset, tasks[i].Msg) ){
+         mlog << Error
+              << "\nMetGrib2DataFile::read_grib2_record_data_plane() -> "
+              << "failed to read record at offset " << listRec[i]->ByteOffset
+              << " and field number " << listRec[i]->FieldNum << "\n\n";
+         exit(1);
+      }
+      tasks[i].FieldNum = listRec[i]->FieldNum;
+      tasks[i].Serial   = is_serial_drs(tasks[i].Msg, tasks[i].FieldNum);
+   }
 
-   //  set up the DataPlane object
-   plane.clear();
-   plane.set_size(n_x, n_y);
+   //  unpack the JPEG2000 and PNG fields one at a time and the rest concurrently
+   Grib2DecodeInfo info;
+   info.Tasks    = &tasks;
+   info.Nx       = Raw_Grid->nx();
+   info.Ny       = Raw_Grid->ny();
+   info.ScanMode = ScanMode;
 
-   //  get the missing data value(s), if specified
-   g2_miss(gfld, v_miss, &n_miss);
+   for(int i=0; i < n; i++){
+      if( tasks[i].Serial ) decode_grib2_message(tasks[i], info.Nx, info.Ny, info.ScanMode);
+   }
 
-   //  copy the data into the data plane buffer
-   for(int x=0; x < n_x; x++){
-      for(int y=0; y < n_y; y++){
+   run_thread_tasks(decode_grib2_task, &info, n, get_num_threads());
 
-         //  determine the data index, depending on the scan mode
-         int idx_data = 0;
-         switch(ScanMode){
-         case 0:   /* 0000 0000 */ idx_data = (n_y - y - 1)*n_x + x;               break;
-         case 128: /* 1000 0000 */ idx_data = (n_y - y - 1)*n_x + (n_x - x - 1);   break;
-         case 64:  /* 0100 0000 */ idx_data =             y*n_x + x;               break;
-         case 192: /* 1100 0000 */ idx_data =             y*n_x + (n_x - x - 1);   break;
-         case 32:  /* 0010 0000 */ idx_data =             x*n_y + (n_y - y - 1);   break;
-         case 160: /* 1010 0000 */ idx_data = (n_x - x - 1)*n_y + (n_x - x - 1);   break;
-         case 96:  /* 0110 0000 */ idx_data =             x*n_y + y;               break;
-         case 224: /* 1110 0000 */ idx_data = (n_x - x - 1)*n_y + y;               break;
-         case 80:  /* 0101 0000 */ idx_data = ( y % 2 == 0 ?
-                                                y*n_x + x :
-                                                y*n_x + (n_x - x - 1) );           break;
-         default:
-            mlog << Error << "\nMetGrib2DataFile::data_plane() -> "
-                 << "found unrecognized ScanMode (" << ScanMode << ")\n\n";
-            exit(1);
-         }
+   listPlane.resize(n);
+   for(int i=0; i < n; i++){
 
-         //  check bitmap for bad data
-         v = (!apply_bmap || 0 != gfld->bmap[idx_data] ?
-              (float)gfld->fld[idx_data] : bad_data_float);
+      if( !tasks[i].Status ){
+         mlog << Error
+              << "\nMetGrib2DataFile::read_grib2_record_data_plane() -> "
+              << "failed to unpack record at offset " << listRec[i]->ByteOffset
+              << " and field number " << listRec[i]->FieldNum << "\n\n";
+         exit(1);
+      }
 
-         //  check missing data values, if specified
-         for(i=0; i < n_miss; i++) {
-            if(is_eq(v, v_miss[i])) { v = bad_data_float; break; }
-         }
+      DataPlane &plane = listPlane[i];
+      plane = tasks[i].Plane;
 
-         //  set the current data value
-         plane.set(v, x, y);
-      }
+      //  set the time information
+      plane.set_init  ( listRec[i]->InitTime  );
+      plane.set_valid ( listRec[i]->ValidTime );
+      plane.set_lead  ( listRec[i]->LeadTime  );
+      plane.set_accum ( listRec[i]->Accum     );
+
+      report_data_plane(listRec[i], plane, tasks[i].BitmapFlag,
+                        tasks[i].NMiss, tasks[i].VMiss);
    }
 
-   //  set the time information
-   plane.set_init  ( rec->InitTime  );
-   plane.set_valid ( rec->ValidTime );
-   plane.set_lead  ( rec->LeadTime  );
-   plane.set_accum ( rec->Accum     );
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::report_data_plane(Grib2Record *rec, const DataPlane &plane,
+                                         int bitmap_flag, int n_miss,
+                                         const float *v_miss) {
 
    //  print a report
    double plane_min, plane_max;
@@ -1375,16 +1785,49 @@ bool MetGrib2DataFile::read_grib2_record_data_plane(Grib2Record *rec,
         << "     valid time: " << unix_to_yyyymmdd_hhmmss(rec->ValidTime) << "\n"
         << "      lead time: " << sec_to_hhmmss(rec->LeadTime)  << "\n"
         << "      init time: " << unix_to_yyyymmdd_hhmmss(rec->InitTime)  << "\n"
-        << "    bitmap flag: " << gfld->ibmap << "\n";
-   for(i=0; i < n_miss; i++) {
+        << "    bitmap flag: " << bitmap_flag << "\n";
+   for(int i=0; i < n_miss; i++) {
       mlog << Debug(4)
            << " missing val(" << i+1 << "): " << v_miss[i] << "\n";
    }
    mlog << Debug(4) << "\n";
 
-   g2_free(gfld);
+   return;
+}
 
-   return true;
+////////////////////////////////////////////////////////////////////////
+
+bool MetGrib2DataFile::get_cached_plane(int index, DataPlane &plane) {
+
+   for( list< pair<int, DataPlane> >::iterator it = PlaneCache.begin();
+        it != PlaneCache.end();
+        it++ ){
+
+      if( it->first != index ) continue;
+
+      //  move it to the front of the list
+      PlaneCache.splice(PlaneCache.begin(), PlaneCache, it);
+      plane = PlaneCache.front().second;
+
+      return true;
+   }
+
+   return false;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::add_cached_plane(int index, const DataPlane &plane) {
+
+   DataPlane dp;
+   if( get_cached_plane(index, dp) ) return;
+
+   PlaneCache.push_front(pair<int, DataPlane>(index, plane));
+
+   //  drop the least recently used field
+   if( grib2_plane_cache_size < (int) PlaneCache.size() ) PlaneCache.pop_back();
+
+   return;
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -1397,27 +1840,37 @@ long MetGrib2DataFile::read_grib2_record(long offset, g2int unpack,
    //  http://www.nco.ncep.noaa.gov/pmb/docs/grib2/download/g2clib.documentation
 
    //  g2c fields
-   g2int listsec0[3], listsec1[13], numlocal, lskip, lgrib;
+   g2int listsec0[3], listsec1[13], numlocal;
 
-   //  find the next record and read the info, return -1 if fail
-   seekgb(FileGrib2, offset, 32000, &lskip, &lgrib);
-   if(lgrib == 0) return -1;
+   //  read the next record, return -1 if fail
+   vector<unsigned char> cgrib;
+   long offset_next = read_grib2_message(offset, cgrib);
+   if(offset_next < 0) return -1;
 
-   //  allocate memory to store the record
-   unsigned char * cgrib = new unsigned char[lgrib];
-   fseek(FileGrib2, lskip, SEEK_SET);
-   fread(cgrib, sizeof(unsigned char), lgrib, FileGrib2);
-
-   if(g2_info(cgrib, listsec0, listsec1, &numfields, &numlocal)) {
-      if(cgrib) { delete [] cgrib; cgrib = (unsigned char *) 0; }
+   if(g2_info(cgrib.data(), listsec0, listsec1, &numfields, &numlocal)) {
       return -1;
    }
 
    //  read the specified field in the record
-   g2_getfld(cgrib, ifld, unpack, 1, &gfld);
+   g2_getfld(cgrib.data(), ifld, unpack, 1, &gfld);
+
+   //  return the offset of the next record
+   return offset_next;
+}
+
+////////////////////////////////////////////////////////////////////////
 
-   //  cleanup
-   if(cgrib) { delete [] cgrib; cgrib = (unsigned char *) 0; }
+long MetGrib2DataFile::read_grib2_message(long offset, vector<unsigned char> &msg) {
+   g2int lskip, lgrib;
+
+   //  find the next record, return -1 if fail
+   seekgb(FileGrib2, offset, 32000, &lskip, &lgrib);
+   if(lgrib == 0) return -1;
+
+   //  read the whole record
+   msg.resize(lgrib);
+   fseek(FileGrib2, lskip, SEEK_SET);
+   fread(msg.data(), sizeof(unsigned char), lgrib, FileGrib2);
 
    //  return the offset of the next record
    return lskip + lgrib;
@@ -1478,3 +1931,129 @@ double scaled2dbl(int scale_factor, int scale_value) {
 }
 
 ////////////////////////////////////////////////////////////////////////
+
+long long parm_key(int discipline, int parm_cat, int parm) {
+
+   //  GRIB2 stores each of these in a single octet
+   return ( ((long long) discipline * 1000 + parm_cat) * 1000 + parm );
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool is_supported_scan_mode(int scan_mode) {
+   switch(scan_mode){
+      case 0:   case 128: case 64:  case 192:
+      case 32:  case 160: case 96:  case 224:
+      case 80:  return true;
+      default:  return false;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool is_serial_drs(const vector<unsigned char> &msg, int field_num) {
+   gribfield *gfld = (gribfield *) 0;
+   bool status = false;
+
+   //  read the section headers without unpacking the data
+   if( 0 == g2_getfld((unsigned char *) msg.data(), field_num, 0, 0, &gfld) ){
+
+      //  data representation templates 5.40 (JPEG2000) and 5.41 (PNG),
+      //  or 5.40000 and 5.40010 in older files
+      switch( gfld->idrtnum ){
+         case 40:  case 40000:
+         case 41:  case 40010:  status = true;   break;
+         default:               status = false;  break;
+      }
+   }
+
+   if( gfld ) g2_free(gfld);
+
+   return status;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void decode_grib2_message(Grib2DecodeTask &task, int n_x, int n_y, int scan_mode) {
+   gribfield *gfld = (gribfield *) 0;
+   float v;
+   int i;
+
+   task.Status = false;
+
+   //  unpack the field
+   if( 0 != g2_getfld(task.Msg.data(), task.FieldNum, 1, 1, &gfld) ){
+      if( gfld ) g2_free(gfld);
+      return;
+   }
+
+   //  determine whether or not the data bitmap applies
+   bool apply_bmap = ( 0 == gfld->ibmap || 254 == gfld->ibmap );
+
+   //  set up the DataPlane object
+   task.Plane.clear();
+   task.Plane.set_size(n_x, n_y);
+   vector<dataplane_t> &buf = task.Plane.buf();
+
+   //  get the missing data value(s), if specified
+   g2_miss(gfld, task.VMiss, &task.NMiss);
+
+   //  copy the data into the data plane buffer
+   for(int x=0; x < n_x; x++){
+      for(int y=0; y < n_y; y++){
+
+         //  determine the data index, depending on the scan mode
+         int idx_data = 0;
+         switch(scan_mode){
+         case 0:   /* 0000 0000 */ idx_data = (n_y - y - 1)*n_x + x;               break;
+         case 128: /* 1000 0000 */ idx_data = (n_y - y - 1)*n_x + (n_x - x - 1);   break;
+         case 64:  /* 0100 0000 */ idx_data =             y*n_x + x;               break;
+         case 192: /* 1100 0000 */ idx_data =             y*n_x + (n_x - x - 1);   break;
+         case 32:  /* 0010 0000 */ idx_data =             x*n_y + (n_y - y - 1);   break;
+         case 160: /* 1010 0000 */ idx_data = (n_x - x - 1)*n_y + (n_x - x - 1);   break;
+         case 96:  /* 0110 0000 */ idx_data =             x*n_y + y;               break;
+         case 224: /* 1110 0000 */ idx_data = (n_x - x - 1)*n_y + y;               break;
+         case 80:  /* 0101 0000 */ idx_data = ( y % 2 == 0 ?
+                                                y*n_x + x :
+                                                y*n_x + (n_x - x - 1) );           break;
+         }
+
+         //  check bitmap for bad data
+         v = (!apply_bmap || 0 != gfld->bmap[idx_data] ?
+              (float)gfld->fld[idx_data] : bad_data_float);
+
+         //  check missing data values, if specified
+         for(i=0; i < task.NMiss; i++) {
+            if(is_eq(v, task.VMiss[i])) { v = bad_data_float; break; }
+         }
+
+         //  set the current data value
+         buf[y*n_x + x] = v;
+      }
+   }
+
+   task.BitmapFlag = (int) gfld->ibmap;
+   task.Status     = true;
+
+   g2_free(gfld);
+
+   //  the raw message is no longer needed
+   vector<unsigned char>().swap(task.Msg);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void decode_grib2_task(void *data, int i_thread, int i_beg, int i_end) {
+   Grib2DecodeInfo *info = (Grib2DecodeInfo *) data;
+
+   for(int i=i_beg; i < i_end; i++){
+      if( (*info->Tasks)[i].Serial ) continue;
+      decode_grib2_message((*info->Tasks)[i], info->Nx, info->Ny, info->ScanMode);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
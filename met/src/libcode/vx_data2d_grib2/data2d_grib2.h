@@ -18,6 +18,8 @@
 
 #include <stdlib.h>
 #include <vector>
+#include <list>
+#include <unordered_map>
 
 #include "data_plane.h"
 #include "data_class.h"
@@ -28,6 +30,29 @@ extern "C" {
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  The record list of each GRIB2 file is saved to an index file that
+   //  is read instead of scanning the GRIB2 file on later opens.  The
+   //  index for "dir/file.grib2" is "dir/.file.grib2.g2idx", or is kept
+   //  in the directory named by MET_GRIB2_INDEX_DIR, when set.
+   //
+
+static const char met_grib2_index_dir_env [] = "MET_GRIB2_INDEX_DIR";
+
+static const char grib2_index_file_ext [] = ".g2idx";
+
+static const int  grib2_index_version     = 1;
+
+   //
+   //  Number of decoded fields kept for reuse by each GRIB2 file
+   //
+
+static const int  grib2_plane_cache_size  = 8;
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -61,6 +86,9 @@ typedef struct {
    int EnsNumber;
    int DerType;
    int StatType;
+   int Center;
+   int MasterTable;
+   int LocalTable;
    IntArray IPDTmpl;
 } Grib2Record;
 
@@ -84,6 +112,24 @@ class MetGrib2DataFile : public Met2dDataFile {
       map<string,string> PairMap;
       map<string,Grib2Record*> NameRecMap;
 
+      //
+      //  RecList indices keyed by record number, by discipline,
+      //  category and parameter, and by parameter name
+      //
+
+      unordered_map<int, vector<int> >       RecNumLookup;
+      unordered_map<long long, vector<int> > ParmLookup;
+      unordered_map<string, vector<int> >    NameLookup;
+
+      //
+      //  decoded fields keyed by record index:  the most recently used
+      //  fields, most recent first, and the fields decoded up front
+      //  for the current data_plane_list() call
+      //
+
+      list< pair<int, DataPlane> > PlaneCache;
+      map<int, DataPlane>          PlaneBatch;
+
       int ScanMode;
 
 
@@ -99,13 +145,38 @@ class MetGrib2DataFile : public Met2dDataFile {
 
       bool read_grib2_record_data_plane(Grib2Record *rec, DataPlane &plane);
 
+      void decode_grib2_records(const vector<Grib2Record*> &listRec,
+                                vector<DataPlane> &listPlane);
+
+      bool get_cached_plane(int index, DataPlane &plane);
+
+      void add_cached_plane(int index, const DataPlane &plane);
+
+      void report_data_plane(Grib2Record *rec, const DataPlane &plane,
+                             int bitmap_flag, int n_miss, const float *v_miss);
+
       void read_grib2_grid(gribfield *gfld);
 
       long read_grib2_record(long offset, g2int unpack, g2int ifld,
                              gribfield* &gfld, g2int &numfields);
 
+      long read_grib2_message(long offset, vector<unsigned char> &msg);
+
       void read_grib2_record_list();
 
+      void set_grib2_parm_name(Grib2Record *rec);
+
+      void build_record_lookup();
+
+      bool read_grib2_index(const char *path, long long src_size, long long src_mtime);
+
+      bool write_grib2_index(const char *path, long long src_size, long long src_mtime) const;
+
+      Grib2Record * find_uv_pair( VarInfoGrib2 *vinfo,
+                                  Grib2Record *rec,
+                                  ConcatString &pair_mag
+                                );
+
       DataPlane check_uv_rotation( VarInfoGrib2 *vinfo,
                                    Grib2Record *rec,
                                    DataPlane plane
@@ -137,6 +208,11 @@ class MetGrib2DataFile : public Met2dDataFile {
 
       int data_plane_array(VarInfo &, DataPlaneArray &);
 
+         //  retrieve the first matching data plane for each request,
+         //  decoding the records concurrently
+
+      int data_plane_list(VarInfo **, int n, DataPlane *, bool *);
+
          //  retrieve the index of the first matching record
 
       int index(VarInfo &);
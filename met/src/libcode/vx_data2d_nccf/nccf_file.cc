@@ -34,6 +34,13 @@ using namespace std;
 
 static const int  max_met_args           = 30;
 
+   //
+   //  Largest amount of buffer memory used to read a variable in one
+   //  call
+   //
+
+static const long long max_nc_read_bytes = 256LL*1024*1024;
+
 const double NcCfFile::DELTA_TOLERANCE = 15.0;
 
 static const char grid_mapping_name_geostationary[] = "geostationary";
@@ -50,6 +57,7 @@ static ConcatString x_dim_var_name;
 static ConcatString y_dim_var_name;
 
 static double get_nc_var_att_double(const NcVar *nc_var, const char *att_name);
+static int get_read_rows(NcVar *, int y_slot, int nx, int ny, int n_bytes);
 
 #define USE_BUFFER  1
 
@@ -978,17 +986,12 @@ bool NcCfFile::getData(NcVar * v, const LongArray & a, DataPlane & plane) const
   plane.clear();
   plane.set_size(nx, ny);
 
-  int y_offset;
   bool swap_to_north = grid.get_swap_to_north();
   if (swap_to_north) {
     mlog << Debug(2) << "\n" << method_name << "data was flipped to north.\n";
   }
 
   //  get the data
-  int    i[nx];
-  short  s[nx];
-  float  f[nx];
-  double d[nx];
 
   size_t dim_size;
   long offsets[dim_count];
@@ -1022,66 +1025,112 @@ bool NcCfFile::getData(NcVar * v, const LongArray & a, DataPlane & plane) const
   if (att_add_offset) delete att_add_offset;
   if (att_scale_factor) delete att_scale_factor;
 
+  const bool do_scale = (add_offset != 0.0 || scale_factor != 1.0);
+
+  //
+  //  read whole bands of rows in one call each, so compressed chunks
+  //  are only decompressed once.  the band is the whole 2D slab unless
+  //  that's too large, in which case it's aligned to the y chunks.
+  //
+
+  //
+  //  bytes held for each value of the band:  values not stored as
+  //  double are read into a buffer of their own type and then copied
+  //  to the double buffer
+  //
+
   int type_id = GET_NC_TYPE_ID_P(v);
-  for (int y=0; y<ny; ++y)  {
-    offsets[y_slot] = y;
+  int n_bytes;
+
+  switch ( type_id )  {
+    case NcType::nc_SHORT:  n_bytes = sizeof(short) + sizeof(double);  break;
+    case NcType::nc_INT:    n_bytes = sizeof(int)   + sizeof(double);  break;
+    case NcType::nc_FLOAT:  n_bytes = sizeof(float) + sizeof(double);  break;
+    case NcType::nc_DOUBLE: n_bytes = sizeof(double);                  break;
+
+    default:
+      mlog << Error << "\n" << method_name
+           << " bad type [" << GET_NC_TYPE_NAME_P(v)
+           << "] for variable \"" << (GET_NC_NAME_P(v)) << "\"\n\n";
+      exit ( 1 );
+      break;
+  }   //  switch
+
+  const int band_ny = get_read_rows(v, y_slot, nx, ny, n_bytes);
+
+  vector<short>  s;
+  vector<int>    i;
+  vector<float>  f;
+  vector<double> d((size_t) nx*band_ny);
+
+  vector<dataplane_t> & buf = plane.buf();
+
+  for (int y_beg=0; y_beg<ny; y_beg+=band_ny)  {
+
+    const int n_rows = min(band_ny, ny - y_beg);
+    const int n      = nx*n_rows;
+
+    offsets[y_slot] = y_beg;
+    lengths[y_slot] = n_rows;
+
     switch ( type_id )  {
 
       case NcType::nc_SHORT:
-        get_nc_data(v, (short *)&s, lengths, offsets);
-        for (int x=0; x<nx; ++x)  {
-          d[x] = (double)s[x];
-        }
+        s.resize(n);
+        get_nc_data(v, s.data(), lengths, offsets);
+        for (int j=0; j<n; ++j)  d[j] = (double)s[j];
         break;
 
       case NcType::nc_INT:
-        get_nc_data(v, (int *)&i, lengths, offsets);
-        for (int x=0; x<nx; ++x)  {
-          d[x] = (double)i[x];
-        }
+        i.resize(n);
+        get_nc_data(v, i.data(), lengths, offsets);
+        for (int j=0; j<n; ++j)  d[j] = (double)i[j];
         break;
 
       case NcType::nc_FLOAT:
-        get_nc_data(v, (float *)&f, lengths, offsets);
-        for (int x=0; x<nx; ++x)  {
-          d[x] = (double)f[x];
-        }
+        f.resize(n);
+        get_nc_data(v, f.data(), lengths, offsets);
+        for (int j=0; j<n; ++j)  d[j] = (double)f[j];
         break;
 
-      //case ncDouble:
       case NcType::nc_DOUBLE:
-        get_nc_data(v, (double *)&d, lengths, offsets);
-        break;
-
-      default:
-        mlog << Error << "\n" << method_name
-             << " bad type [" << GET_NC_TYPE_NAME_P(v)
-             << "] for variable \"" << (GET_NC_NAME_P(v)) << "\"\n\n";
-        exit ( 1 );
+        get_nc_data(v, d.data(), lengths, offsets);
         break;
 
     }   //  switch
 
-    LongArray b = a;
-    y_offset = y;
-    if (swap_to_north) y_offset = ny - 1 - y;
+    //
+    //  the band is stored with x varying fastest unless the x
+    //  dimension comes before the y dimension in the variable
+    //
 
-    for (int x = 0; x< nx; ++x)
-    {
-      //double value = getData(v, b);
-      double value = d[x];
+    const int x_stride = (x_slot > y_slot) ? 1 : n_rows;
+    const int y_stride = (x_slot > y_slot) ? nx : 1;
 
-      if(is_eq(value, missing_value) || is_eq(value, fill_value)) {
-         value = bad_data_double;
-      }
-      else if (add_offset != 0.0 || scale_factor != 1.0) {
-         value = value * scale_factor + add_offset;
-      }
+    for (int r=0; r<n_rows; ++r)  {
 
-      plane.set(value, x, y_offset);
+      const int y = y_beg + r;
+      const int y_offset = (swap_to_north ? ny - 1 - y : y);
 
-    }   //  for y
-  }   //  for x
+      const double * src = d.data() + r*y_stride;
+      dataplane_t * dst  = buf.data() + (size_t) y_offset*nx;
+
+      for (int x=0; x<nx; ++x)  {
+
+        double value = src[x*x_stride];
+
+        if(is_eq(value, missing_value) || is_eq(value, fill_value)) {
+           value = bad_data_double;
+        }
+        else if (do_scale) {
+           value = value * scale_factor + add_offset;
+        }
+
+        dst[x] = (dataplane_t) value;
+
+      }   //  for x
+    }   //  for r
+  }   //  for y_beg
 
   //  done
 
@@ -1960,6 +2009,42 @@ double get_nc_var_att_double(const NcVar *nc_var, const char *att_name)
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Number of rows to read from a variable in each call:  all of them
+   //  when the 2D slab fits within max_nc_read_bytes, otherwise as many
+   //  whole chunks along the y dimension as fit.  n_bytes is the buffer
+   //  memory needed for each value read.
+   //
+
+int get_read_rows(NcVar *nc_var, int y_slot, int nx, int ny, int n_bytes)
+{
+   const long long row_bytes = (long long) nx * n_bytes;
+
+   if(row_bytes * ny <= max_nc_read_bytes) return(ny);
+
+   NcVar::ChunkMode chunk_mode = NcVar::nc_CONTIGUOUS;
+   vector<size_t> chunk_sizes;
+   int chunk_ny = 1;
+
+   nc_var->getChunkingParameters(chunk_mode, chunk_sizes);
+
+   if(chunk_mode == NcVar::nc_CHUNKED &&
+      y_slot < (int) chunk_sizes.size() && chunk_sizes[y_slot] > 0)
+   {
+      chunk_ny = (int) chunk_sizes[y_slot];
+   }
+
+   int n_rows = (int) (max_nc_read_bytes / row_bytes);
+
+   n_rows = max(chunk_ny, (n_rows / chunk_ny) * chunk_ny);
+
+   return(min(n_rows, ny));
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -579,6 +579,38 @@ GridInterface::~GridInterface()
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+void GridInterface::latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const
+
+{
+
+int j;
+
+for (j=0; j<n; ++j)  latlon_to_xy(lat[j], lon[j], x[j], y[j]);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void GridInterface::xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const
+
+{
+
+int j;
+
+for (j=0; j<n; ++j)  xy_to_latlon(x[j], y[j], lat[j], lon[j]);
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -818,6 +850,54 @@ return;
 ////////////////////////////////////////////////////////////////////////
 
 
+void Grid::latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const
+
+{
+
+int j;
+
+if ( !rep )  {
+
+   for (j=0; j<n; ++j)  x[j] = y[j] = 0.0;
+
+   return;
+
+}
+
+rep->latlon_to_xy(lat, lon, x, y, n);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void Grid::xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const
+
+{
+
+int j;
+
+if ( !rep )  {
+
+   for (j=0; j<n; ++j)  lat[j] = lon[j] = 0.0;
+
+   return;
+
+}
+
+rep->xy_to_latlon(x, y, lat, lon, n);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 double Grid::calc_area(int x, int y) const
 
 {
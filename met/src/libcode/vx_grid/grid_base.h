@@ -121,6 +121,14 @@ class GridInterface {   //  pure abstract class for grid public interface
 
       virtual void xy_to_latlon(double x, double y, double &lat, double &lon) const = 0;
 
+         //
+         //  convert n points at once, defaults to one point at a time
+         //
+
+      virtual void latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const;
+
+      virtual void xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const;
+
       virtual double calc_area(int x, int y) const = 0;
 
       virtual int nx() const = 0;
@@ -230,6 +238,10 @@ class Grid : public GridInterface {
 
       void xy_to_latlon(double x, double y, double & lat, double & lon) const;
 
+      void latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const;
+
+      void xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const;
+
       double calc_area(int x, int y) const;
 
       int nx() const;
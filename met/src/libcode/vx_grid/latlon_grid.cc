@@ -166,6 +166,58 @@ return;
 ////////////////////////////////////////////////////////////////////////
 
 
+void LatLonGrid::latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const
+
+{
+
+int j;
+double a, b;
+
+for (j=0; j<n; ++j)  {
+
+   a = (lat[j] - lat_ll)/delta_lat;
+
+   b = lon_ll - lon[j];
+   b = b - 360.0*floor(b/360.0);
+
+   x[j] = b/delta_lon;
+   y[j] = a;
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void LatLonGrid::xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const
+
+{
+
+int j;
+double a, b;
+
+for (j=0; j<n; ++j)  {
+
+   a = lat_ll + delta_lat*y[j];
+   b = lon_ll - delta_lon*x[j];
+
+   lat[j] = a;
+   lon[j] = b;
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 double LatLonGrid::calc_area(int x, int y) const
 
 {
@@ -62,6 +62,10 @@ class LatLonGrid : public GridRep {
 
       virtual void xy_to_latlon(double x, double y, double & lat, double & lon) const;
 
+      virtual void latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const;
+
+      virtual void xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const;
+
       virtual double calc_area(int x, int y) const;
 
       virtual int nx() const;
@@ -326,6 +326,112 @@ return;
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Same arithmetic as the single point versions, with the
+   //  hemisphere and cone factors computed once per call
+   //
+
+void LambertGrid::latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const
+
+{
+
+int j;
+double r, theta, lon_j, xx, yy;
+const double H      = ( IsNorthHemisphere ? 1.0 : -1.0 );
+const double HCone  = H*Cone;
+
+for (j=0; j<n; ++j)  {
+
+   lon_j = lon[j];
+
+   reduce(lon_j);
+
+   r = lc_func(lat[j], Cone, IsNorthHemisphere);
+
+   theta = HCone*(Lon_orient - lon_j);
+
+   xx = Bx + Alpha*r*H*sind(theta);
+
+   yy = By - Alpha*r*H*cosd(theta);
+
+   if ( Has_SO2 )  {
+
+      xx -= Data.x_pin;
+      yy -= Data.y_pin;
+
+      so2_forward(xx, yy);
+
+      xx += Data.x_pin;
+      yy += Data.y_pin;
+
+   }
+
+   x[j] = xx;
+   y[j] = yy;
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void LambertGrid::xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const
+
+{
+
+int j;
+double r, theta, xx, yy, lon_j;
+const double H      = ( IsNorthHemisphere ? 1.0 : -1.0 );
+const double HAlpha = H*Alpha;
+const double HCone  = H*Cone;
+
+for (j=0; j<n; ++j)  {
+
+   xx = x[j];
+   yy = y[j];
+
+   if ( Has_SO2 )  {
+
+      xx -= Data.x_pin;
+      yy -= Data.y_pin;
+
+      so2_reverse(xx, yy);
+
+      xx += Data.x_pin;
+      yy += Data.y_pin;
+
+   }
+
+   xx = (xx - Bx)/HAlpha;
+   yy = (yy - By)/HAlpha;
+
+   r = sqrt( xx*xx + yy*yy );
+
+   lat[j] = lc_inv_func(r, Cone, IsNorthHemisphere);
+
+   if ( fabs(r) < 1.0e-5 )  theta = 0.0;
+   else                     theta = atan2d(xx, -yy);   //  NOT atan2d(y, x);
+
+   lon_j = Lon_orient - theta/HCone;
+
+   reduce(lon_j);
+
+   lon[j] = lon_j;
+
+}
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
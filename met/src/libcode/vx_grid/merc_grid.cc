@@ -289,6 +289,64 @@ return;
 ////////////////////////////////////////////////////////////////////////
 
 
+void MercatorGrid::latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const
+
+{
+
+int j;
+double u, v;
+
+for (j=0; j<n; ++j)  {
+
+   u = merc_lon_to_u(Lon_UR_radians, lon[j]/deg_per_rad);
+
+   v = merc_func(lat[j]/deg_per_rad);
+
+   x[j] = Mx*u + Bx;
+
+   y[j] = My*v + By;
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void MercatorGrid::xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const
+
+{
+
+int j;
+double u, v, lat_rad, lon_rad;
+
+for (j=0; j<n; ++j)  {
+
+   u = (x[j] - Bx)/Mx;
+
+   v = (y[j] - By)/My;
+
+   lon_rad = merc_u_to_lon(Lon_UR_radians, u);
+
+   lat_rad = merc_inv_func(v);
+
+   lat[j] = deg_per_rad*lat_rad;
+
+   lon[j] = deg_per_rad*lon_rad;
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 double MercatorGrid::calc_area(int x, int y) const
 
 {
@@ -260,6 +260,52 @@ return;
 ////////////////////////////////////////////////////////////////////////
 
 
+void RotatedLatLonGrid::latlon_to_xy(const double * lat_true, const double * lon_true, double * x, double * y, int n) const
+
+{
+
+int j;
+double lat_rot, lon_rot;
+
+for (j=0; j<n; ++j)  {
+
+   er.latlon_true_to_rot(lat_true[j], lon_true[j], lat_rot, lon_rot);
+
+   LatLonGrid::latlon_to_xy(lat_rot, lon_rot, x[j], y[j]);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RotatedLatLonGrid::xy_to_latlon(const double * x, const double * y, double * lat_true, double * lon_true, int n) const
+
+{
+
+int j;
+double lat_rot, lon_rot;
+
+for (j=0; j<n; ++j)  {
+
+   LatLonGrid::xy_to_latlon(x[j], y[j], lat_rot, lon_rot);
+
+   er.latlon_rot_to_true(lat_rot, lon_rot, lat_true[j], lon_true[j]);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 double RotatedLatLonGrid::calc_area(int x, int y) const
 
 {
@@ -55,6 +55,10 @@ class RotatedLatLonGrid : public LatLonGrid {
 
       virtual void xy_to_latlon(double x, double y, double & true_lat, double & true_lon) const;
 
+      virtual void latlon_to_xy(const double * true_lat, const double * true_lon, double * x, double * y, int n) const;
+
+      virtual void xy_to_latlon(const double * x, const double * y, double * true_lat, double * true_lon, int n) const;
+
       virtual double calc_area(int x, int y) const;
 
       virtual int nx() const;
@@ -253,6 +253,81 @@ return;
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Same arithmetic as the single point versions, with the
+   //  hemisphere factor computed once per call
+   //
+
+void StereographicGrid::latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const
+
+{
+
+int j;
+double r, theta, lon_j;
+const double H = ( IsNorthHemisphere ? 1.0 : -1.0 );
+
+for (j=0; j<n; ++j)  {
+
+   lon_j = lon[j];
+
+   reduce(lon_j);
+
+   r = st_func(lat[j], IsNorthHemisphere);
+
+   theta = H*(Lon_orient - lon_j);
+
+   x[j] = Bx + Alpha*r*H*sind(theta);
+
+   y[j] = By - Alpha*r*H*cosd(theta);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void StereographicGrid::xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const
+
+{
+
+int j;
+double r, theta, xx, yy, lon_j;
+const double H = ( IsNorthHemisphere ? 1.0 : -1.0 );
+
+for (j=0; j<n; ++j)  {
+
+   xx = (x[j] - Bx)/Alpha;
+   yy = (y[j] - By)/Alpha;
+
+   r = sqrt( xx*xx + yy*yy );
+
+   lat[j] = st_inv_func(r, IsNorthHemisphere);
+
+   if ( fabs(r) < 1.0e-5 )  theta = 0.0;
+   else                     theta = atan2d(H*xx, -H*yy);   //  NOT atan2d(y, x);
+
+   if ( !IsNorthHemisphere )  theta = -theta;
+
+   lon_j = Lon_orient - theta;
+
+   reduce(lon_j);
+
+   lon[j] = lon_j;
+
+}
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
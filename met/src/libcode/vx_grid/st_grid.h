@@ -82,6 +82,10 @@ class StereographicGrid : public GridRep {
 
       void xy_to_latlon(double x, double y, double & lat, double & lon) const;
 
+      void latlon_to_xy(const double * lat, const double * lon, double * x, double * y, int n) const;
+
+      void xy_to_latlon(const double * x, const double * y, double * lat, double * lon, int n) const;
+
       double calc_area(int x, int y) const;
 
       int nx() const;
@@ -498,6 +498,34 @@ return;
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+void TcrmwGrid::latlon_to_xy(const double * true_lat, const double * true_lon, double * x, double * y, int n) const
+
+{
+
+GridInterface::latlon_to_xy(true_lat, true_lon, x, y, n);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void TcrmwGrid::xy_to_latlon(const double * x, const double * y, double * true_lat, double * true_lon, int n) const
+
+{
+
+GridInterface::xy_to_latlon(x, y, true_lat, true_lon, n);
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -94,6 +94,10 @@ class TcrmwGrid : public RotatedLatLonGrid {
 
       void xy_to_latlon(double x, double y, double & true_lat, double & true_lon) const;
 
+      void latlon_to_xy(const double * true_lat, const double * true_lon, double * x, double * y, int n) const;
+
+      void xy_to_latlon(const double * x, const double * y, double * true_lat, double * true_lon, int n) const;
+
 
 
       void wind_ne_to_ra(const double lat, const double lon, 
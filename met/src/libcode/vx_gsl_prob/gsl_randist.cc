@@ -18,6 +18,7 @@ using namespace std;
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
+#include <mutex>
 
 #include "vx_log.h"
 #include "gsl_randist.h"
@@ -26,6 +27,13 @@ using namespace std;
 
 static int get_seed();
 
+//
+// Generators are set up through the environment, so only one thread
+// at a time may allocate one
+//
+
+static mutex rng_set_mutex;
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Allocate a random number generator using the name and seed specified.
@@ -38,6 +46,7 @@ void rng_set(gsl_rng *&r, const char *rng_name, const char *rng_seed) {
    const gsl_rng_type * T = (const gsl_rng_type *) 0;
    int seed;
    char seed_str[256];
+   lock_guard<mutex> lock(rng_set_mutex);
 
    // Set the GSL_RNG_TYPE environment variable
    setenv("GSL_RNG_TYPE", rng_name, 1);
@@ -87,6 +96,34 @@ void rng_free(gsl_rng *r) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Allocate n independent random number generators of the same type as
+// the parent, seeding each one from successive draws of the parent.
+// The streams are fully determined by the state of the parent so that
+// splitting work across them is reproducible for a given seed.
+//
+////////////////////////////////////////////////////////////////////////
+
+void rng_split(const gsl_rng *r, int n, gsl_rng **streams) {
+   int i;
+
+   for(i=0; i<n; i++) {
+      streams[i] = gsl_rng_alloc(r->type);
+
+      if(streams[i] == NULL) {
+         mlog << Error << "\nrng_split() -> "
+              << "error allocating random number generator stream "
+              << i << "!\n\n";
+         exit(1);
+      }
+
+      gsl_rng_set(streams[i], gsl_rng_get(r));
+   }
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Produce a random permutation of the values in the array base.
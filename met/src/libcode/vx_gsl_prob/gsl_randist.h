@@ -41,6 +41,7 @@ enum DistType {
 
 extern void rng_set(gsl_rng *&r, const char *, const char *);
 extern void rng_free(gsl_rng *r);
+extern void rng_split(const gsl_rng *r, int, gsl_rng **);
 
 ////////////////////////////////////////////////////////////////////////
 //
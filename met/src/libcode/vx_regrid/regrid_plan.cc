@@ -0,0 +1,934 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <fstream>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "regrid_plan.h"
+
+#include "vx_util.h"
+#include "vx_log.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Plan file layout, all values in native byte order:
+   //
+   //     magic, byte order mark, version, plan type, grid dimensions
+   //     plan signature:  length and characters
+   //     X and Y, or Index and Area:  count, then the values
+   //
+
+static const char regrid_plan_magic [] = "METRGPLN";
+
+static const int  regrid_plan_version = 2;
+
+   //
+   //  Number of points recomputed to check a plan read from a file
+   //
+
+static const int  regrid_plan_n_check = 16;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+struct RegridPlanEntry {
+
+   RegridPlanType Type;
+
+   Grid FromGrid;
+   Grid ToGrid;
+
+   RegridPlan * Plan;   //  allocated
+
+};
+
+
+   //
+   //  Plans kept for reuse, freed at exit
+   //
+
+class RegridPlanCache {
+
+   public:
+
+      RegridPlanCache();
+     ~RegridPlanCache();
+
+      vector<RegridPlanEntry> Entries;
+
+      long long NBytes;
+
+      mutex Mutex;
+
+};
+
+
+static RegridPlanCache plan_cache;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static long long plan_bytes(RegridPlanType, const Grid & from_grid, const Grid & to_grid);
+
+static bool is_comparable(const Grid &);
+
+static ConcatString grid_signature(const Grid &);
+
+static ConcatString plan_signature(RegridPlanType, const Grid & from_grid, const Grid & to_grid);
+
+static ConcatString plan_file_name(const char * dir, const ConcatString & signature);
+
+static void write_string (ofstream &, const ConcatString &);
+static bool read_string  (ifstream &, ConcatString &);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class RegridPlan
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlan::RegridPlan()
+
+{
+
+init_from_scratch();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlan::~RegridPlan()
+
+{
+
+clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::init_from_scratch()
+
+{
+
+clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::clear()
+
+{
+
+Type = RegridPlan_Point;
+
+FromNx = FromNy = 0;
+ToNx   = ToNy   = 0;
+
+X.clear();
+Y.clear();
+
+Index.clear();
+Area.clear();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void RegridPlan::build(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+int xt, yt, xf, yf, i, j, k, n_col;
+long long n;
+const double delta = 1.0/budget_n;
+vector<double> col_x, col_y, col_lat, col_lon;
+
+clear();
+
+Type = type;
+
+FromNx = from_grid.nx();
+FromNy = from_grid.ny();
+ToNx   = to_grid.nx();
+ToNy   = to_grid.ny();
+
+   //
+   //  project one grid column at a time through the batch
+   //  conversion functions
+   //
+
+switch ( Type )  {
+
+   case RegridPlan_Point:
+
+      X.resize((long long) ToNx*ToNy);
+      Y.resize((long long) ToNx*ToNy);
+
+      n_col = ToNy;
+
+      col_x.resize(n_col);
+      col_y.resize(n_col);
+      col_lat.resize(n_col);
+      col_lon.resize(n_col);
+
+      for (xt=0, n=0; xt<ToNx; ++xt, n+=n_col)  {
+
+         for (yt=0; yt<ToNy; ++yt)  {
+
+            col_x[yt] = xt;
+            col_y[yt] = yt;
+
+         }
+
+         to_grid.xy_to_latlon(col_x.data(), col_y.data(), col_lat.data(), col_lon.data(), n_col);
+
+         from_grid.latlon_to_xy(col_lat.data(), col_lon.data(), &X[n], &Y[n], n_col);
+
+      }
+
+      break;
+
+   case RegridPlan_Budget:
+
+      X.resize((long long) ToNx*ToNy*budget_nn);
+      Y.resize((long long) ToNx*ToNy*budget_nn);
+
+      n_col = ToNy*budget_nn;
+
+      col_x.resize(n_col);
+      col_y.resize(n_col);
+      col_lat.resize(n_col);
+      col_lon.resize(n_col);
+
+      for (xt=0, n=0; xt<ToNx; ++xt, n+=n_col)  {
+
+         for (yt=0, k=0; yt<ToNy; ++yt)  {
+
+            for (i=-budget_radius; i<=budget_radius; ++i)  {
+
+               for (j=-budget_radius; j<=budget_radius; ++j, ++k)  {
+
+                  col_x[k] = xt + i*delta;
+                  col_y[k] = yt + j*delta;
+
+               }
+
+            }
+
+         }
+
+         to_grid.xy_to_latlon(col_x.data(), col_y.data(), col_lat.data(), col_lon.data(), n_col);
+
+         from_grid.latlon_to_xy(col_lat.data(), col_lon.data(), &X[n], &Y[n], n_col);
+
+      }
+
+      break;
+
+   case RegridPlan_Area:
+
+      Index.resize((long long) FromNx*FromNy);
+      Area.resize((long long) FromNx*FromNy);
+
+      n_col = FromNy;
+
+      col_x.resize(n_col);
+      col_y.resize(n_col);
+      col_lat.resize(n_col);
+      col_lon.resize(n_col);
+
+      for (xf=0, n=0; xf<FromNx; ++xf)  {
+
+         for (yf=0; yf<FromNy; ++yf)  {
+
+            col_x[yf] = xf;
+            col_y[yf] = yf;
+
+         }
+
+         from_grid.xy_to_latlon(col_x.data(), col_y.data(), col_lat.data(), col_lon.data(), n_col);
+
+         to_grid.latlon_to_xy(col_lat.data(), col_lon.data(), col_x.data(), col_y.data(), n_col);
+
+         for (yf=0; yf<FromNy; ++yf, ++n)  {
+
+            xt = nint(col_x[yf]);
+            yt = nint(col_y[yf]);
+
+            if ( (xt < 0) || (xt >= ToNx) || (yt < 0) || (yt >= ToNy) )  {
+
+               Index[n] = -1;
+               Area[n]  = 0.0;
+
+            } else {
+
+               Index[n] = xt*ToNy + yt;
+               Area[n]  = from_grid.calc_area(xf, yf);
+
+            }
+
+         }
+
+      }
+
+      break;
+
+}   //  switch Type
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Recompute a sample of the plan values and check that they match
+   //  exactly
+   //
+
+bool RegridPlan::check(const Grid & from_grid, const Grid & to_grid) const
+
+{
+
+if ( FromNx != from_grid.nx() || FromNy != from_grid.ny() ||
+     ToNx   != to_grid.nx()   || ToNy   != to_grid.ny() )  return ( false );
+
+int k, xt, yt, xf, yf, i, j;
+long long n, n_vals;
+double lat, lon, x, y;
+const double delta = 1.0/budget_n;
+
+n_vals = ( Type == RegridPlan_Area ? (long long) Index.size() : (long long) X.size() );
+
+if ( n_vals == 0 )  return ( true );
+
+for (k=0; k<regrid_plan_n_check; ++k)  {
+
+   n = (n_vals - 1)*k/(regrid_plan_n_check - 1);
+
+   switch ( Type )  {
+
+      case RegridPlan_Point:
+
+         xt = n/ToNy;
+         yt = n%ToNy;
+
+         to_grid.xy_to_latlon(xt, yt, lat, lon);
+
+         from_grid.latlon_to_xy(lat, lon, x, y);
+
+         if ( x != X[n] || y != Y[n] )  return ( false );
+
+         break;
+
+      case RegridPlan_Budget:
+
+         xt = (n/budget_nn)/ToNy;
+         yt = (n/budget_nn)%ToNy;
+         i  = (n%budget_nn)/budget_n - budget_radius;
+         j  = (n%budget_nn)%budget_n - budget_radius;
+
+         to_grid.xy_to_latlon(xt + i*delta, yt + j*delta, lat, lon);
+
+         from_grid.latlon_to_xy(lat, lon, x, y);
+
+         if ( x != X[n] || y != Y[n] )  return ( false );
+
+         break;
+
+      case RegridPlan_Area:
+
+         xf = n/FromNy;
+         yf = n%FromNy;
+
+         from_grid.xy_to_latlon(xf, yf, lat, lon);
+
+         to_grid.latlon_to_xy(lat, lon, x, y);
+
+         xt = nint(x);
+         yt = nint(y);
+
+         if ( (xt < 0) || (xt >= ToNx) || (yt < 0) || (yt >= ToNy) )  {
+
+            if ( Index[n] != -1 )  return ( false );
+
+         } else {
+
+            if ( Index[n] != xt*ToNy + yt ||
+                 Area[n]  != from_grid.calc_area(xf, yf) )  return ( false );
+
+         }
+
+         break;
+
+   }   //  switch Type
+
+}
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool RegridPlan::read(const char * path, RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+ifstream in;
+int t, n;
+long long n_vals;
+ConcatString sig;
+
+clear();
+
+in.open(path, ios::in | ios::binary);
+
+if ( !in )  return ( false );
+
+if ( !read_sidecar_header(in, regrid_plan_magic, regrid_plan_version) ||
+     !read_bin_int(in, t) || t != (int) type )  return ( false );
+
+Type = type;
+
+if ( !read_bin_int(in, FromNx) || FromNx != from_grid.nx() ||
+     !read_bin_int(in, FromNy) || FromNy != from_grid.ny() ||
+     !read_bin_int(in, ToNx)   || ToNx   != to_grid.nx()   ||
+     !read_bin_int(in, ToNy)   || ToNy   != to_grid.ny() )  { clear();  return ( false ); }
+
+if ( !read_string(in, sig) || sig != plan_signature(type, from_grid, to_grid) )  { clear();  return ( false ); }
+
+switch ( Type )  {
+
+   case RegridPlan_Point:  n_vals = (long long) ToNx*ToNy;            break;
+   case RegridPlan_Budget: n_vals = (long long) ToNx*ToNy*budget_nn;  break;
+   default:                n_vals = (long long) FromNx*FromNy;        break;
+
+}
+
+if ( !read_bin_int(in, n) || n != n_vals )  { clear();  return ( false ); }
+
+if ( Type == RegridPlan_Area )  {
+
+   Index.resize(n_vals);
+   Area.resize(n_vals);
+
+   in.read((char *) Index.data(), (streamsize) n_vals*sizeof(int));
+   in.read((char *) Area.data(),  (streamsize) n_vals*sizeof(double));
+
+} else {
+
+   X.resize(n_vals);
+   Y.resize(n_vals);
+
+   in.read((char *) X.data(), (streamsize) n_vals*sizeof(double));
+   in.read((char *) Y.data(), (streamsize) n_vals*sizeof(double));
+
+}
+
+if ( !in )  { clear();  return ( false ); }
+
+in.close();
+
+   //
+   //  the grids match exactly, but recompute some of the values too in
+   //  case the file was written by a different build
+   //
+
+if ( !check(from_grid, to_grid) )  { clear();  return ( false ); }
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool RegridPlan::write(const char * path, const Grid & from_grid, const Grid & to_grid) const
+
+{
+
+ofstream out;
+ConcatString tmp_path;
+long long n_vals;
+
+if ( !open_sidecar(out, path, tmp_path) )  return ( false );
+
+write_sidecar_header(out, regrid_plan_magic, regrid_plan_version);
+
+write_bin_int(out, (int) Type);
+
+write_bin_int(out, FromNx);
+write_bin_int(out, FromNy);
+write_bin_int(out, ToNx);
+write_bin_int(out, ToNy);
+
+write_string(out, plan_signature(Type, from_grid, to_grid));
+
+if ( Type == RegridPlan_Area )  {
+
+   n_vals = Index.size();
+
+   write_bin_int(out, (int) n_vals);
+
+   out.write((const char *) Index.data(), (streamsize) n_vals*sizeof(int));
+   out.write((const char *) Area.data(),  (streamsize) n_vals*sizeof(double));
+
+} else {
+
+   n_vals = X.size();
+
+   write_bin_int(out, (int) n_vals);
+
+   out.write((const char *) X.data(), (streamsize) n_vals*sizeof(double));
+   out.write((const char *) Y.data(), (streamsize) n_vals*sizeof(double));
+
+}
+
+return ( commit_sidecar(out, path, tmp_path) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long RegridPlan::n_bytes() const
+
+{
+
+return ( (long long) (X.size() + Y.size() + Area.size())*sizeof(double) +
+         (long long) Index.size()*sizeof(int) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for class RegridPlanCache
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlanCache::RegridPlanCache()
+
+{
+
+NBytes = 0;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+RegridPlanCache::~RegridPlanCache()
+
+{
+
+int j;
+
+for (j=0; j<(int) Entries.size(); ++j)  {
+
+   if ( Entries[j].Plan )  { delete Entries[j].Plan;  Entries[j].Plan = (RegridPlan *) 0; }
+
+}
+
+Entries.clear();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Code for misc functions
+   //
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+const RegridPlan * get_regrid_plan(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+int j;
+long long n_bytes;
+ConcatString dir, path;
+RegridPlanEntry entry;
+
+if ( !is_comparable(from_grid) || !is_comparable(to_grid) )  return ( (const RegridPlan *) 0 );
+
+lock_guard<mutex> lock(plan_cache.Mutex);
+
+for (j=0; j<(int) plan_cache.Entries.size(); ++j)  {
+
+   const RegridPlanEntry & e = plan_cache.Entries[j];
+
+   if ( e.Type == type && e.FromGrid == from_grid && e.ToGrid == to_grid )  return ( e.Plan );
+
+}
+
+n_bytes = plan_bytes(type, from_grid, to_grid);
+
+if ( plan_cache.NBytes + n_bytes > regrid_plan_max_bytes )  {
+
+   mlog << Debug(4) << "get_regrid_plan() -> "
+        << "not keeping a regrid plan of " << n_bytes
+        << " bytes for grid " << to_grid.name() << "\n";
+
+   return ( (const RegridPlan *) 0 );
+
+}
+
+entry.Type     = type;
+entry.FromGrid = from_grid;
+entry.ToGrid   = to_grid;
+entry.Plan     = new RegridPlan;
+
+   //
+   //  read the plan from the cache directory or build it
+   //
+
+if ( get_env(met_regrid_cache_dir_env, dir) && dir.nonempty() )  {
+
+   path = plan_file_name(dir.c_str(), plan_signature(type, from_grid, to_grid));
+
+}
+
+if ( path.nonempty() && entry.Plan->read(path.c_str(), type, from_grid, to_grid) )  {
+
+   mlog << Debug(3) << "Read regrid plan file \"" << path << "\"\n";
+
+} else {
+
+   entry.Plan->build(type, from_grid, to_grid);
+
+   if ( path.nonempty() )  {
+
+      if ( entry.Plan->write(path.c_str(), from_grid, to_grid) )  {
+
+         mlog << Debug(3) << "Wrote regrid plan file \"" << path << "\"\n";
+
+      } else {
+
+         mlog << Warning << "\nget_regrid_plan() -> "
+              << "unable to write regrid plan file \"" << path << "\"\n\n";
+
+      }
+
+   }
+
+}
+
+plan_cache.Entries.push_back(entry);
+
+plan_cache.NBytes += entry.Plan->n_bytes();
+
+return ( entry.Plan );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long plan_bytes(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+long long n;
+
+switch ( type )  {
+
+   case RegridPlan_Point:
+      n = (long long) to_grid.nx()*to_grid.ny()*2*sizeof(double);
+      break;
+
+   case RegridPlan_Budget:
+      n = (long long) to_grid.nx()*to_grid.ny()*budget_nn*2*sizeof(double);
+      break;
+
+   default:
+      n = (long long) from_grid.nx()*from_grid.ny()*(sizeof(int) + sizeof(double));
+      break;
+
+}
+
+return ( n );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Grid equality is defined by the grid info, which some grid types
+   //  (such as TCRMW) don't provide, so those grids aren't even equal
+   //  to themselves and plans for them can't be looked up
+   //
+
+bool is_comparable(const Grid & grid)
+
+{
+
+return ( grid == grid );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static void add_param(ConcatString & s, const char * name, double value)
+
+{
+
+char junk[256];
+
+snprintf(junk, sizeof(junk), " %s: %.17g", name, value);
+
+s << junk;
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Every parameter of the grid, printed so that it reads back to
+   //  the same double.  Grid::serialize() rounds the parameters, so two
+   //  grids with the same serialization may still differ.
+   //
+
+ConcatString grid_signature(const Grid & grid)
+
+{
+
+ConcatString s;
+GridInfo info = grid.info();
+
+s << "Nx: " << grid.nx() << " Ny: " << grid.ny();
+
+if ( info.lc )  {
+
+   s << " Lambert: " << info.lc->hemisphere;
+
+   add_param(s, "scale_lat_1", info.lc->scale_lat_1);
+   add_param(s, "scale_lat_2", info.lc->scale_lat_2);
+   add_param(s, "lat_pin",     info.lc->lat_pin);
+   add_param(s, "lon_pin",     info.lc->lon_pin);
+   add_param(s, "x_pin",       info.lc->x_pin);
+   add_param(s, "y_pin",       info.lc->y_pin);
+   add_param(s, "lon_orient",  info.lc->lon_orient);
+   add_param(s, "d_km",        info.lc->d_km);
+   add_param(s, "r_km",        info.lc->r_km);
+   add_param(s, "so2_angle",   info.lc->so2_angle);
+
+} else if ( info.st )  {
+
+   s << " Stereographic: " << info.st->hemisphere;
+
+   add_param(s, "scale_lat",  info.st->scale_lat);
+   add_param(s, "lat_pin",    info.st->lat_pin);
+   add_param(s, "lon_pin",    info.st->lon_pin);
+   add_param(s, "x_pin",      info.st->x_pin);
+   add_param(s, "y_pin",      info.st->y_pin);
+   add_param(s, "lon_orient", info.st->lon_orient);
+   add_param(s, "d_km",       info.st->d_km);
+   add_param(s, "r_km",       info.st->r_km);
+
+} else if ( info.ll )  {
+
+   s << " LatLon:";
+
+   add_param(s, "lat_ll",    info.ll->lat_ll);
+   add_param(s, "lon_ll",    info.ll->lon_ll);
+   add_param(s, "delta_lat", info.ll->delta_lat);
+   add_param(s, "delta_lon", info.ll->delta_lon);
+
+} else if ( info.rll )  {
+
+   s << " RotatedLatLon:";
+
+   add_param(s, "rot_lat_ll",          info.rll->rot_lat_ll);
+   add_param(s, "rot_lon_ll",          info.rll->rot_lon_ll);
+   add_param(s, "delta_rot_lat",       info.rll->delta_rot_lat);
+   add_param(s, "delta_rot_lon",       info.rll->delta_rot_lon);
+   add_param(s, "true_lat_south_pole", info.rll->true_lat_south_pole);
+   add_param(s, "true_lon_south_pole", info.rll->true_lon_south_pole);
+   add_param(s, "aux_rotation",        info.rll->aux_rotation);
+
+} else if ( info.m )  {
+
+   s << " Mercator:";
+
+   add_param(s, "lat_ll", info.m->lat_ll);
+   add_param(s, "lon_ll", info.m->lon_ll);
+   add_param(s, "lat_ur", info.m->lat_ur);
+   add_param(s, "lon_ur", info.m->lon_ur);
+
+} else if ( info.g )  {
+
+   s << " Gaussian:";
+
+   add_param(s, "lon_zero", info.g->lon_zero);
+
+} else if ( info.gi )  {
+
+   s << " GoesImager:";
+
+   add_param(s, "perspective_point_height", info.gi->perspective_point_height);
+   add_param(s, "semi_major_axis",          info.gi->semi_major_axis);
+   add_param(s, "semi_minor_axis",          info.gi->semi_minor_axis);
+   add_param(s, "inverse_flattening",       info.gi->inverse_flattening);
+   add_param(s, "lat_of_projection_origin", info.gi->lat_of_projection_origin);
+   add_param(s, "lon_of_projection_origin", info.gi->lon_of_projection_origin);
+   add_param(s, "dx_rad",                   info.gi->dx_rad);
+   add_param(s, "dy_rad",                   info.gi->dy_rad);
+
+   if ( info.gi->x_image_bounds )  add_param(s, "x_image_bound", info.gi->x_image_bounds[0]);
+   if ( info.gi->y_image_bounds )  add_param(s, "y_image_bound", info.gi->y_image_bounds[0]);
+
+}
+
+return ( s );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Plan type and both grid signatures:  used as the file name key
+   //  and stored in the file, where it must match exactly
+   //
+
+ConcatString plan_signature(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+ConcatString s;
+
+s << "Type: " << (int) type
+  << " From: " << grid_signature(from_grid)
+  << " To: "   << grid_signature(to_grid);
+
+return ( s );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  File name from a hash of the plan signature
+   //
+
+ConcatString plan_file_name(const char * dir, const ConcatString & signature)
+
+{
+
+return ( hashed_file_name(dir, "regrid_plan_", signature.c_str(), ".bin") );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void write_string(ofstream & out, const ConcatString & s)
+
+{
+
+write_bin_int(out, s.length());
+
+out.write(s.c_str(), s.length());
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool read_string(ifstream & in, ConcatString & s)
+
+{
+
+int n;
+
+if ( !read_bin_int(in, n) || n < 0 || n > 65536 )  return ( false );
+
+vector<char> buf(n + 1, '\0');
+
+in.read(buf.data(), n);
+
+if ( !in )  return ( false );
+
+s = buf.data();
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,139 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __MET_REGRID_PLAN_H__
+#define  __MET_REGRID_PLAN_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+
+#include "vx_grid.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  When set, regrid plans are read from and written to this directory
+   //
+
+static const char met_regrid_cache_dir_env [] = "MET_REGRID_CACHE_DIR";
+
+   //
+   //  Most memory used by the regrid plans kept for reuse
+   //
+
+static const long long regrid_plan_max_bytes = 1024LL*1024*1024;
+
+   //
+   //  Budget interpolation samples each to_grid box at
+   //  (2*budget_radius + 1)^2 points
+   //
+
+static const int budget_radius = 2;
+static const int budget_n      = 2*budget_radius + 1;
+static const int budget_nn     = budget_n*budget_n;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+enum RegridPlanType {
+
+   RegridPlan_Point,    //  from_grid location of each to_grid point
+   RegridPlan_Budget,   //  from_grid location of each budget sample
+   RegridPlan_Area      //  to_grid point and area of each from_grid point
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Grid geometry for regridding from one grid to another.  Only
+   //  depends on the two grids, so it can be reused for every field
+   //  regridded between them.
+   //
+
+class RegridPlan {
+
+   private:
+
+      void init_from_scratch();
+
+      RegridPlan(const RegridPlan &);
+      RegridPlan & operator=(const RegridPlan &);
+
+   public:
+
+      RegridPlan();
+     ~RegridPlan();
+
+      void clear();
+
+      void build(RegridPlanType, const Grid & from_grid, const Grid & to_grid);
+
+      bool check(const Grid & from_grid, const Grid & to_grid) const;
+
+      bool read  (const char *, RegridPlanType, const Grid & from_grid, const Grid & to_grid);
+      bool write (const char *, const Grid & from_grid, const Grid & to_grid) const;
+
+      long long n_bytes() const;
+
+      RegridPlanType Type;
+
+      int FromNx, FromNy;
+      int ToNx,   ToNy;
+
+         //
+         //  Point and budget plans:  from_grid x and y of each to_grid
+         //  point (or budget sample) with n = x*ToNy + y
+         //
+
+      std::vector<double> X;
+      std::vector<double> Y;
+
+         //
+         //  Area plans:  to_grid index, or -1 when off the grid, and area
+         //  of each from_grid point with n = x*FromNy + y
+         //
+
+      std::vector<int>    Index;
+      std::vector<double> Area;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Returns a shared plan, building it the first time it's needed, or
+   //  null when the grids can't be compared or the plan is too large
+   //  to keep.  The plan stays valid until the program exits.
+   //
+
+extern const RegridPlan * get_regrid_plan(RegridPlanType, const Grid & from_grid, const Grid & to_grid);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __MET_REGRID_PLAN_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
@@ -86,9 +86,11 @@ DataPlane met_regrid_generic (const DataPlane & from_data, const Grid & from_gri
 
 int xt, yt;
 int xf, yf;
+long long n;
 double value, lat, lon;
 double x_from, y_from;
 DataPlane to_data;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Point, from_grid, to_grid);
 
 to_data.set_size(to_grid.nx(), to_grid.ny());
 
@@ -104,13 +106,22 @@ to_data.set_accum (from_data.accum());
    //
    //  copy data
    //
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
+for (xt=0, n=0; xt<(to_grid.nx()); ++xt)  {
 
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
+   for (yt=0; yt<(to_grid.ny()); ++yt, ++n)  {
+
+      if ( plan )  {
+
+         x_from = plan->X[n];
+         y_from = plan->Y[n];
 
-      to_grid.xy_to_latlon(xt, yt, lat, lon);
+      } else {
+
+         to_grid.xy_to_latlon(xt, yt, lat, lon);
 
-      from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+         from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+
+      }
 
       xf = nint(x_from);
       yf = nint(y_from);
@@ -119,6 +130,14 @@ for (xt=0; xt<(to_grid.nx()); ++xt)  {
 
          value = bad_data_float;
 
+      } else if ( info.method == InterpMthd_Nearest && info.width == 1 )  {
+
+         value = from_data.get(xf, yf);
+
+      } else if ( info.method == InterpMthd_Bilin )  {
+
+         value = interp_bilin(from_data, x_from, y_from);
+
       } else {
          value = compute_horz_interp(from_data, x_from, y_from, bad_data_double,
                                      info.method, info.width, info.shape, info.vld_thresh);
@@ -149,9 +168,11 @@ DataPlane met_regrid_area_weighted (const DataPlane & from_data, const Grid & fr
 
 int xt, yt;
 int xf, yf;
+long long n;
 double value, weight, lat, lon;
 double x_to, y_to;
 DataPlane to_data, wt_data;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Area, from_grid, to_grid);
 
    //
    //  The interpolation width and shape do not apply here.  The output
@@ -183,9 +204,26 @@ to_data.set_accum (from_data.accum());
    //  loop over the from grid to accumulate sums and area weights
    //
 
-for (xf=0; xf<(from_grid.nx()); ++xf)  {
+for (xf=0, n=0; xf<(from_grid.nx()); ++xf)  {
+
+   for (yf=0; yf<(from_grid.ny()); ++yf, ++n)  {
+
+      if ( plan )  {
+
+         if ( plan->Index[n] < 0 )  continue;
+
+         xt = plan->Index[n] / to_grid.ny();
+         yt = plan->Index[n] % to_grid.ny();
 
-   for (yf=0; yf<(from_grid.ny()); ++yf)  {
+         if ( is_bad_data(value = from_data(xf, yf)) )  continue;
+         weight = plan->Area[n];
+
+         to_data.set(to_data(xt, yt) + value*weight, xt, yt);
+         wt_data.set(wt_data(xt, yt) + weight,       xt, yt);
+
+         continue;
+
+      }
 
       from_grid.xy_to_latlon(xf, yf, lat, lon);
 
@@ -280,9 +318,11 @@ DataPlane met_regrid_maxgauss (const DataPlane & from_data, const Grid & from_gr
 
 int xt, yt;
 int xf, yf;
+long long n;
 double value, lat, lon;
 double x_from, y_from;
 DataPlane to_data;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Point, from_grid, to_grid);
 
 to_data.set_size(to_grid.nx(), to_grid.ny());
 
@@ -298,13 +338,22 @@ to_data.set_accum (from_data.accum());
    //
    //  copy data
    //
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
+for (xt=0, n=0; xt<(to_grid.nx()); ++xt)  {
 
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
+   for (yt=0; yt<(to_grid.ny()); ++yt, ++n)  {
+
+      if ( plan )  {
+
+         x_from = plan->X[n];
+         y_from = plan->Y[n];
 
-      to_grid.xy_to_latlon(xt, yt, lat, lon);
+      } else {
+
+         to_grid.xy_to_latlon(xt, yt, lat, lon);
 
-      from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+         from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+
+      }
 
       xf = nint(x_from);
       yf = nint(y_from);
@@ -21,6 +21,7 @@
 #include "vx_grid.h"
 #include "data_plane.h"
 #include "config_constants.h"
+#include "regrid_plan.h"
 
 
 ////////////////////////////////////////////////////////////////////////
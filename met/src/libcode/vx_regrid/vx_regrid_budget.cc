@@ -28,6 +28,7 @@ DataPlane met_regrid_budget (const DataPlane & from_data, const Grid & from_grid
 DataPlane to_data;
 int i, j, ixt, iyt;
 int count;
+long long n;
 double dxt, dyt, dxf, dyf;
 double sum, lat, lon, value;
 double fraction;
@@ -37,10 +38,11 @@ double fraction;
    //  Consider making this configurable.
    //
 
-const int Radius = 2;
-const int N = 2*Radius + 1;
-const int NN = N*N;
+const int Radius = budget_radius;
+const int N = budget_n;
+const int NN = budget_nn;
 const double delta = 1.0/N;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Budget, from_grid, to_grid);
 
 to_data.set_size(to_grid.nx(), to_grid.ny());
 
@@ -57,7 +59,7 @@ to_data.set_accum (from_data.accum());
    //  Do the interpolation
    //
 
-for (ixt=0; ixt<(to_grid.nx()); ++ixt)  {
+for (ixt=0, n=0; ixt<(to_grid.nx()); ++ixt)  {
 
    for (iyt=0; iyt<(to_grid.ny()); ++iyt)  {
 
@@ -69,13 +71,22 @@ for (ixt=0; ixt<(to_grid.nx()); ++ixt)  {
 
          dxt = ixt + i*delta;
 
-         for (j=-Radius; j<=Radius; ++j)  {
+         for (j=-Radius; j<=Radius; ++j, ++n)  {
 
             dyt = iyt + j*delta;
 
-            to_grid.xy_to_latlon(dxt, dyt, lat, lon);
+            if ( plan )  {
 
-            from_grid.latlon_to_xy(lat, lon, dxf, dyf);
+               dxf = plan->X[n];
+               dyf = plan->Y[n];
+
+            } else {
+
+               to_grid.xy_to_latlon(dxt, dyt, lat, lon);
+
+               from_grid.latlon_to_xy(lat, lon, dxf, dyf);
+
+            }
 
             value = interp_bilin(from_data, dxf, dyf);
 
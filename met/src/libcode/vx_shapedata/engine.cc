@@ -24,11 +24,11 @@ using namespace std;
 
 ///////////////////////////////////////////////////////////////////////
 
-static const int print_interest_log_level = 5;
+static inline double area_ratio_conf(double t) { return(t); }
 
 ///////////////////////////////////////////////////////////////////////
 
-static inline double area_ratio_conf(double t) { return(t); }
+static void pair_interest_task(void *, int, int, int);
 
 ///////////////////////////////////////////////////////////////////////
 //
@@ -288,6 +288,76 @@ void ModeFuzzyEngine::set_no_conv(const ShapeData &fcst_wd, const ShapeData &obs
 }
 
 
+///////////////////////////////////////////////////////////////////////
+//
+// Set the raw fields and convolve them, stopping short of
+// thresholding, so that the engines for each convolution threshold
+// can share the result through set_conv().
+//
+///////////////////////////////////////////////////////////////////////
+
+void ModeFuzzyEngine::set_conv_only(const ShapeData &fcst_wd, const ShapeData &obs_wd)
+
+{
+
+   ConcatString path;
+
+   clear_features();
+   clear_colors();
+   ctable.clear();
+
+   collection.clear();
+
+   *fcst_raw = fcst_wd;
+   *obs_raw  = obs_wd;
+
+   need_fcst_conv = true;
+   need_obs_conv  = true;
+
+   do_fcst_convolution();
+   do_obs_convolution();
+
+   path = replace_path(conf_info.object_pi.color_table.c_str());
+
+   ctable.read(path.c_str());
+
+   return;
+
+}
+
+///////////////////////////////////////////////////////////////////////
+//
+// Copy the raw and convolved fields and the color table from an engine
+// that used the same convolution radius and identify the objects.
+// No files are read, so several engines may be set up concurrently
+// from the same source engine.
+//
+///////////////////////////////////////////////////////////////////////
+
+void ModeFuzzyEngine::set_conv(const ModeFuzzyEngine &eng)
+
+{
+
+   clear_features();
+   clear_colors();
+
+   collection.clear();
+
+   *fcst_raw  = *(eng.fcst_raw);
+   *fcst_conv = *(eng.fcst_conv);
+
+   *obs_raw   = *(eng.obs_raw);
+   *obs_conv  = *(eng.obs_conv);
+
+   ctable = eng.ctable;
+
+   set_fcst_no_conv (*fcst_raw);
+   set_obs_no_conv  (*obs_raw);
+
+   return;
+
+}
+
 ///////////////////////////////////////////////////////////////////////
 
 void ModeFuzzyEngine::set_fcst(const ShapeData &fcst_wd) {
@@ -897,40 +967,9 @@ void ModeFuzzyEngine::do_match_merge() {
    }
 
    //
-   // Do the pair features
+   // Do the pair features and calculate the interest values
    //
-   pair_single.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         pair_single[n].set(fcst_single[j], obs_single[k],
-                     conf_info.max_centroid_dist);
-         pair_single[n].pair_number = n;
-      }
-   }
-
-   //
-   // Calculate the interest values
-   //
-   info_singles.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-          
-         n = two_to_one(j, k);
-
-         info_singles[n].fcst_number    = (j+1);
-         info_singles[n].obs_number     = (k+1);
-         info_singles[n].pair_number    = n;
-         info_singles[n].interest_value = total_interest(conf_info,
-                                             pair_single[n], j+1, k+1,
-                                             true);
-
-      }
-   }
+   do_pair_interest();
 
    //
    // Sort the interest values in decreasing order
@@ -1649,40 +1688,9 @@ void ModeFuzzyEngine::do_match_fcst_merge() {
    }
 
    //
-   // Do the pair features
+   // Do the pair features and calculate the interest values
    //
-   pair_single.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         pair_single[n].set(fcst_single[j], obs_single[k],
-                     conf_info.max_centroid_dist);
-         pair_single[n].pair_number = n;
-      }
-   }
-
-   //
-   // Calculate the interest values
-   //
-   info_singles.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         info_singles[n].fcst_number    = (j+1);
-         info_singles[n].obs_number     = (k+1);
-         info_singles[n].pair_number    = n;
-         info_singles[n].interest_value = total_interest(conf_info,
-                                             pair_single[n], j+1, k+1,
-                                             true);
-
-      }
-   }
+   do_pair_interest();
 
    //
    // Sort the interest values in decreasing order
@@ -1826,39 +1834,9 @@ void ModeFuzzyEngine::do_match_only() {
    }
 
    //
-   // Do the pair features
-   //
-   pair_single.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         pair_single[n].set(fcst_single[j], obs_single[k],
-                     conf_info.max_centroid_dist);
-         pair_single[n].pair_number = n;
-      }
-   }
-
-   //
-   // Calculate the interest values
+   // Do the pair features and calculate the interest values
    //
-   info_singles.set_size(n_fcst*n_obs);
-
-   for(j=0; j<n_fcst; j++) {
-      for(k=0; k<n_obs; k++) {
-
-         n = two_to_one(j, k);
-
-         info_singles[n].fcst_number    = (j+1);
-         info_singles[n].obs_number     = (k+1);
-         info_singles[n].pair_number    = n;
-         info_singles[n].interest_value = total_interest(conf_info,
-                                             pair_single[n], j+1, k+1,
-                                             true);
-      }
-   }
+   do_pair_interest();
 
    //
    // Sort the interest values in decreasing order
@@ -1946,6 +1924,30 @@ void ModeFuzzyEngine::do_match_only() {
    return;
 }
 
+///////////////////////////////////////////////////////////////////////
+//
+// Compute the pair features and total interest for every forecast
+// and observation object pair.  The pairs depend only on the single
+// features, so they are filled in parallel into the preallocated
+// n_fcst*n_obs arrays.  The per-pair interest logging is only
+// readable when written in order, so use one thread in that case.
+//
+///////////////////////////////////////////////////////////////////////
+
+void ModeFuzzyEngine::do_pair_interest() {
+   int n_threads;
+
+   pair_single.set_size(n_fcst*n_obs);
+   info_singles.set_size(n_fcst*n_obs);
+
+   if(mlog.verbosity_level() >= print_interest_log_level) n_threads = 1;
+   else                                                   n_threads = get_num_threads();
+
+   run_thread_tasks(pair_interest_task, this, n_fcst*n_obs, n_threads);
+
+   return;
+}
+
 ///////////////////////////////////////////////////////////////////////
 //
 // Create a split composite field based on the merging of the single objects
@@ -3709,4 +3711,40 @@ return( pow(ratio, 0.3) );
 }
 
 
+///////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////
+//
+// Fill in pairs [i_beg, i_end) of the engine's n_fcst*n_obs pair
+// feature and interest arrays
+//
+///////////////////////////////////////////////////////////////////////
+
+void pair_interest_task(void *data, int, int i_beg, int i_end) {
+   int j, k, n;
+   ModeFuzzyEngine &eng = *((ModeFuzzyEngine *) data);
+
+   for(n=i_beg; n<i_end; n++) {
+
+      //
+      // Same pair ordering as ModeFuzzyEngine::two_to_one()
+      //
+      j = n%eng.n_fcst;
+      k = n/eng.n_fcst;
+
+      eng.pair_single[n].set(eng.fcst_single[j], eng.obs_single[k],
+                             eng.conf_info.max_centroid_dist);
+      eng.pair_single[n].pair_number = n;
+
+      eng.info_singles[n].fcst_number    = (j+1);
+      eng.info_singles[n].obs_number     = (k+1);
+      eng.info_singles[n].pair_number    = n;
+      eng.info_singles[n].interest_value = total_interest(eng.conf_info,
+                                              eng.pair_single[n], j+1, k+1,
+                                              true);
+   }
+
+   return;
+}
+
 ///////////////////////////////////////////////////////////////////////
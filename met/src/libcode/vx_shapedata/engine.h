@@ -58,6 +58,12 @@ typedef CRR_Array<PairFeature>   PairFeatureArray;
 static const char hms_fmt     [] = "%.2i%.2i%.2i";
 static const char ymd_hms_fmt [] = "%.4i%.2i%.2i_%.2i%.2i%.2i";
 
+//
+// Verbosity at which the interest values of each object pair are
+// logged, which is only readable when the pairs are computed in order
+//
+static const int print_interest_log_level = 5;
+
 ///////////////////////////////////////////////////////////////////////////////
 
 //
@@ -184,6 +190,14 @@ class ModeFuzzyEngine {
 
       void set_no_conv(const ShapeData &fcst_wd, const ShapeData &obs_wd);
 
+         //
+         // Convolve the raw fields without identifying any objects,
+         // and set up from another engine's convolved fields
+         //
+
+      void set_conv_only(const ShapeData &fcst_wd, const ShapeData &obs_wd);
+      void set_conv(const ModeFuzzyEngine &);
+
       void set_fcst (const ShapeData & fcst_wd);
       void set_obs  (const ShapeData &  obs_wd);
 
@@ -258,6 +272,13 @@ class ModeFuzzyEngine {
 
       void do_match_only();
 
+         //
+         // Compute the pair features and interest values for every
+         // forecast and observation object pair
+         //
+
+      void do_pair_interest();
+
       void do_fcst_clus_splitting();
       void do_obs_clus_splitting();
 
@@ -94,6 +94,8 @@ void SingleFeature::init_from_scratch()
 
 boundary = (Polyline *) 0;
 
+boundary_index = (PolylineIndex *) 0;
+
 clear();
 
 }
@@ -131,11 +133,13 @@ void SingleFeature::clear()
    Mask   = (const ShapeData *) 0;
 
    convex_hull.clear();
+   convex_hull_index.clear();
 
    //
    // Deallocate memory
    //
    if(boundary) { delete [] boundary;  boundary = (Polyline *) 0; }
+   if(boundary_index) { delete [] boundary_index;  boundary_index = (PolylineIndex *) 0; }
    n_bdy = 0;
 
    return;
@@ -176,14 +180,19 @@ void SingleFeature::assign(const SingleFeature & s)
    Thresh = s.Thresh;
    Mask   = s.Mask;
 
-   convex_hull = s.convex_hull;
+   convex_hull       = s.convex_hull;
+   convex_hull_index = s.convex_hull_index;
 
    //
    // Allocate memory
    //
-   n_bdy    = s.n_bdy;
-   boundary = new Polyline [n_bdy];
-   for(i=0; i<n_bdy; i++) boundary[i] = s.boundary[i];
+   n_bdy          = s.n_bdy;
+   boundary       = new Polyline [n_bdy];
+   boundary_index = new PolylineIndex [n_bdy];
+   for(i=0; i<n_bdy; i++) {
+      boundary[i]       = s.boundary[i];
+      boundary_index[i] = s.boundary_index[i];
+   }
 
    return;
 }
@@ -260,16 +269,19 @@ void SingleFeature::set(const ShapeData &raw, const ShapeData &thresh,
    // Convex hull
    //
    convex_hull = Mask->convex_hull();
+   convex_hull_index.set(convex_hull);
 
    //
    // Boundary:
    // Split the mask field and store the boundary for each object.
    //
    split_wd = split(mask, n_bdy);
-   boundary = new Polyline [n_bdy];
+   boundary       = new Polyline [n_bdy];
+   boundary_index = new PolylineIndex [n_bdy];
    for(i=0; i<n_bdy; i++) {
       obj_wd      = select(split_wd, i+1);
       boundary[i] = obj_wd.single_boundary();
+      boundary_index[i].set(boundary[i]);
    }
 
    //
@@ -422,12 +434,14 @@ void PairFeature::set(const SingleFeature &fcst,
    //
    // Boundary distance:
    // Compute it as the minimum distance between any two pairs of
-   // polylines.
+   // polylines, skipping pairs whose bounding boxes are already
+   // too far apart.
    //
    boundary_dist = 1.0e30;
    for(i=0; i<Obs->n_bdy; i++) {
       for(j=0; j<Fcst->n_bdy; j++) {
-         d = polyline_dist(Obs->boundary[i], Fcst->boundary[j]);
+         if(Obs->boundary_index[i].box_dist(Fcst->boundary_index[j]) >= boundary_dist) continue;
+         d = polyline_dist(Obs->boundary_index[i], Fcst->boundary_index[j]);
          if(d < boundary_dist) boundary_dist = d;
          if(is_eq(boundary_dist, 0.0)) break;
       }
@@ -437,7 +451,7 @@ void PairFeature::set(const SingleFeature &fcst,
    //
    // Convex hull distance
    //
-   convex_hull_dist = polyline_dist(Obs->convex_hull, Fcst->convex_hull);
+   convex_hull_dist = polyline_dist(Obs->convex_hull_index, Fcst->convex_hull_index);
 
    //
    // Angle diff
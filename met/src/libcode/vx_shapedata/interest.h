@@ -81,6 +81,13 @@ class SingleFeature {
       Polyline  convex_hull;
       Polyline *boundary;   //  allocated
       int       n_bdy;
+
+      //
+      // spatial indexes of the convex hull and boundaries,
+      // reused for the distances to every other object
+      //
+      PolylineIndex  convex_hull_index;
+      PolylineIndex *boundary_index;   //  allocated
 };
 
 ////////////////////////////////////////////////////////////////////////
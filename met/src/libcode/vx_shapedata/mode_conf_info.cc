@@ -194,7 +194,7 @@ void ModeConfInfo::read_config(const char *default_file_name, const char *user_f
 ////////////////////////////////////////////////////////////////////////
 
 
-void ModeConfInfo::process_config(GrdFileType ftype, GrdFileType otype)
+void ModeConfInfo::process_config(GrdFileType ftype, GrdFileType otype, bool warn)
 
 {
 
@@ -389,7 +389,7 @@ PlotInfo plot_info;
 
       // Check that match_flag is set between 0 and 3
 
-   if(match_flag == MatchType_None &&
+   if(warn && match_flag == MatchType_None &&
       (fcst_merge_flag != MergeType_None || obs_merge_flag  != MergeType_None) ) {
       mlog << Warning << "\nModeConfInfo::process_config() -> "
            << "When matching is disabled (match_flag = "
@@ -407,7 +407,7 @@ PlotInfo plot_info;
 
       // Check that max_centroid_dist is > 0
 
-   if(max_centroid_dist <= 0) {
+   if(warn && max_centroid_dist <= 0) {
       mlog << Warning << "\nModeConfInfo::process_config() -> "
            << "max_centroid_dist (" << max_centroid_dist
            << ") should be set > 0\n\n";
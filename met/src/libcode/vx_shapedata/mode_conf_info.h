@@ -74,7 +74,12 @@ class ModeConfInfo {
 
       void read_config    (const char * default_filename, const char * user_filename);
 
-      void process_config (GrdFileType ftype, GrdFileType otype);
+         //
+         //  warn = false skips the config sanity warnings, for when
+         //  the same config has already been processed and checked
+         //
+
+      void process_config (GrdFileType ftype, GrdFileType otype, bool warn = true);
 
       void set_perc_thresh(const DataPlane &, const DataPlane &);
 
@@ -64,6 +64,34 @@ static double dot(double, double, double, double);
 static void   boundary_step(const ShapeData &, int &, int &, int &);
 static int    get_step_case(bool, bool, bool, bool);
 
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Task data for ShapeData::conv_filter_circ().  Each row y of the sum
+//  and count tables holds the running sums over x' < x of that row, for
+//  x = 0 to nx, so that the circle is added up one chord per row.
+//  Valid values which are not finite are left out of the sum and
+//  counted in nfin instead, and the chords containing them are added
+//  up directly.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+struct ConvCircInfo {
+   int nx, ny, radius;
+   double vld_thresh;
+   bool vld_thresh_one;
+
+   const dataplane_t *in;
+   dataplane_t       *out;
+
+   vector<int>    chord;   // half width of the chord at each row offset
+   vector<int>    vld;     // count of valid data
+   vector<double> sum;     // sum of the valid finite data
+   vector<int>    nfin;    // count of valid data that is not finite
+};
+
+static void conv_circ_sums_task(void *, int, int, int);
+static void conv_circ_task     (void *, int, int, int);
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 //  Begin Code for class ShapeData
@@ -518,19 +546,13 @@ void ShapeData::conv_filter_circ(int diameter, double vld_thresh)
 
 {
 
-int x, y, xx, yy, u, v;
-int dn, fn, nn;
-int vpr, upr;
-int count, bd_count;
-double center, cur, sum;
-double dx, dy, dist;
-double vld_ratio;
+int u, v;
+double dist;
+DataPlane in_data = data;
+ConvCircInfo info;
 const int nx = data.nx();
 const int ny = data.ny();
-bool * f = (bool *) 0;
-bool center_bad = false;
-DataPlane in_data = data;
-const bool vld_thresh_one = is_eq(vld_thresh, 1.0);
+const int n_threads = get_num_threads();
 
 
 if ( (diameter%2 == 0) || (diameter < 3) )  {
@@ -545,28 +567,28 @@ if ( (diameter%2 == 0) || (diameter < 3) )  {
 
 const int radius = (diameter - 1)/2;
 
-const vector<double> * in  = &(in_data.Data);
-      vector<double> * out = &(data.Data);
-
-f = new bool [diameter*diameter];
+info.nx             = nx;
+info.ny             = ny;
+info.radius         = radius;
+info.vld_thresh     = vld_thresh;
+info.vld_thresh_one = is_eq(vld_thresh, 1.0);
+info.in             = in_data.data();
+info.out            = data.Data.data();
 
    //
-   //  set up the filter
+   //  set up the filter:  the points of each row of the circle
+   //  form a chord from -chord to +chord
    //
 
-for (y=0; y<diameter; ++y)  {
-
-   dy = y - radius;
+info.chord.assign(diameter, -1);
 
-   for (x=0; x<diameter; ++x)  {
+for (v=-radius; v<=radius; ++v)  {
 
-      dx = x - radius;
+   for (u=0; u<=radius; ++u)  {
 
-      dist = sqrt( dx*dx + dy*dy );
+      dist = sqrt( (double) (u*u + v*v) );
 
-      fn = STANDARD_XY_YO_N(diameter, x, y) ;
-
-      f[fn] = (dist <= radius);
+      if ( dist <= radius )  info.chord[v + radius] = u;
 
    }
 
@@ -576,92 +598,18 @@ for (y=0; y<diameter; ++y)  {
    //  do the convolution
    //
 
-dn = -1;
-
-for(y=0; y<ny; y++) {
-
-   for(x=0; x<nx; x++) {
-
-      ++dn;
-
-         //
-         // If the bad data threshold is set to zero and the center of the
-         // convolution radius contains bad data, set the convolved value to
-         // bad data and continue.
-         //
-
-      center = (*in)[dn];
-
-      center_bad = ::is_bad_data(center);
-
-      if ( center_bad && vld_thresh_one ) { (*out)[dn] = bad_data_double;  continue; }
-
-      sum      = 0.0;
-      count    = 0;
-      bd_count = 0;
-
-      for (v=-radius; v<=radius; ++v) {
-
-         yy = y + v;
-
-         if ( (yy < 0) || (yy >= ny) )  continue;
-
-         vpr = v + radius;
-
-         for(u=-radius; u<=radius; ++u) {
-
-            xx = x + u;
-
-            if ( (xx < 0) || (xx >= nx) )  continue;
-
-            upr = u + radius;
-
-            fn = STANDARD_XY_YO_N(diameter, upr, vpr);
-
-            if ( !(f[fn]) )  continue;
-
-            nn = STANDARD_XY_YO_N(nx, xx, yy) ;
-
-            cur = (*in)[nn];
-
-            if( ::is_bad_data(cur) ) { bd_count++;  continue; }
-
-            sum += cur;
-
-            count++;
-
-         } // for v
-
-      } // for u
-
-         //
-         //  If the center of the convolution contains bad data and the ratio
-         //  of bad data in the convolution area is too high, set the convoled
-         //  value to bad data.
-         //
-
-      if ( count == 0 )  sum = bad_data_double;
-      else {
-
-         vld_ratio = ((double) count)/(bd_count + count);
-
-         if ( center_bad && (vld_ratio < vld_thresh) )  sum = bad_data_double;
-         else                                           sum /= count;
-
-      }
-
-      (*out)[dn] = sum;
+info.vld.resize((nx + 1)*ny);
+info.sum.resize((nx + 1)*ny);
+info.nfin.resize((nx + 1)*ny);
 
-   } // for y
+run_thread_tasks(conv_circ_sums_task, &info, ny, n_threads);
 
-} // for x
+run_thread_tasks(conv_circ_task,      &info, ny, n_threads);
 
    //
    //  done
    //
 
-if ( f )  { delete [] f;   f = (bool *) 0; }
-
 return;
 
 }
@@ -1235,719 +1183,221 @@ return;
 
 ///////////////////////////////////////////////////////////////////////////////
 //
-//  Begin Code for class Cell
+//  Begin Code for Miscellaneous Functions
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-Cell::Cell()
+double dot(double x_1, double y_1, double x_2, double y_2)
 
 {
 
-init_from_scratch();
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-Cell::~Cell()
+double d;
 
-{
+d = x_1*x_2 + y_1*y_2;
 
-clear();
+return ( d );
 
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-Cell::Cell(const Cell & c)
-
-{
+void boundary_step(const ShapeData &sd, int &xn, int &yn, int &direction) {
+   bool lr, ur, ul, ll;
 
-init_from_scratch();
+   lr = ur = ul = ll = false;
 
-assign(c);
+   //
+   // Based on the direction of travel turn on/off lr, ur, ul, ll cells
+   //
+   switch(direction) {
 
-}
+      case(plus_x):
+         if(sd.s_is_on(xn,   yn-1, false)) lr = true;
+         if(sd.s_is_on(xn+1, yn-1, false)) ur = true;
+         if(sd.s_is_on(xn+1, yn  , false)) ul = true;
+         if(sd.s_is_on(xn,   yn  , false)) ll = true;
 
-///////////////////////////////////////////////////////////////////////////////
+         xn += 1;
+         break;
 
-Cell & Cell::operator=(const Cell & c)
+      case(plus_y):
+         if(sd.s_is_on(xn,   yn  , false)) lr = true;
+         if(sd.s_is_on(xn,   yn+1, false)) ur = true;
+         if(sd.s_is_on(xn-1, yn+1, false)) ul = true;
+         if(sd.s_is_on(xn-1, yn  , false)) ll = true;
 
-{
+         yn += 1;
+         break;
 
-if ( this == &c )  return ( * this );
+      case(minus_x):
+         if(sd.s_is_on(xn-1, yn  , false)) lr = true;
+         if(sd.s_is_on(xn-2, yn  , false)) ur = true;
+         if(sd.s_is_on(xn-2, yn-1, false)) ul = true;
+         if(sd.s_is_on(xn-1, yn-1, false)) ll = true;
 
-assign(c);
+         xn -= 1;
+         break;
 
-return ( * this );
+      case(minus_y):
+         if(sd.s_is_on(xn-1, yn-1, false)) lr = true;
+         if(sd.s_is_on(xn-1, yn-2, false)) ur = true;
+         if(sd.s_is_on(xn,   yn-2, false)) ul = true;
+         if(sd.s_is_on(xn,   yn-1, false)) ll = true;
 
-}
+         yn -= 1;
+         break;
 
-///////////////////////////////////////////////////////////////////////////////
+      default:
+         mlog << Error << "\nboundary_step() -> "
+              << "bad direction: " << direction << "\n\n";
+         exit(1);
+         break;
+   }
 
+   //
+   // Determine the direction to head by the combination of lr, ur, ul, and ll
+   //
+   switch(get_step_case(lr, ur, ul, ll)) {
 
-void Cell::init_from_scratch()
+      case ll_case:
+      case lr_ul_case:
+      case lr_ur_ul_case:
+         // Turn left
+         direction = (direction + 1)%4;
+         if(direction < 0) direction += 4;
+         break;
 
-{
+      case lr_case:
+      case ur_ll_case:
+      case ur_ul_ll_case:
+         // Turn right
+         direction = (direction - 1)%4;
+         if(direction < 0) direction += 4;
+         break;
 
-e = 0;
+      case ul_ll_case:
+      case lr_ur_case:
+         // Continue straight: direction remains unchanged
+         break;
 
-clear();
+      default:
 
-return;
+         mlog << Error << "\nboundary_step() -> "
+              << "bad step case: "
+              << get_step_case(lr, ur, ul, ll) << "\n\n";
+         exit(1);
+         break;
+   }
 
+   return;
 }
 
+////////////////////////////////////////////////////////////////////////
 
-///////////////////////////////////////////////////////////////////////////////
+int get_step_case(bool lr, bool ur, bool ul, bool ll) {
 
-void Cell::clear()
+   //
+   // Valid cases with exactly one cell on
+   //
 
-{
+   // Lower Left
+   if(!lr && !ur && !ul && ll) return(ll_case);
+   // Lower Right
+   else if(lr && !ur && !ul && !ll) return(lr_case);
 
-if ( e )  { delete [] e;  e = (int *) 0; }
+   //
+   // Valid cases with exactly two cells on
+   //
 
-n = 0;
+   // Upper Left, Lower Left
+   else if(!lr && !ur && ul && ll) return(ul_ll_case);
+   // Lower Right, Upper Right
+   else if(lr && ur && !ul && !ll) return(lr_ur_case);
+   // Lower Right, Upper Left
+   else if(lr && !ur && ul && !ll) return(lr_ul_case);
+   // Upper Right, Lower Left
+   else if(!lr && ur && !ul && ll) return(ur_ll_case);
 
-n_alloc = 0;
+   //
+   // Valid cases with exactly three cells on
+   //
 
-return;
+   // Upper Right, Upper Left, Lower Left
+   else if(!lr && ur && ul && ll) return(ur_ul_ll_case);
+   // Lower Right, Upper Right, Upper Left
+   else if(lr && ur && ul && !ll) return(lr_ur_ul_case);
+
+   //
+   // Otherwise, combination is invalid
+   //
+   else {
+      mlog << Error << "\nget_step_case() -> "
+           << "invalid combination: (lr, ur, ul, ll) = (" << lr << ", "
+           << ur << ", " << ul << ", " << ll << ")\n\n";
+      exit(1);
+   }
 
+   return(-1);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void Cell::assign(const Cell & c)
+void apply_mask(ShapeData &f, ShapeData &mask)
 
 {
+   int x, y;
 
-int j;
-
-clear();
-
-if ( c.n == 0 )  return;
-
-extend(c.n);
+   if(f.data.nx() != mask.data.nx() ||
+      f.data.ny() != mask.data.ny() ) {
 
-for (j=0; j<(c.n); ++j)  e[j] = c.e[j];
+      mlog << Error << "\napply_mask() -> "
+           << "grid dimensions do not match\n\n";
+      exit(1);
+   }
 
-n = c.n;
+   for(x=0; x<f.data.nx(); x++) {
+      for(y=0; y<f.data.ny(); y++) {
 
-return;
+         //
+         // Put bad data everywhere the mask is turned off
+         //
+         if(!mask.s_is_on(x, y)) f.data.set(bad_data_float, x, y);
+      }
+   }
 
+   return;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-
-void Cell::extend(int N)
+int ShapeData::n_objects() const
 
 {
+   int n;
+   ShapeData sd;
 
-if ( n_alloc >= N )  return;
-
-N = (N + cell_alloc_inc - 1)/cell_alloc_inc;
-
-N *= cell_alloc_inc;
-
-int j;
-int * u = 0;
-
-u = new int [N];
-
-for (j=0; j<n; ++j)  u[j] = e[j];
-
-for (j=n; j<N; ++j)  u[j] = -1;
+   // Split the field to number the shapes
+   sd = split(*this, n);
 
-if ( e )  { delete [] e;  e = 0; }
+   return(n);
+}
 
-e = u;
+///////////////////////////////////////////////////////////////////////////////
 
-n_alloc = N;
+void ShapeData::threshold(SingleThresh t) {
+   int j, x, y;
+   double v;
+   const int nx = data.nx();
+   const int ny = data.ny();
 
    //
-   //  done
+   // Compare the threshold double value to the double values for the
+   // ShapeData field
    //
+   for(x=0; x<nx; x++) {
+      for(y=0; y<ny; y++) {
 
-return;
-
-}
-
-
-///////////////////////////////////////////////////////////////////////////////
-
-bool Cell::has(int k) const
-
-{
-
-int j;
-
-for (j=0; j<n; ++j) {
-
-   if ( e[j] == k )  return ( true );
-
-}
-
-return ( false );
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void Cell::add(int k)
-
-{
-
-if ( has(k) )  return;
-
-extend(n + 1);
-
-e[n++] = k;
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-//
-//  End Code for class Cell
-//
-///////////////////////////////////////////////////////////////////////////////
-
-///////////////////////////////////////////////////////////////////////////////
-//
-//  Begin Code for class Partition
-//
-///////////////////////////////////////////////////////////////////////////////
-
-Partition::Partition()
-
-{
-
-init_from_scratch();
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-Partition::~Partition()
-
-{
-
-clear();
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-Partition::Partition(const Partition & p)
-
-{
-
-init_from_scratch();
-
-assign(p);
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-Partition & Partition::operator=(const Partition & p)
-
-{
-
-if ( this == &p )  return ( * this );
-
-assign(p);
-
-return ( * this );
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-
-void Partition::init_from_scratch()
-
-{
-
-c = (Cell **) 0;
-
-clear();
-
-return;
-
-}
-
-
-///////////////////////////////////////////////////////////////////////////////
-
-void Partition::clear()
-
-{
-
-int j;
-
-if ( c )  {
-
-   for (j=0; j<n_alloc; ++j)  {
-
-     if ( c[j] )  { delete c[j];  c[j] = (Cell *) 0; }
-
-   }
-
-   delete [] c;  c = (Cell **) 0;
-
-}
-
-n = 0;
-
-n_alloc = 0;
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void Partition::assign(const Partition & p)
-
-{
-
-clear();
-
-if ( !(p.c) )  return;
-
-int j;
-
-extend(p.n);
-
-for (j=0; j<(p.n); ++j)  {
-
-   c[j] = new Cell;
-
-   *(c[j]) = *(p.c[j]);
-
-}
-
-n = p.n;
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-
-void Partition::extend(int N)
-
-{
-
-if ( N <= n_alloc )  return;
-
-Cell ** u = (Cell **) 0;
-
-N = partition_alloc_inc*((N + partition_alloc_inc - 1)/partition_alloc_inc);
-
-u = new Cell * [N];
-
-memset(u, 0, N*(sizeof(Cell *)));
-
-if ( c )  {
-
-   int j;
-
-   for(j=0; j<n; ++j)  u[j] = c[j];
-
-   delete [] c;  c = (Cell **) 0;
-
-}
-
-
-c = u;  u = (Cell **) 0;
-
-n_alloc = N;
-
-
-
-return;
-
-}
-
-
-///////////////////////////////////////////////////////////////////////////////
-
-bool Partition::has(int k) const
-
-{
-
-int j;
-
-for (j=0; j<n; ++j) {
-
-   if ( c[j]->has(k) )  return ( true );
-
-}
-
-return ( false );
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-int Partition::which_cell(int k) const
-
-{
-
-int j;
-
-for (j=0; j<n; ++j) {
-
-   if ( c[j]->has(k) )  return ( j );
-
-}
-
-return ( -1 );
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void Partition::merge_cells(int j_1, int j_2)
-
-{
-
-int k, nn;
-int j_min, j_max;
-
-
-if ( (j_1 < 0) || (j_1 >= n) || (j_2 < 0) || (j_2 >= n) ) {
-
-   mlog << Error
-        << "\nPartition::merge_cells() -> "
-        << "range check error\n\n";
-
-   exit(1);
-
-}
-
-if ( j_1 == j_2 )  return;
-
-
-
-if ( j_1 < j_2 ) {
-
-   j_min = j_1;
-   j_max = j_2;
-
-} else {
-
-   j_min = j_2;
-   j_max = j_1;
-
-}
-
-nn = c[j_max]->n;
-
-for (k=0; k<nn; ++k) {
-
-   c[j_min]->add(c[j_max]->e[k]);
-
-}
-
-*(c[j_max]) = *(c[n - 1]);
-
-c[n - 1]->clear();
-
---n;
-
-   //
-   //  done
-   //
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void Partition::merge_values(int v1, int v2)
-
-{
-
-int j_1, j_2;
-
-if ( v1 == v2 )  return;
-
-j_1 = which_cell(v1);
-j_2 = which_cell(v2);
-
-if ( (j_1 < 0) || (j_2 < 0) ) {
-
-   mlog << Error
-        << "\nvoid Partition::merge_values() -> "
-        << "bad values: (v1, v2) = (" << v1 << ", " << v2
-        << "), (j1, j2) = (" << j_1 << ", " << j_2 << ")\n\n";
-
-   return;
-
-}
-
-merge_cells(j_1, j_2);
-
-   //
-   //  done
-   //
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void Partition::add(int k)
-
-{
-
-if ( has(k) )  return;
-
-extend(n + 1);
-
-c[n] = new Cell;
-
-c[n]->add(k);
-
-++n;
-
-return;
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-//
-//  End Code for class Partition
-//
-///////////////////////////////////////////////////////////////////////////////
-
-///////////////////////////////////////////////////////////////////////////////
-//
-//  Begin Code for Miscellaneous Functions
-//
-///////////////////////////////////////////////////////////////////////////////
-
-double dot(double x_1, double y_1, double x_2, double y_2)
-
-{
-
-double d;
-
-d = x_1*x_2 + y_1*y_2;
-
-return ( d );
-
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void boundary_step(const ShapeData &sd, int &xn, int &yn, int &direction) {
-   bool lr, ur, ul, ll;
-
-   lr = ur = ul = ll = false;
-
-   //
-   // Based on the direction of travel turn on/off lr, ur, ul, ll cells
-   //
-   switch(direction) {
-
-      case(plus_x):
-         if(sd.s_is_on(xn,   yn-1, false)) lr = true;
-         if(sd.s_is_on(xn+1, yn-1, false)) ur = true;
-         if(sd.s_is_on(xn+1, yn  , false)) ul = true;
-         if(sd.s_is_on(xn,   yn  , false)) ll = true;
-
-         xn += 1;
-         break;
-
-      case(plus_y):
-         if(sd.s_is_on(xn,   yn  , false)) lr = true;
-         if(sd.s_is_on(xn,   yn+1, false)) ur = true;
-         if(sd.s_is_on(xn-1, yn+1, false)) ul = true;
-         if(sd.s_is_on(xn-1, yn  , false)) ll = true;
-
-         yn += 1;
-         break;
-
-      case(minus_x):
-         if(sd.s_is_on(xn-1, yn  , false)) lr = true;
-         if(sd.s_is_on(xn-2, yn  , false)) ur = true;
-         if(sd.s_is_on(xn-2, yn-1, false)) ul = true;
-         if(sd.s_is_on(xn-1, yn-1, false)) ll = true;
-
-         xn -= 1;
-         break;
-
-      case(minus_y):
-         if(sd.s_is_on(xn-1, yn-1, false)) lr = true;
-         if(sd.s_is_on(xn-1, yn-2, false)) ur = true;
-         if(sd.s_is_on(xn,   yn-2, false)) ul = true;
-         if(sd.s_is_on(xn,   yn-1, false)) ll = true;
-
-         yn -= 1;
-         break;
-
-      default:
-         mlog << Error << "\nboundary_step() -> "
-              << "bad direction: " << direction << "\n\n";
-         exit(1);
-         break;
-   }
-
-   //
-   // Determine the direction to head by the combination of lr, ur, ul, and ll
-   //
-   switch(get_step_case(lr, ur, ul, ll)) {
-
-      case ll_case:
-      case lr_ul_case:
-      case lr_ur_ul_case:
-         // Turn left
-         direction = (direction + 1)%4;
-         if(direction < 0) direction += 4;
-         break;
-
-      case lr_case:
-      case ur_ll_case:
-      case ur_ul_ll_case:
-         // Turn right
-         direction = (direction - 1)%4;
-         if(direction < 0) direction += 4;
-         break;
-
-      case ul_ll_case:
-      case lr_ur_case:
-         // Continue straight: direction remains unchanged
-         break;
-
-      default:
-
-         mlog << Error << "\nboundary_step() -> "
-              << "bad step case: "
-              << get_step_case(lr, ur, ul, ll) << "\n\n";
-         exit(1);
-         break;
-   }
-
-   return;
-}
-
-////////////////////////////////////////////////////////////////////////
-
-int get_step_case(bool lr, bool ur, bool ul, bool ll) {
-
-   //
-   // Valid cases with exactly one cell on
-   //
-
-   // Lower Left
-   if(!lr && !ur && !ul && ll) return(ll_case);
-   // Lower Right
-   else if(lr && !ur && !ul && !ll) return(lr_case);
-
-   //
-   // Valid cases with exactly two cells on
-   //
-
-   // Upper Left, Lower Left
-   else if(!lr && !ur && ul && ll) return(ul_ll_case);
-   // Lower Right, Upper Right
-   else if(lr && ur && !ul && !ll) return(lr_ur_case);
-   // Lower Right, Upper Left
-   else if(lr && !ur && ul && !ll) return(lr_ul_case);
-   // Upper Right, Lower Left
-   else if(!lr && ur && !ul && ll) return(ur_ll_case);
-
-   //
-   // Valid cases with exactly three cells on
-   //
-
-   // Upper Right, Upper Left, Lower Left
-   else if(!lr && ur && ul && ll) return(ur_ul_ll_case);
-   // Lower Right, Upper Right, Upper Left
-   else if(lr && ur && ul && !ll) return(lr_ur_ul_case);
-
-   //
-   // Otherwise, combination is invalid
-   //
-   else {
-      mlog << Error << "\nget_step_case() -> "
-           << "invalid combination: (lr, ur, ul, ll) = (" << lr << ", "
-           << ur << ", " << ul << ", " << ll << ")\n\n";
-      exit(1);
-   }
-
-   return(-1);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void apply_mask(ShapeData &f, ShapeData &mask)
-
-{
-   int x, y;
-
-   if(f.data.nx() != mask.data.nx() ||
-      f.data.ny() != mask.data.ny() ) {
-
-      mlog << Error << "\napply_mask() -> "
-           << "grid dimensions do not match\n\n";
-      exit(1);
-   }
-
-   for(x=0; x<f.data.nx(); x++) {
-      for(y=0; y<f.data.ny(); y++) {
-
-         //
-         // Put bad data everywhere the mask is turned off
-         //
-         if(!mask.s_is_on(x, y)) f.data.set(bad_data_float, x, y);
-      }
-   }
-
-   return;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-int ShapeData::n_objects() const
-
-{
-   int n;
-   ShapeData sd;
-
-   // Split the field to number the shapes
-   sd = split(*this, n);
-
-   return(n);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-
-void ShapeData::threshold(SingleThresh t) {
-   int j, x, y;
-   double v;
-   const int nx = data.nx();
-   const int ny = data.ny();
-
-   //
-   // Compare the threshold double value to the double values for the
-   // ShapeData field
-   //
-   for(x=0; x<nx; x++) {
-      for(y=0; y<ny; y++) {
-
-         v = data(x, y);
+         v = data(x, y);
 
          if(t.check(v) && ! ::is_bad_data(v)) {
             j = 1;
@@ -2175,15 +1625,23 @@ ShapeData split(const ShapeData & wfd, int & n_shapes)
 
 {
 
-int k, x, y;
-int s;
+int j, k, x, y;
 int xx, yy, nx, ny;
-int current_shape;
+int label, nbr;
 bool shape_assigned = false;
-ShapeData d;
 ShapeData out = wfd;
 ShapeData fat = wfd;
-Partition p;
+UnionFind uf;
+vector<int> d;
+vector<int> shape;
+
+   //
+   //  neighbors already labeled:  above left, above,
+   //  upper right, and to the right
+   //
+
+static const int nbr_dx[] = { -1, 0, 1, 1 };
+static const int nbr_dy[] = {  1, 1, 1, 0 };
 
 
 if ( do_split_fatten )  fat.expand(split_enlarge);
@@ -2192,164 +1650,101 @@ if ( do_split_fatten )  fat.expand(split_enlarge);
 nx = fat.data.nx();
 ny = fat.data.ny();
 
-d.data.set_size(nx, ny);
+const vector<dataplane_t> & f = fat.data.buf();
+
+d.assign(nx*ny, 0);
 
 n_shapes = 0;
 
+   //
+   //  first pass:  provisional labels, with touching labels
+   //  merged into one set
    //
    //  shape numbers start at ONE here!!
    //
 
-current_shape = 0;
+for (y=(ny - 2); y>=0; --y) {
 
-for (y=(fat.data.ny() - 2); y>=0; --y) {
+   for (x=(nx - 2); x>=0; --x) {
 
-   for (x=(fat.data.nx() - 2); x>=0; --x) {
+      if ( !(f[y*nx + x] > 0.0) ) continue;
 
-      s = fat.s_is_on(x, y);
-
-      if ( !s ) continue;
+      label = 0;
 
       shape_assigned = false;
 
-         //
-         //  check above left
-         //
-
-      xx = x - 1;
-      yy = y + 1;
-
-      if ( (xx >= 0) && (yy < ny) ) {
-
-         s = fat.s_is_on(xx, yy);
-
-         if ( s ) {
-
-            if ( shape_assigned )
-               p.merge_values(nint(d.data(x, y)), nint(d.data(xx, yy)));
-            else
-               d.data.set(d.data(xx, yy), x, y);
-
-            shape_assigned = true;
-
-         }
-
-      }
-
-         //
-         //  check above
-         //
-
-      xx = x;
-      yy = y + 1;
-
-      if ( yy < ny ) {
-
-         s = fat.s_is_on(xx, yy);
-
-         if ( s ) {
-
-            if ( shape_assigned )
-               p.merge_values(nint(d.data(x, y)), nint(d.data(xx, yy)));
-            else
-               d.data.set(d.data(xx, yy), x, y);
-
-            shape_assigned = true;
+      for (k=0; k<4; ++k) {
 
-         }
+         xx = x + nbr_dx[k];
+         yy = y + nbr_dy[k];
 
-      }
+         if ( (xx < 0) || (xx >= nx) || (yy >= ny) ) continue;
 
-         //
-         //  check upper right
-         //
+         if ( !(f[yy*nx + xx] > 0.0) ) continue;
 
-      xx = x + 1;
-      yy = y + 1;
+         nbr = d[yy*nx + xx];
 
-      if ( (xx < nx) && (yy < ny) ) {
+         if ( shape_assigned ) {
 
-         s = fat.s_is_on(xx, yy);
+            if ( (label > 0) && (nbr > 0) )  uf.merge(label, nbr);
 
-         if ( s ) {
+         } else {
 
-            if ( shape_assigned )
-               p.merge_values(nint(d.data(x, y)), nint(d.data(xx, yy)));
-            else
-               d.data.set(d.data(xx, yy), x, y);
+            label = nbr;
 
-            shape_assigned = true;
          }
-      }
-
-         //
-         //  check to the right
-         //
 
-      xx = x + 1;
-      yy = y;
+         shape_assigned = true;
 
-      if ( xx < nx ) {
-
-         s = fat.s_is_on(xx, yy);
-
-         if ( s ) {
-
-            if ( shape_assigned )
-               p.merge_values(nint(d.data(x, y)), nint(d.data(xx, yy)));
-            else
-               d.data.set(d.data(xx, yy), x, y);
-
-            shape_assigned = true;
-         }
       }
 
          //
          //  is it a new shape?
          //
 
-      if ( !shape_assigned ) {
-
-         d.data.set(++current_shape, x, y);
+      if ( !shape_assigned )  label = uf.add();
 
-         p.add(nint(d.data(x, y)));
-
-      }
+      d[y*nx + x] = label;
 
    } // for x
 
 } // for y
 
 
-if ( do_split_fatten )  d.shrink(split_enlarge);
+     ///////////////////////////////////
 
+   //
+   //  second pass:  replace each provisional label by the
+   //  number of its set, dropping the border added above
+   //
 
-     ///////////////////////////////////
+shape.assign(uf.n_labels() + 1, 0);
 
-nx = wfd.data.nx();
-ny = wfd.data.ny();
+for (j=1; j<=uf.n_labels(); ++j)  shape[j] = uf.set_index(j) + 1;
 
-for (x=0; x<nx; ++x) {
+const int w = ( do_split_fatten ? split_enlarge : 0 );
+const int nx_fat = nx;
 
-   for (y=0; y<ny; ++y) {
+nx = wfd.data.nx();
+ny = wfd.data.ny();
 
-      out.data.set(0, x, y);
+vector<dataplane_t> & o = out.data.buf();
 
-      for (k=0; k<(p.n); ++k) {
+for (y=0; y<ny; ++y) {
 
-         if ( p.c[k]->has(nint(d.data(x, y))) )   out.data.set(k + 1, x, y);
+   for (x=0; x<nx; ++x) {
 
-      }
+      o[y*nx + x] = shape[d[(y + w)*nx_fat + (x + w)]];
 
-   } // for y
+   } // for x
 
-} // for x
+} // for y
 
 
      ///////////////////////////////////
 
 
-n_shapes = p.n;
+n_shapes = uf.n_sets();
 
 out.calc_moments();
 
@@ -2458,3 +1853,154 @@ int ShapeData_intersection(const ShapeData &f1, const ShapeData &f2) {
 //  End Code for Miscellaneous Functions
 //
 ///////////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+void conv_circ_sums_task(void *data, int, int i_beg, int i_end)
+
+{
+
+ConvCircInfo *info = (ConvCircInfo *) data;
+int x, y, n;
+double cur;
+bool ok, fin;
+
+for (y=i_beg; y<i_end; ++y)  {
+
+   const dataplane_t *row = info->in + y*info->nx;
+
+   n = y*(info->nx + 1);
+
+   info->vld[n]  = 0;
+   info->sum[n]  = 0.0;
+   info->nfin[n] = 0;
+
+   for (x=0; x<(info->nx); ++x, ++n)  {
+
+      cur = row[x];
+
+      ok  = !::is_bad_data(cur);
+      fin = ok && isfinite(cur);
+
+      info->vld[n + 1]  = info->vld[n] + ok;
+      info->sum[n + 1]  = info->sum[n] + (fin ? cur : 0.0);
+      info->nfin[n + 1] = info->nfin[n] + (ok && !fin);
+
+   }
+
+}
+
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
+void conv_circ_task(void *data, int, int i_beg, int i_end)
+
+{
+
+ConvCircInfo *info = (ConvCircInfo *) data;
+int x, y, v, yy, h, x0, x1, n, xx;
+int count, bd_count;
+double center, sum, cur;
+double vld_ratio;
+bool center_bad = false;
+const int nx = info->nx;
+const int ny = info->ny;
+const int radius = info->radius;
+
+for (y=i_beg; y<i_end; ++y)  {
+
+   for (x=0; x<nx; ++x)  {
+
+         //
+         // If the bad data threshold is set to zero and the center of the
+         // convolution radius contains bad data, set the convolved value to
+         // bad data and continue.
+         //
+
+      center = info->in[STANDARD_XY_YO_N(nx, x, y)];
+
+      center_bad = ::is_bad_data(center);
+
+      if ( center_bad && info->vld_thresh_one ) {
+         info->out[STANDARD_XY_YO_N(nx, x, y)] = bad_data_double;
+         continue;
+      }
+
+      sum      = 0.0;
+      count    = 0;
+      bd_count = 0;
+
+         //
+         //  add up the chord of the circle in each row,
+         //  clipped to the grid
+         //
+
+      for (v=-radius; v<=radius; ++v) {
+
+         yy = y + v;
+
+         if ( (yy < 0) || (yy >= ny) )  continue;
+
+         h = info->chord[v + radius];
+
+         x0 = max(x - h, 0);
+         x1 = min(x + h + 1, nx);
+
+         if ( x0 >= x1 )  continue;
+
+         n = yy*(nx + 1);
+
+         count    += info->vld[n + x1] - info->vld[n + x0];
+         bd_count += x1 - x0;
+
+         if ( info->nfin[n + x1] == info->nfin[n + x0] )  {
+            sum += info->sum[n + x1] - info->sum[n + x0];
+            continue;
+         }
+
+         for (xx=x0; xx<x1; ++xx)  {
+            cur = info->in[STANDARD_XY_YO_N(nx, xx, yy)];
+            if ( !::is_bad_data(cur) )  sum += cur;
+         }
+
+      } // for v
+
+      bd_count -= count;
+
+         //
+         //  If the center of the convolution contains bad data and the ratio
+         //  of bad data in the convolution area is too high, set the convoled
+         //  value to bad data.
+         //
+
+      if ( count == 0 )  sum = bad_data_double;
+      else {
+
+         vld_ratio = ((double) count)/(bd_count + count);
+
+         if ( center_bad && (vld_ratio < info->vld_thresh) )  sum = bad_data_double;
+         else                                                 sum /= count;
+
+      }
+
+      info->out[STANDARD_XY_YO_N(nx, x, y)] = (dataplane_t) sum;
+
+   } // for x
+
+} // for y
+
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+
@@ -195,122 +195,6 @@ inline bool ShapeData::is_nonzero (int x, int y) const { return ( ! is_eq(data(x
 ///////////////////////////////////////////////////////////////////////////////
 
 
-static const int      cell_alloc_inc = 500;
-
-static const int partition_alloc_inc = 500;
-
-
-///////////////////////////////////////////////////////////////////////////////
-
-
-class Cell {
-
-   public:
-
-      void init_from_scratch();
-
-      void assign(const Cell &);
-
-      void extend(int);
-
-
-      int * e;
-
-      int n;
-
-      int n_alloc;
-
-
-   public:
-
-      Cell();
-     ~Cell();
-      Cell(const Cell &);
-      Cell & operator=(const Cell &);
-
-      void clear();
-
-         //
-         //  set stuff
-         //
-
-         //
-         //  get stuff
-         //
-
-      bool has(int) const;
-
-         //
-         //  do stuff
-         //
-
-      void add(int);
-
-
-};
-
-
-///////////////////////////////////////////////////////////////////////////////
-
-
-extern ostream & operator<<(ostream &, const Cell &);
-
-
-///////////////////////////////////////////////////////////////////////////////
-
-
-class Partition {
-
-   public:
-
-      void init_from_scratch();
-
-      void assign(const Partition &);
-
-      void extend(int);
-
-
-      Cell ** c;
-
-      int n;
-
-      int n_alloc;
-
-   public:
-
-      Partition();
-     ~Partition();
-      Partition(const Partition &);
-      Partition & operator=(const Partition &);
-
-      void clear();
-
-         //
-         //  set stuff
-         //
-
-         //
-         //  get stuff
-         //
-
-      bool has(int) const;
-
-      int which_cell(int) const;
-
-         //
-         //  do stuff
-         //
-
-      void merge_cells(int, int);
-      void merge_values(int, int);
-
-      void add(int);
-
-};
-
-///////////////////////////////////////////////////////////////////////////////
-
-
 extern int ShapeData_intersection(const ShapeData &, const ShapeData &);
 
 extern ShapeData select(const ShapeData &, int);
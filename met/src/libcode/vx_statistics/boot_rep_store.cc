@@ -0,0 +1,287 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <stdlib.h>
+#include <string.h>
+
+#include "boot_rep_store.h"
+
+#include "vx_util.h"
+#include "vx_math.h"
+#include "vx_log.h"
+
+////////////////////////////////////////////////////////////////////////
+
+//
+// Number of records read at once when extracting a statistic
+// from a replicate store that was spilled to disk
+//
+
+static const int boot_rep_read_block = 4096;
+
+//
+// Bytes held in memory by all replicate stores
+//
+
+static atomic<long long> boot_mem_in_use(0);
+
+////////////////////////////////////////////////////////////////////////
+
+static long long parse_boot_mem_limit();
+
+static bool reserve_boot_mem(long long);
+
+////////////////////////////////////////////////////////////////////////
+//
+// Code for class BootRepStore
+//
+////////////////////////////////////////////////////////////////////////
+
+BootRepStore::BootRepStore() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+BootRepStore::~BootRepStore() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void BootRepStore::init_from_scratch() {
+
+   OnDisk   = false;
+   MemBytes = 0;
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void BootRepStore::clear() {
+
+   NStat = 0;
+   NRep  = 0;
+
+   Data.clear();
+
+   boot_mem_in_use -= MemBytes;
+   MemBytes = 0;
+
+   if(OnDisk) {
+      if(File.is_open()) File.close();
+      remove_temp_file(FileName);
+   }
+
+   OnDisk = false;
+   FileName.clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void BootRepStore::set_size(int n_stat, int n_rep,
+                            const char *tmp_dir, const char *prefix) {
+   ConcatString cs;
+   long long n_bytes;
+
+   clear();
+
+   if(n_stat < 0 || n_rep < 0) {
+      mlog << Error << "\nBootRepStore::set_size() -> "
+           << "bad size requested (" << n_stat << " x " << n_rep
+           << ")!\n\n";
+      exit(1);
+   }
+
+   NStat = n_stat;
+   NRep  = n_rep;
+
+   n_bytes = (long long) NStat * NRep * sizeof(double);
+
+   //
+   // Keep the values in memory when they fit within the limit
+   //
+   if(reserve_boot_mem(n_bytes)) {
+      MemBytes = n_bytes;
+      Data.assign((size_t) NStat * NRep, bad_data_double);
+      return;
+   }
+
+   //
+   // Otherwise, spill the records to a binary temp file
+   //
+   cs << cs_erase << tmp_dir << "/" << prefix;
+   FileName = make_temp_file_name(cs.c_str(), NULL);
+
+   File.open(FileName.c_str(),
+             ios::in | ios::out | ios::binary | ios::trunc);
+
+   if(!File) {
+      mlog << Error << "\nBootRepStore::set_size() -> "
+           << "can't open the temporary file for writing:\n"
+           << FileName << "\n\n";
+      exit(1);
+   }
+
+   OnDisk = true;
+
+   mlog << Debug(4) << "Bootstrap replicate store (" << NStat << " x "
+        << NRep << ") does not fit within the " << met_boot_mem_limit_env
+        << " limit and is written to temp file: " << FileName << "\n";
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void BootRepStore::set_rep(int i_rep, const double *vals) {
+   int i;
+
+   if(i_rep < 0 || i_rep >= NRep) {
+      mlog << Error << "\nBootRepStore::set_rep() -> "
+           << "range check error: " << i_rep << " not in [0, "
+           << NRep << ")!\n\n";
+      exit(1);
+   }
+
+   if(OnDisk) {
+      lock_guard<mutex> lock(FileMutex);
+      File.seekp((streamoff) i_rep * NStat * sizeof(double));
+      File.write((const char *) vals, NStat * sizeof(double));
+      if(!File) {
+         mlog << Error << "\nBootRepStore::set_rep() -> "
+              << "error writing to temporary file: " << FileName
+              << "\n\n";
+         exit(1);
+      }
+   }
+   else {
+      for(i=0; i<NStat; i++) Data[(size_t) i*NRep + i_rep] = vals[i];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Retrieve the valid values of a single statistic.
+//
+////////////////////////////////////////////////////////////////////////
+
+void BootRepStore::get_stat(int i_stat, NumArray &na) const {
+   int i, j, n_read;
+   const double *v = (const double *) 0;
+   vector<double> buf;
+
+   if(i_stat < 0 || i_stat >= NStat) {
+      mlog << Error << "\nBootRepStore::get_stat() -> "
+           << "range check error: " << i_stat << " not in [0, "
+           << NStat << ")!\n\n";
+      exit(1);
+   }
+
+   na.erase();
+   na.extend(NRep);
+
+   if(!OnDisk) {
+      v = Data.data() + (size_t) i_stat*NRep;
+      for(i=0; i<NRep; i++) if(!is_bad_data(v[i])) na.add(v[i]);
+      return;
+   }
+
+   //
+   // Read the records back in blocks, keeping only one column
+   //
+   File.flush();
+   File.seekg(0);
+   buf.resize((size_t) boot_rep_read_block * NStat);
+
+   for(i=0; i<NRep; i+=n_read) {
+      n_read = min(boot_rep_read_block, NRep - i);
+      File.read((char *) buf.data(), (streamsize) n_read * NStat * sizeof(double));
+      if(!File) {
+         mlog << Error << "\nBootRepStore::get_stat() -> "
+              << "error reading from temporary file: " << FileName
+              << "\n\n";
+         exit(1);
+      }
+      for(j=0; j<n_read; j++) {
+         if(!is_bad_data(buf[(size_t) j*NStat + i_stat])) {
+            na.add(buf[(size_t) j*NStat + i_stat]);
+         }
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Maximum number of bytes all replicate stores together may hold in
+// memory, read once from the MET_BOOT_MEM_LIMIT environment variable (MB).
+//
+////////////////////////////////////////////////////////////////////////
+
+long long boot_mem_limit_bytes() {
+   static const long long limit = parse_boot_mem_limit();
+
+   return(limit);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+long long parse_boot_mem_limit() {
+   ConcatString cs;
+   int mb = default_boot_mem_limit;
+
+   if(get_env(met_boot_mem_limit_env, cs)) {
+      mb = atoi(cs.c_str());
+      if(mb < 0) {
+         mlog << Warning << "\nparse_boot_mem_limit() -> "
+              << "ignoring negative " << met_boot_mem_limit_env
+              << " value (" << cs << ") and using the default of "
+              << default_boot_mem_limit << " MB.\n\n";
+         mb = default_boot_mem_limit;
+      }
+   }
+
+   return((long long) mb * 1024 * 1024);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Count n_bytes against the shared limit, if they fit.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool reserve_boot_mem(long long n_bytes) {
+   long long in_use = boot_mem_in_use.load();
+
+   do {
+      if(in_use + n_bytes > boot_mem_limit_bytes()) return(false);
+   } while(!boot_mem_in_use.compare_exchange_weak(in_use, in_use + n_bytes));
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
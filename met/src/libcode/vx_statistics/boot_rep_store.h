@@ -0,0 +1,110 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2020
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __BOOT_REP_STORE_H__
+#define  __BOOT_REP_STORE_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include "vx_util.h"
+
+////////////////////////////////////////////////////////////////////////
+
+//
+// Environment variable and default value for the maximum amount of
+// memory, in megabytes, all replicate stores together may use.  A store
+// that doesn't fit in what remains spills its values to a temporary file.
+//
+
+static const char met_boot_mem_limit_env[] = "MET_BOOT_MEM_LIMIT";
+static const int  default_boot_mem_limit   = 512;
+
+////////////////////////////////////////////////////////////////////////
+//
+// Storage for the statistics computed from bootstrap replicates or
+// jackknife (leave-one-out) samples.  Values are stored as one
+// contiguous array per statistic so that each can be handed directly
+// to the interval computations.  When the requested size exceeds the
+// memory left within the shared limit, records are written to a binary
+// temp file instead.  Distinct records may be set concurrently from
+// multiple threads.
+//
+////////////////////////////////////////////////////////////////////////
+
+class BootRepStore {
+
+   private:
+
+      void init_from_scratch();
+
+         //
+         //  not copyable
+         //
+
+      BootRepStore(const BootRepStore &);
+      BootRepStore & operator=(const BootRepStore &);
+
+      int NStat;                    // Number of statistics per record
+      int NRep;                     // Number of records
+
+      std::vector<double> Data;     // Statistic-major: Data[i_stat*NRep + i_rep]
+      long long MemBytes;           // Bytes of Data counted against the limit
+
+      bool         OnDisk;
+      ConcatString FileName;
+      mutable fstream File;
+      std::mutex   FileMutex;     // Serializes writes to File
+
+   public:
+
+      BootRepStore();
+     ~BootRepStore();
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+      void set_size(int n_stat, int n_rep,
+                    const char *tmp_dir, const char *prefix);
+
+      void set_rep(int i_rep, const double *vals);
+
+         //
+         //  get stuff
+         //
+
+      int  n_stat()  const;
+      int  n_rep()   const;
+      bool on_disk() const;
+
+      void get_stat(int i_stat, NumArray &) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int  BootRepStore::n_stat()  const { return(NStat);  }
+inline int  BootRepStore::n_rep()   const { return(NRep);   }
+inline bool BootRepStore::on_disk() const { return(OnDisk); }
+
+////////////////////////////////////////////////////////////////////////
+
+extern long long boot_mem_limit_bytes();
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   // __BOOT_REP_STORE_H__
+
+////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@ using namespace std;
 
 #include "compute_ci.h"
 #include "compute_stats.h"
+#include "boot_rep_store.h"
 
 #include "vx_gsl_prob.h"
 #include "vx_util.h"
@@ -30,11 +31,71 @@ using namespace std;
 
 ////////////////////////////////////////////////////////////////////////
 
-static void write_cntinfo(ofstream &, const CNTInfo &);
-static void write_ctsinfo(ofstream &, const CTSInfo &);
-static void write_mctsinfo(ofstream &, const MCTSInfo &);
-static void write_nbrcntinfo(ofstream &, const NBRCNTInfo &);
-static void read_ldf(const ConcatString, int, NumArray &);
+//
+// Number of statistics stored for each replicate
+//
+
+static const int n_cnt_boot_stat    = 24;
+static const int n_cts_boot_stat    = 20;
+static const int n_mcts_boot_stat   =  4;
+static const int n_nbrcnt_boot_stat =  6;
+
+//
+// Cells of a 2x2 contingency table: fy_oy, fy_on, fn_oy, fn_on
+//
+
+static const int n_cts_jack_cell    =  4;
+
+////////////////////////////////////////////////////////////////////////
+
+static void store_cntinfo(BootRepStore &, int, const CNTInfo &);
+static void store_ctsinfo(BootRepStore &, int, const CTSInfo &);
+static void store_mctsinfo(BootRepStore &, int, const MCTSInfo &);
+static void store_nbrcntinfo(BootRepStore &, int, const NBRCNTInfo &);
+
+static double percentile_skip(const vector<double> &, int, double);
+
+////////////////////////////////////////////////////////////////////////
+//
+// Shared, read-only inputs for the jackknife and bootstrap tasks.
+// Each task writes only the records of the replicate stores in its
+// own index range.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct BootTaskInfo {
+   const PairDataPoint *pd;        // Matched pairs
+   const PairDataPoint *pd_thr;    // Thresholded pairs (nbrcnt only)
+   NumArray            *i_na;      // Indices to be resampled
+   const gsl_rng      **rng;       // One random number stream per thread
+   int                  m;         // Size of each replicate
+   bool                 precip_flag;
+   int                  n_info;    // Number of CTSInfo objects
+   const CTSInfo       *cts_info;  // Full sample CTSInfo objects
+   const MCTSInfo      *mcts_info; // Full sample MCTSInfo object
+   const CNTJackSums   *cnt_sums;
+   const NBRCNTJackSums *nbrcnt_sums;
+   BootRepStore        *jack_rep;  // Jackknife stores (n_info for cts)
+   BootRepStore        *boot_rep;  // Bootstrap stores (n_info for cts)
+
+   BootTaskInfo() : pd(0), pd_thr(0), i_na(0), rng(0), m(0),
+                    precip_flag(false), n_info(0), cts_info(0),
+                    mcts_info(0), cnt_sums(0), nbrcnt_sums(0),
+                    jack_rep(0), boot_rep(0) {}
+};
+
+static void cts_jack_task(void *, int, int, int);
+static void cts_boot_task(void *, int, int, int);
+static void mcts_jack_task(void *, int, int, int);
+static void mcts_boot_task(void *, int, int, int);
+static void cnt_jack_task(void *, int, int, int);
+static void cnt_boot_task(void *, int, int, int);
+static void nbrcnt_jack_task(void *, int, int, int);
+static void nbrcnt_boot_task(void *, int, int, int);
+
+static void run_boot_tasks(BootTaskInfo &, const gsl_rng *,
+                           ThreadTaskFunction, int,
+                           ThreadTaskFunction, int);
 
 ////////////////////////////////////////////////////////////////////////
 //
@@ -282,15 +343,14 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
    int n = 0;
    int i, j, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
-   CTSInfo *cts_tmp = (CTSInfo *) 0;
+   NumArray i_na, si_na, sr_na;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for categorical statistics
+   // Replicate stores for categorical statistics
    //
-   ofstream *cts_i_out = (ofstream *) 0, *cts_r_out = (ofstream *) 0;
-   ConcatString *cts_i_file = (ConcatString *) 0;
-   ConcatString *cts_r_file = (ConcatString *) 0;
+   BootRepStore *cts_i_rep = (BootRepStore *) 0;
+   BootRepStore *cts_r_rep = (BootRepStore *) 0;
    ConcatString prefix;
 
    //
@@ -326,384 +386,293 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !cts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space for the replicate stores for each threshold
    //
-   cts_tmp    = new CTSInfo      [n_cts];
-   cts_i_out  = new ofstream     [n_cts];
-   cts_r_out  = new ofstream     [n_cts];
-   cts_i_file = new ConcatString [n_cts];
-   cts_r_file = new ConcatString [n_cts];
-   for(i=0; i<n_cts; i++) {
-      cts_tmp[i].fthresh = cts_info[i].fthresh;
-      cts_tmp[i].othresh = cts_info[i].othresh;
-   }
+   cts_i_rep = new BootRepStore [n_cts];
+   cts_r_rep = new BootRepStore [n_cts];
 
    //
-   // Build the temp file names
+   // Size the replicate stores for each threshold
    //
    for(i=0; i<n_cts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_cts_i_" << i;
-      cts_i_file[i] = make_temp_file_name(prefix.c_str(), NULL);
+      prefix << cs_erase << "tmp_cts_i_" << i;
+      cts_i_rep[i].set_size(n_cts_boot_stat, n, tmp_dir, prefix.c_str());
 
-      prefix << cs_erase << tmp_dir << "/tmp_cts_r_" << i;
-      cts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
+      prefix << cs_erase << "tmp_cts_r_" << i;
+      cts_r_rep[i].set_size(n_cts_boot_stat, b, tmp_dir, prefix.c_str());
    }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Compute the categorical stats from the raw data with the i-th data
+   // point removed and for each resampled replicate, splitting the
+   // work across threads
    //
-   try {
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.n_info      = n_cts;
+   info.cts_info    = cts_info;
+   info.jack_rep    = cts_i_rep;
+   info.boot_rep    = cts_r_rep;
+   run_boot_tasks(info, rng_ptr, cts_jack_task, n,
+                  cts_boot_task, b);
+
+   //
+   // Compute bootstrap intervals for each threshold value
+   //
+   for(i=0; i<n_cts; i++) {
 
       //
-      // Open up the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_cts; i++) {
-         cts_i_out[i].open(cts_i_file[i].c_str());
-         cts_r_out[i].open(cts_r_file[i].c_str());
-         if(!cts_i_out[i] || !cts_r_out[i]) {
-            mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
-                 << "can't open one or more temporary files for writing:\n"
-                 << cts_i_file[i] << "\n"
-                 << cts_r_file[i] << "\n\n";
+      c = 0;
 
-            //
-            // Attempt to delete temp files
-            //
-            for(i=0; i<n_cts; i++) {
-               remove_temp_file(cts_i_file[i]);
-               remove_temp_file(cts_r_file[i]);
-            }
+      //
+      // Compute bootstrap interval for baser
+      //
+      s = cts_info[i].baser.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].baser.v_bcl[j],
+                              cts_info[i].baser.v_bcu[j]);
 
-            // deallocate memory
-            if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-            if(cts_i_out)  { delete [] cts_i_out;  cts_i_out  = (ofstream *)     0; }
-            if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-            if(cts_i_file) { delete [] cts_i_file; cts_i_file = (ConcatString *) 0; }
-            if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
-            throw(1);
-         }
-      }
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = cts_info[i].fmean.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fmean.v_bcl[j],
+                              cts_info[i].fmean.v_bcu[j]);
 
       //
-      // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // Compute bootstrap interval for acc
       //
-      for(i=0; i<n_cts; i++) {
-         for(j=0; j<n; j++) {
-            compute_i_ctsinfo(pd, j, false, cts_tmp[i]);
-            write_ctsinfo(cts_i_out[i], cts_tmp[i]);
-         }
-      } // end for i
+      s = cts_info[i].acc.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].acc.v_bcl[j],
+                              cts_info[i].acc.v_bcu[j]);
 
       //
-      // Resample the array of indices with replacement
+      // Compute bootstrap interval for fbias
       //
-      for(i=0; i<b; i++) {
+      s = cts_info[i].fbias.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fbias.v_bcl[j],
+                              cts_info[i].fbias.v_bcu[j]);
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+      //
+      // Compute bootstrap interval for pody
+      //
+      s = cts_info[i].pody.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pody.v_bcl[j],
+                              cts_info[i].pody.v_bcu[j]);
 
-         //
-         // Compute categorical stats for each replicate with the
-         // cts_flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_cts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false, cts_tmp[j]);
-            write_ctsinfo(cts_r_out[j], cts_tmp[j]);
-         } // end for j
-      }
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = cts_info[i].podn.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].podn.v_bcl[j],
+                              cts_info[i].podn.v_bcu[j]);
 
       //
-      // Close the temp files
+      // Compute bootstrap interval for pofd
       //
-      for(i=0; i<n_cts; i++) {
-         cts_i_out[i].close();
-         cts_r_out[i].close();
-      }
+      s = cts_info[i].pofd.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pofd.v_bcl[j],
+                              cts_info[i].pofd.v_bcu[j]);
 
       //
-      // Compute bootstrap intervals for each threshold value
-      //
-      for(i=0; i<n_cts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = cts_info[i].baser.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].baser.v_bcl[j],
-                                 cts_info[i].baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = cts_info[i].fmean.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fmean.v_bcl[j],
-                                 cts_info[i].fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = cts_info[i].acc.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].acc.v_bcl[j],
-                                 cts_info[i].acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = cts_info[i].fbias.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fbias.v_bcl[j],
-                                 cts_info[i].fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = cts_info[i].pody.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pody.v_bcl[j],
-                                 cts_info[i].pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = cts_info[i].podn.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].podn.v_bcl[j],
-                                 cts_info[i].podn.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = cts_info[i].pofd.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pofd.v_bcl[j],
-                                 cts_info[i].pofd.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for far
-         //
-         s = cts_info[i].far.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].far.v_bcl[j],
-                                 cts_info[i].far.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = cts_info[i].csi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].csi.v_bcl[j],
-                                 cts_info[i].csi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = cts_info[i].gss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].gss.v_bcl[j],
-                                 cts_info[i].gss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = cts_info[i].hk.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hk.v_bcl[j],
-                                 cts_info[i].hk.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = cts_info[i].hss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hss.v_bcl[j],
-                                 cts_info[i].hss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = cts_info[i].odds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].odds.v_bcl[j],
-                                 cts_info[i].odds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = cts_info[i].lodds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].lodds.v_bcl[j],
-                                 cts_info[i].lodds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = cts_info[i].orss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].orss.v_bcl[j],
-                                 cts_info[i].orss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = cts_info[i].eds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].eds.v_bcl[j],
-                                 cts_info[i].eds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = cts_info[i].seds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].seds.v_bcl[j],
-                                 cts_info[i].seds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = cts_info[i].edi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].edi.v_bcl[j],
-                                 cts_info[i].edi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = cts_info[i].sedi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].sedi.v_bcl[j],
-                                 cts_info[i].sedi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = cts_info[i].bagss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].bagss.v_bcl[j],
-                                 cts_info[i].bagss.v_bcu[j]);
-      } // end for i
-
-   } // end try block
-
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      // Compute bootstrap interval for far
+      //
+      s = cts_info[i].far.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].far.v_bcl[j],
+                              cts_info[i].far.v_bcu[j]);
 
-      mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = cts_info[i].csi.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].csi.v_bcl[j],
+                              cts_info[i].csi.v_bcu[j]);
 
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = cts_info[i].gss.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].gss.v_bcl[j],
+                              cts_info[i].gss.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = cts_info[i].hk.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hk.v_bcl[j],
+                              cts_info[i].hk.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_cts; i++) {
-      remove_temp_file(cts_i_file[i]);
-      remove_temp_file(cts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = cts_info[i].hss.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hss.v_bcl[j],
+                              cts_info[i].hss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = cts_info[i].odds.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].odds.v_bcl[j],
+                              cts_info[i].odds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = cts_info[i].lodds.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].lodds.v_bcl[j],
+                              cts_info[i].lodds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = cts_info[i].orss.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].orss.v_bcl[j],
+                              cts_info[i].orss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = cts_info[i].eds.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].eds.v_bcl[j],
+                              cts_info[i].eds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = cts_info[i].seds.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].seds.v_bcl[j],
+                              cts_info[i].seds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = cts_info[i].edi.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].edi.v_bcl[j],
+                              cts_info[i].edi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = cts_info[i].sedi.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].sedi.v_bcl[j],
+                              cts_info[i].sedi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = cts_info[i].bagss.v;
+      cts_i_rep[i].get_stat(c,   si_na);
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].bagss.v_bcl[j],
+                              cts_info[i].bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-   if(cts_i_out)  { delete [] cts_i_out;  cts_i_out  = (ofstream *)     0; }
-   if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-   if(cts_i_file) { delete [] cts_i_file; cts_i_file = (ConcatString *) 0; }
-   if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+   if(cts_i_rep) { delete [] cts_i_rep; cts_i_rep = (BootRepStore *) 0; }
+   if(cts_r_rep) { delete [] cts_r_rep; cts_r_rep = (BootRepStore *) 0; }
 
    return;
 }
@@ -729,14 +698,13 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
    int n = 0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
-   MCTSInfo mcts_tmp;
+   NumArray i_na, si_na, sr_na;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for categorical statistics
+   // Replicate stores for categorical statistics
    //
-   ofstream mcts_i_out, mcts_r_out;
-   ConcatString mcts_i_file, mcts_r_file, prefix;
+   BootRepStore mcts_i_rep, mcts_r_rep;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -769,146 +737,77 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !mcts_flag) return;
 
    //
-   // Initialize the MCTSInfo temporary object.
+   // Size the replicate stores
    //
-   mcts_tmp = mcts_info;
+   mcts_i_rep.set_size(n_mcts_boot_stat, n, tmp_dir, "tmp_mcts_i");
+   mcts_r_rep.set_size(n_mcts_boot_stat, b, tmp_dir, "tmp_mcts_r");
 
    //
-   // Build the temp file names
+   // Compute the multi-category stats from the raw data with the i-th data
+   // point removed and for each resampled replicate, splitting the
+   // work across threads
    //
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_i";
-   mcts_i_file = make_temp_file_name(prefix.c_str(), NULL);
-
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_r";
-   mcts_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.mcts_info   = &mcts_info;
+   info.jack_rep    = &mcts_i_rep;
+   info.boot_rep    = &mcts_r_rep;
+   run_boot_tasks(info, rng_ptr, mcts_jack_task, n,
+                  mcts_boot_task, b);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Initialize column counter
    //
-   try {
-
-      //
-      // Open up the temp files
-      //
-      mcts_i_out.open(mcts_i_file.c_str());
-      mcts_r_out.open(mcts_r_file.c_str());
-      if(!mcts_i_out || !mcts_r_out) {
-         mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << mcts_i_file << "\n"
-              << mcts_r_file << "\n\n";
-         throw(1);
-      }
-
-      //
-      // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n; i++) {
-         compute_i_mctsinfo(pd, i, false, mcts_tmp);
-         write_mctsinfo(mcts_i_out, mcts_tmp);
-      } // end for i
-
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
-
-         ran_sample(rng_ptr, i_na, ir_na, n);
-
-         //
-         // Compute categorical stats for each replicate with the
-         // cts_flag set and the normal_ci_flag unset
-         //
-         compute_mctsinfo(pd, ir_na, true, false, mcts_tmp);
-         write_mctsinfo(mcts_r_out, mcts_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      mcts_i_out.close();
-      mcts_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for acc
-      //
-      s = mcts_info.acc.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.acc.v_bcl[i],
-                              mcts_info.acc.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for hk
-      //
-      s = mcts_info.hk.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.hk.v_bcl[i],
-                              mcts_info.hk.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for hss
-      //
-      s = mcts_info.hss.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.hss.v_bcl[i],
-                              mcts_info.hss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for ger
-      //
-      s = mcts_info.ger.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.ger.v_bcl[i],
-                              mcts_info.ger.v_bcu[i]);
-
-   } // end try block
+   c = 0;
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for acc
    //
-   catch(int i_err) {
-
-      mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   s = mcts_info.acc.v;
+   mcts_i_rep.get_stat(c,   si_na);
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.acc.v_bcl[i],
+                           mcts_info.acc.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(mcts_i_file);
-      remove_temp_file(mcts_r_file);
+   //
+   // Compute bootstrap interval for hk
+   //
+   s = mcts_info.hk.v;
+   mcts_i_rep.get_stat(c,   si_na);
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.hk.v_bcl[i],
+                           mcts_info.hk.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for hss
+   //
+   s = mcts_info.hss.v;
+   mcts_i_rep.get_stat(c,   si_na);
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.hss.v_bcl[i],
+                           mcts_info.hss.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for ger
    //
-   remove_temp_file(mcts_i_file);
-   remove_temp_file(mcts_r_file);
+   s = mcts_info.ger.v;
+   mcts_i_rep.get_stat(c,   si_na);
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.ger.v_bcl[i],
+                           mcts_info.ger.v_bcu[i]);
 
    return;
 }
@@ -935,14 +834,14 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
    int n =0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
-   CNTInfo cnt_tmp;
+   NumArray i_na, si_na, sr_na;
+   CNTJackSums cnt_sums;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for continuous statistics
+   // Replicate stores for continuous statistics
    //
-   ofstream cnt_i_out, cnt_r_out;
-   ConcatString cnt_i_file, cnt_r_file, prefix;
+   BootRepStore cnt_i_rep, cnt_r_rep;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -974,381 +873,321 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1) return;
 
    //
-   // Build the temp file names
+   // Size the replicate stores
+   //
+   cnt_i_rep.set_size(n_cnt_boot_stat, n, tmp_dir, "tmp_cnt_i");
+   cnt_r_rep.set_size(n_cnt_boot_stat, b, tmp_dir, "tmp_cnt_r");
+
+   //
+   // Compute the continuous stats from the raw data with the i-th data
+   // point removed and for each resampled replicate, splitting the
+   // work across threads
    //
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_i";
-   cnt_i_file = make_temp_file_name(prefix.c_str(), NULL);
+   compute_cnt_jack_sums(pd, cnt_sums);
 
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_r";
-   cnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.precip_flag = precip_flag;
+   info.cnt_sums    = &cnt_sums;
+   info.jack_rep    = &cnt_i_rep;
+   info.boot_rep    = &cnt_r_rep;
+   run_boot_tasks(info, rng_ptr, cnt_jack_task, n,
+                  cnt_boot_task, b);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Initialize column counter
    //
-   try {
+   c = 0;
 
-      //
-      // Open up the temp files
-      //
-      cnt_i_out.open(cnt_i_file.c_str());
-      cnt_r_out.open(cnt_r_file.c_str());
-      if(!cnt_i_out || !cnt_r_out) {
-         mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << cnt_i_file << "\n"
-              << cnt_r_file << "\n\n";
-         throw(1);
-      }
+   //
+   // Compute bootstrap interval for fbar
+   //
+   s = cnt_info.fbar.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.fbar.v_bcl[i],
+                           cnt_info.fbar.v_bcu[i]);
 
-      //
-      // Compute continuous stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n; i++) {
-         compute_i_cntinfo(pd, i, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_i_out, cnt_tmp);
-      }
+   //
+   // Compute bootstrap interval for fstdev
+   //
+   s = cnt_info.fstdev.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.fstdev.v_bcl[i],
+                           cnt_info.fstdev.v_bcu[i]);
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+   //
+   // Compute bootstrap interval for obar
+   //
+   s = cnt_info.obar.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.obar.v_bcl[i],
+                           cnt_info.obar.v_bcu[i]);
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+   //
+   // Compute bootstrap interval for ostdev
+   //
+   s = cnt_info.ostdev.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.ostdev.v_bcl[i],
+                           cnt_info.ostdev.v_bcu[i]);
 
-         //
-         // Compute continuous stats for each replicate with the
-         // rank_flag and normal_ci_flag unset
-         //
-         compute_cntinfo(pd, ir_na, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_r_out, cnt_tmp);
-      }
 
-      //
-      // Close the temp files
-      //
-      cnt_i_out.close();
-      cnt_r_out.close();
+   //
+   // Compute bootstrap interval for pr_corr
+   //
+   s = cnt_info.pr_corr.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.pr_corr.v_bcl[i],
+                           cnt_info.pr_corr.v_bcu[i]);
 
-      //
-      // Initialize column counter
-      //
-      c = 1;
+   //
+   // Compute bootstrap interval for anom_corr
+   //
+   s = cnt_info.anom_corr.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.anom_corr.v_bcl[i],
+                           cnt_info.anom_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for fbar
-      //
-      s = cnt_info.fbar.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.fbar.v_bcl[i],
-                              cnt_info.fbar.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsfa
+   //
+   s = cnt_info.rmsfa.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.rmsfa.v_bcl[i],
+                           cnt_info.rmsfa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for fstdev
-      //
-      s = cnt_info.fstdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.fstdev.v_bcl[i],
-                              cnt_info.fstdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsoa
+   //
+   s = cnt_info.rmsoa.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.rmsoa.v_bcl[i],
+                           cnt_info.rmsoa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for obar
-      //
-      s = cnt_info.obar.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.obar.v_bcl[i],
-                              cnt_info.obar.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me
+   //
+   s = cnt_info.me.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.me.v_bcl[i],
+                           cnt_info.me.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for ostdev
-      //
-      s = cnt_info.ostdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.ostdev.v_bcl[i],
-                              cnt_info.ostdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me2
+   //
+   s = cnt_info.me2.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.me2.v_bcl[i],
+                           cnt_info.me2.v_bcu[i]);
 
+   //
+   // Compute bootstrap interval for estdev
+   //
+   s = cnt_info.estdev.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.estdev.v_bcl[i],
+                           cnt_info.estdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for pr_corr
-      //
-      s = cnt_info.pr_corr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.pr_corr.v_bcl[i],
-                              cnt_info.pr_corr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mbias
+   //
+   s = cnt_info.mbias.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mbias.v_bcl[i],
+                           cnt_info.mbias.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for anom_corr
-      //
-      s = cnt_info.anom_corr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.anom_corr.v_bcl[i],
-                              cnt_info.anom_corr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mae
+   //
+   s = cnt_info.mae.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mae.v_bcl[i],
+                           cnt_info.mae.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmsfa
-      //
-      s = cnt_info.rmsfa.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.rmsfa.v_bcl[i],
-                              cnt_info.rmsfa.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mse
+   //
+   s = cnt_info.mse.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mse.v_bcl[i],
+                           cnt_info.mse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmsoa
-      //
-      s = cnt_info.rmsoa.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.rmsoa.v_bcl[i],
-                              cnt_info.rmsoa.v_bcu[i]);
+   //
+   // Compute bootstrap interval for msess
+   //
+   s = cnt_info.msess.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.msess.v_bcl[i],
+                           cnt_info.msess.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for me
-      //
-      s = cnt_info.me.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.me.v_bcl[i],
-                              cnt_info.me.v_bcu[i]);
+   //
+   // Compute bootstrap interval for bcmse
+   //
+   s = cnt_info.bcmse.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.bcmse.v_bcl[i],
+                           cnt_info.bcmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for me2
-      //
-      s = cnt_info.me2.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.me2.v_bcl[i],
-                              cnt_info.me2.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmse
+   //
+   s = cnt_info.rmse.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.rmse.v_bcl[i],
+                           cnt_info.rmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for estdev
-      //
-      s = cnt_info.estdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.estdev.v_bcl[i],
-                              cnt_info.estdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for e10
+   //
+   s = cnt_info.e10.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e10.v_bcl[i],
+                           cnt_info.e10.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mbias
-      //
-      s = cnt_info.mbias.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mbias.v_bcl[i],
-                              cnt_info.mbias.v_bcu[i]);
+   //
+   // Compute bootstrap interval for e25
+   //
+   s = cnt_info.e25.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e25.v_bcl[i],
+                           cnt_info.e25.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mae
-      //
-      s = cnt_info.mae.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mae.v_bcl[i],
-                              cnt_info.mae.v_bcu[i]);
+   //
+   // Compute bootstrap interval for e50
+   //
+   s = cnt_info.e50.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e50.v_bcl[i],
+                           cnt_info.e50.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mse
-      //
-      s = cnt_info.mse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mse.v_bcl[i],
-                              cnt_info.mse.v_bcu[i]);
+   //
+   // Compute bootstrap interval for e75
+   //
+   s = cnt_info.e75.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e75.v_bcl[i],
+                           cnt_info.e75.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for msess
-      //
-      s = cnt_info.msess.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.msess.v_bcl[i],
-                              cnt_info.msess.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for bcmse
-      //
-      s = cnt_info.bcmse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.bcmse.v_bcl[i],
-                              cnt_info.bcmse.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for rmse
-      //
-      s = cnt_info.rmse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.rmse.v_bcl[i],
-                              cnt_info.rmse.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e10
-      //
-      s = cnt_info.e10.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e10.v_bcl[i],
-                              cnt_info.e10.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e25
-      //
-      s = cnt_info.e25.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e25.v_bcl[i],
-                              cnt_info.e25.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e50
-      //
-      s = cnt_info.e50.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e50.v_bcl[i],
-                              cnt_info.e50.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e75
-      //
-      s = cnt_info.e75.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e75.v_bcl[i],
-                              cnt_info.e75.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e90
-      //
-      s = cnt_info.e90.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e90.v_bcl[i],
-                              cnt_info.e90.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for eiqr
-      //
-      s = cnt_info.eiqr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.eiqr.v_bcl[i],
-                              cnt_info.eiqr.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for mad
-      //
-      s = cnt_info.mad.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mad.v_bcl[i],
-                              cnt_info.mad.v_bcu[i]);
-   } // end try block
+   //
+   // Compute bootstrap interval for e90
+   //
+   s = cnt_info.e90.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e90.v_bcl[i],
+                           cnt_info.e90.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for eiqr
    //
-   catch(int i_err) {
-
-      mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(cnt_i_file);
-      remove_temp_file(cnt_r_file);
-
-      exit(i_err);
-   } // end catch block
+   s = cnt_info.eiqr.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.eiqr.v_bcl[i],
+                           cnt_info.eiqr.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for mad
    //
-   remove_temp_file(cnt_i_file);
-   remove_temp_file(cnt_r_file);
+   s = cnt_info.mad.v;
+   cnt_i_rep.get_stat(c,   si_na);
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mad.v_bcl[i],
+                           cnt_info.mad.v_bcu[i]);
 
    return;
 }
@@ -1370,14 +1209,14 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
    int n = 0;
    int i, j, m, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
-   CTSInfo *cts_tmp = (CTSInfo *) 0;
+   NumArray i_na, sr_na;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for categorical statistics
+   // Replicate stores for categorical statistics
    //
-   ofstream *cts_r_out = (ofstream *) 0;
-   ConcatString *cts_r_file = (ConcatString *) 0, prefix;
+   BootRepStore *cts_r_rep = (BootRepStore *) 0;
+   ConcatString prefix;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1417,333 +1256,266 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !cts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space for the replicate stores for each threshold
    //
-   cts_tmp    = new CTSInfo [n_cts];
-   cts_r_out  = new ofstream [n_cts];
-   cts_r_file = new ConcatString [n_cts];
-   for(i=0; i<n_cts; i++) {
-      cts_tmp[i].fthresh = cts_info[i].fthresh;
-      cts_tmp[i].othresh = cts_info[i].othresh;
-   }
+   cts_r_rep = new BootRepStore [n_cts];
 
    //
-   // Build the temp file names
+   // Size the replicate stores for each threshold
    //
    for(i=0; i<n_cts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_cts_r_" << i;
-      cts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
+      prefix << cs_erase << "tmp_cts_r_" << i;
+      cts_r_rep[i].set_size(n_cts_boot_stat, b, tmp_dir, prefix.c_str());
    }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Compute the categorical stats for each resampled replicate,
+   // splitting the work across threads
+   //
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = m;
+   info.n_info      = n_cts;
+   info.cts_info    = cts_info;
+   info.boot_rep    = cts_r_rep;
+   run_boot_tasks(info, rng_ptr, (ThreadTaskFunction) 0, n,
+                  cts_boot_task, b);
+
+   //
+   // Compute bootstrap intervals for each threshold value
    //
-   try {
+   for(i=0; i<n_cts; i++) {
 
       //
-      // Open up the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_cts; i++) {
-         cts_r_out[i].open(cts_r_file[i].c_str());
-         if(!cts_r_out[i]) {
-            mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
-                 << "can't open the temporary file for writing:\n"
-                 << cts_r_file[i] << "\n\n";
-           //
-           // Attempt to delete temp files
-           //
-           for(i=0; i<n_cts; i++) remove_temp_file(cts_r_file[i]);
+      c = 0;
 
-           if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-           if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-           if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+      //
+      // Compute bootstrap interval for baser
+      //
+      s = cts_info[i].baser.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].baser.v_bcl[j],
+                              cts_info[i].baser.v_bcu[j]);
 
-            throw(1);
-         }
-      }
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = cts_info[i].fmean.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fmean.v_bcl[j],
+                              cts_info[i].fmean.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = cts_info[i].acc.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].acc.v_bcl[j],
+                              cts_info[i].acc.v_bcu[j]);
 
       //
-      // Resample the array of indices with replacement
+      // Compute bootstrap interval for fbias
       //
-      for(i=0; i<b; i++) {
+      s = cts_info[i].fbias.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fbias.v_bcl[j],
+                              cts_info[i].fbias.v_bcu[j]);
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+      //
+      // Compute bootstrap interval for pody
+      //
+      s = cts_info[i].pody.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pody.v_bcl[j],
+                              cts_info[i].pody.v_bcu[j]);
 
-         //
-         // Compute categorical stats for each replicate with the
-         // cts_flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_cts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false, cts_tmp[j]);
-            write_ctsinfo(cts_r_out[j], cts_tmp[j]);
-         } // end for j
-      }
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = cts_info[i].podn.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].podn.v_bcl[j],
+                              cts_info[i].podn.v_bcu[j]);
 
       //
-      // Close the temp files
-      //
-      for(i=0; i<n_cts; i++) cts_r_out[i].close();
-
-      //
-      // Compute bootstrap intervals for each threshold value
-      //
-      for(i=0; i<n_cts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = cts_info[i].baser.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].baser.v_bcl[j],
-                                 cts_info[i].baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = cts_info[i].fmean.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fmean.v_bcl[j],
-                                 cts_info[i].fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = cts_info[i].acc.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].acc.v_bcl[j],
-                                 cts_info[i].acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = cts_info[i].fbias.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fbias.v_bcl[j],
-                                 cts_info[i].fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = cts_info[i].pody.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pody.v_bcl[j],
-                                 cts_info[i].pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = cts_info[i].podn.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].podn.v_bcl[j],
-                                 cts_info[i].podn.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = cts_info[i].pofd.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pofd.v_bcl[j],
-                                 cts_info[i].pofd.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for far
-         //
-         s = cts_info[i].far.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].far.v_bcl[j],
-                                 cts_info[i].far.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = cts_info[i].csi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].csi.v_bcl[j],
-                                 cts_info[i].csi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = cts_info[i].gss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].gss.v_bcl[j],
-                                 cts_info[i].gss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = cts_info[i].hk.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hk.v_bcl[j],
-                                 cts_info[i].hk.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = cts_info[i].hss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hss.v_bcl[j],
-                                 cts_info[i].hss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = cts_info[i].odds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].odds.v_bcl[j],
-                                 cts_info[i].odds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = cts_info[i].lodds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].lodds.v_bcl[j],
-                                 cts_info[i].lodds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = cts_info[i].orss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].orss.v_bcl[j],
-                                 cts_info[i].orss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = cts_info[i].eds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].eds.v_bcl[j],
-                                 cts_info[i].eds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = cts_info[i].seds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].seds.v_bcl[j],
-                                 cts_info[i].seds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = cts_info[i].edi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].edi.v_bcl[j],
-                                 cts_info[i].edi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = cts_info[i].sedi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].sedi.v_bcl[j],
-                                 cts_info[i].sedi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = cts_info[i].bagss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].bagss.v_bcl[j],
-                                 cts_info[i].bagss.v_bcu[j]);
-      } // end for i
-
-   } // end try block
-
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      // Compute bootstrap interval for pofd
+      //
+      s = cts_info[i].pofd.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pofd.v_bcl[j],
+                              cts_info[i].pofd.v_bcu[j]);
 
-      mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for far
+      //
+      s = cts_info[i].far.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].far.v_bcl[j],
+                              cts_info[i].far.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = cts_info[i].csi.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].csi.v_bcl[j],
+                              cts_info[i].csi.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = cts_info[i].gss.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].gss.v_bcl[j],
+                              cts_info[i].gss.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_cts; i++) {
-      remove_temp_file(cts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = cts_info[i].hk.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hk.v_bcl[j],
+                              cts_info[i].hk.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = cts_info[i].hss.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hss.v_bcl[j],
+                              cts_info[i].hss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = cts_info[i].odds.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].odds.v_bcl[j],
+                              cts_info[i].odds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = cts_info[i].lodds.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].lodds.v_bcl[j],
+                              cts_info[i].lodds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = cts_info[i].orss.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].orss.v_bcl[j],
+                              cts_info[i].orss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = cts_info[i].eds.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].eds.v_bcl[j],
+                              cts_info[i].eds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = cts_info[i].seds.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].seds.v_bcl[j],
+                              cts_info[i].seds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = cts_info[i].edi.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].edi.v_bcl[j],
+                              cts_info[i].edi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = cts_info[i].sedi.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].sedi.v_bcl[j],
+                              cts_info[i].sedi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = cts_info[i].bagss.v;
+      cts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].bagss.v_bcl[j],
+                              cts_info[i].bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-   if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-   if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+   if(cts_r_rep) { delete [] cts_r_rep; cts_r_rep = (BootRepStore *) 0; }
 
    return;
 }
@@ -1765,14 +1537,13 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
    int n = 0;
    int i, m, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
-   MCTSInfo mcts_tmp;
+   NumArray i_na, sr_na;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for categorical statistics
+   // Replicate stores for categorical statistics
    //
-   ofstream mcts_r_out;
-   ConcatString mcts_r_file, prefix;
+   BootRepStore mcts_r_rep;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1810,124 +1581,70 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !mcts_flag) return;
 
    //
-   // Initialize the MCTSInfo temporary object.
+   // Size the replicate stores
    //
-   mcts_tmp = mcts_info;
+   mcts_r_rep.set_size(n_mcts_boot_stat, b, tmp_dir, "tmp_mcts_r");
 
    //
-   // Build the temp file names
+   // Compute the multi-category stats for each resampled replicate,
+   // splitting the work across threads
    //
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_r";
-   mcts_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = m;
+   info.mcts_info   = &mcts_info;
+   info.boot_rep    = &mcts_r_rep;
+   run_boot_tasks(info, rng_ptr, (ThreadTaskFunction) 0, n,
+                  mcts_boot_task, b);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Initialize column counter
    //
-   try {
-
-      //
-      // Open up the temp file
-      //
-      mcts_r_out.open(mcts_r_file.c_str());
-      if(!mcts_r_out) {
-         mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << mcts_r_file << "\n\n";
-         throw(1);
-      }
-
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
-
-         ran_sample(rng_ptr, i_na, ir_na, m);
-
-         //
-         // Compute multi-category stats for each replicate with the
-         // mcts_flag set and the normal_ci_flag unset
-         //
-         compute_mctsinfo(pd, ir_na, true, false, mcts_tmp);
-         write_mctsinfo(mcts_r_out, mcts_tmp);
-      }
-
-      //
-      // Close the temp file
-      //
-      mcts_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for acc
-      //
-      s = mcts_info.acc.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.acc.v_bcl[i],
-                               mcts_info.acc.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for hk
-      //
-      s = mcts_info.hk.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.hk.v_bcl[i],
-                               mcts_info.hk.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for hss
-      //
-      s = mcts_info.hss.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.hss.v_bcl[i],
-                               mcts_info.hss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for ger
-      //
-      s = mcts_info.ger.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.ger.v_bcl[i],
-                               mcts_info.ger.v_bcu[i]);
-   } // end try block
+   c = 0;
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for acc
    //
-   catch(int i_err) {
-
-      mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   s = mcts_info.acc.v;
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.acc.v_bcl[i],
+                            mcts_info.acc.v_bcu[i]);
 
-      //
-      // Attempt to delete temp file
-      //
-      remove_temp_file(mcts_r_file);
+   //
+   // Compute bootstrap interval for hk
+   //
+   s = mcts_info.hk.v;
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.hk.v_bcl[i],
+                            mcts_info.hk.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for hss
+   //
+   s = mcts_info.hss.v;
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.hss.v_bcl[i],
+                            mcts_info.hss.v_bcu[i]);
 
    //
-   // Delete temp file
+   // Compute bootstrap interval for ger
    //
-   remove_temp_file(mcts_r_file);
+   s = mcts_info.ger.v;
+   mcts_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.ger.v_bcl[i],
+                            mcts_info.ger.v_bcu[i]);
 
    return;
 }
@@ -1948,14 +1665,13 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
    int n = 0;
    int i, m, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
-   CNTInfo cnt_tmp;
+   NumArray i_na, sr_na;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for continuous statistics
+   // Replicate stores for continuous statistics
    //
-   ofstream cnt_r_out;
-   ConcatString cnt_r_file, prefix;
+   BootRepStore cnt_r_rep;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1992,340 +1708,291 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1) return;
 
    //
-   // Build the temp file names
+   // Size the replicate stores
    //
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_r";
-   cnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   cnt_r_rep.set_size(n_cnt_boot_stat, b, tmp_dir, "tmp_cnt_r");
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Compute the continuous stats for each resampled replicate,
+   // splitting the work across threads
    //
-   try {
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = m;
+   info.precip_flag = precip_flag;
+   info.boot_rep    = &cnt_r_rep;
+   run_boot_tasks(info, rng_ptr, (ThreadTaskFunction) 0, n,
+                  cnt_boot_task, b);
 
-      //
-      // Open up the temp files
-      //
-      cnt_r_out.open(cnt_r_file.c_str());
-      if(!cnt_r_out) {
-         mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << cnt_r_file << "\n\n";
-         throw(1);
-      }
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+   //
+   // Compute bootstrap interval for fbar
+   //
+   s = cnt_info.fbar.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.fbar.v_bcl[i],
+                            cnt_info.fbar.v_bcu[i]);
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+   //
+   // Compute bootstrap interval for fstdev
+   //
+   s = cnt_info.fstdev.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.fstdev.v_bcl[i],
+                            cnt_info.fstdev.v_bcu[i]);
 
-         //
-         // Compute continuous stats for each replicate with the
-         // rank_flag and normal_ci_flag unset
-         //
-         compute_cntinfo(pd, ir_na, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_r_out, cnt_tmp);
-      }
+   //
+   // Compute bootstrap interval for obar
+   //
+   s = cnt_info.obar.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.obar.v_bcl[i],
+                            cnt_info.obar.v_bcu[i]);
 
-      //
-      // Close the temp files
-      //
-      cnt_r_out.close();
+   //
+   // Compute bootstrap interval for ostdev
+   //
+   s = cnt_info.ostdev.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.ostdev.v_bcl[i],
+                            cnt_info.ostdev.v_bcu[i]);
 
-      //
-      // Initialize column counter
-      //
-      c = 1;
 
-      //
-      // Compute bootstrap interval for fbar
-      //
-      s = cnt_info.fbar.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.fbar.v_bcl[i],
-                               cnt_info.fbar.v_bcu[i]);
+   //
+   // Compute bootstrap interval for pr_corr
+   //
+   s = cnt_info.pr_corr.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.pr_corr.v_bcl[i],
+                            cnt_info.pr_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for fstdev
-      //
-      s = cnt_info.fstdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.fstdev.v_bcl[i],
-                               cnt_info.fstdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for anom_corr
+   //
+   s = cnt_info.anom_corr.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.anom_corr.v_bcl[i],
+                            cnt_info.anom_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for obar
-      //
-      s = cnt_info.obar.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.obar.v_bcl[i],
-                               cnt_info.obar.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsfa
+   //
+   s = cnt_info.rmsfa.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.rmsfa.v_bcl[i],
+                            cnt_info.rmsfa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for ostdev
-      //
-      s = cnt_info.ostdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.ostdev.v_bcl[i],
-                               cnt_info.ostdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsoa
+   //
+   s = cnt_info.rmsoa.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.rmsoa.v_bcl[i],
+                            cnt_info.rmsoa.v_bcu[i]);
 
+   //
+   // Compute bootstrap interval for me
+   //
+   s = cnt_info.me.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.me.v_bcl[i],
+                            cnt_info.me.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for pr_corr
-      //
-      s = cnt_info.pr_corr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.pr_corr.v_bcl[i],
-                               cnt_info.pr_corr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me2
+   //
+   s = cnt_info.me2.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.me2.v_bcl[i],
+                            cnt_info.me2.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for anom_corr
-      //
-      s = cnt_info.anom_corr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.anom_corr.v_bcl[i],
-                               cnt_info.anom_corr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for estdev
+   //
+   s = cnt_info.estdev.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.estdev.v_bcl[i],
+                            cnt_info.estdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmsfa
-      //
-      s = cnt_info.rmsfa.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.rmsfa.v_bcl[i],
-                               cnt_info.rmsfa.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mbias
+   //
+   s = cnt_info.mbias.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mbias.v_bcl[i],
+                            cnt_info.mbias.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmsoa
-      //
-      s = cnt_info.rmsoa.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.rmsoa.v_bcl[i],
-                               cnt_info.rmsoa.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mae
+   //
+   s = cnt_info.mae.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mae.v_bcl[i],
+                            cnt_info.mae.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for me
-      //
-      s = cnt_info.me.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.me.v_bcl[i],
-                               cnt_info.me.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mse
+   //
+   s = cnt_info.mse.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mse.v_bcl[i],
+                            cnt_info.mse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for me2
-      //
-      s = cnt_info.me2.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.me2.v_bcl[i],
-                               cnt_info.me2.v_bcu[i]);
+   //
+   // Compute bootstrap interval for msess
+   //
+   s = cnt_info.msess.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.msess.v_bcl[i],
+                            cnt_info.msess.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for estdev
-      //
-      s = cnt_info.estdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.estdev.v_bcl[i],
-                               cnt_info.estdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for bcmse
+   //
+   s = cnt_info.bcmse.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.bcmse.v_bcl[i],
+                            cnt_info.bcmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mbias
-      //
-      s = cnt_info.mbias.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mbias.v_bcl[i],
-                               cnt_info.mbias.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for mae
-      //
-      s = cnt_info.mae.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mae.v_bcl[i],
-                               cnt_info.mae.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for mse
-      //
-      s = cnt_info.mse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mse.v_bcl[i],
-                               cnt_info.mse.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for msess
-      //
-      s = cnt_info.msess.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.msess.v_bcl[i],
-                               cnt_info.msess.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for bcmse
-      //
-      s = cnt_info.bcmse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.bcmse.v_bcl[i],
-                               cnt_info.bcmse.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for rmse
-      //
-      s = cnt_info.rmse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.rmse.v_bcl[i],
-                               cnt_info.rmse.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e10
-      //
-      s = cnt_info.e10.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e10.v_bcl[i],
-                               cnt_info.e10.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e25
-      //
-      s = cnt_info.e25.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e25.v_bcl[i],
-                               cnt_info.e25.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e50
-      //
-      s = cnt_info.e50.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e50.v_bcl[i],
-                               cnt_info.e50.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e75
-      //
-      s = cnt_info.e75.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e75.v_bcl[i],
-                               cnt_info.e75.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for e90
-      //
-      s = cnt_info.e90.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e90.v_bcl[i],
-                               cnt_info.e90.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmse
+   //
+   s = cnt_info.rmse.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.rmse.v_bcl[i],
+                            cnt_info.rmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for eiqr
-      //
-      s = cnt_info.eiqr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.eiqr.v_bcl[i],
-                               cnt_info.eiqr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for e10
+   //
+   s = cnt_info.e10.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e10.v_bcl[i],
+                            cnt_info.e10.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mad
-      //
-      s = cnt_info.mad.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mad.v_bcl[i],
-                               cnt_info.mad.v_bcu[i]);
-   } // end try block
+   //
+   // Compute bootstrap interval for e25
+   //
+   s = cnt_info.e25.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e25.v_bcl[i],
+                            cnt_info.e25.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for e50
    //
-   catch(int i_err) {
+   s = cnt_info.e50.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e50.v_bcl[i],
+                            cnt_info.e50.v_bcu[i]);
 
-      mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for e75
+   //
+   s = cnt_info.e75.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e75.v_bcl[i],
+                            cnt_info.e75.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(cnt_r_file);
+   //
+   // Compute bootstrap interval for e90
+   //
+   s = cnt_info.e90.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e90.v_bcl[i],
+                            cnt_info.e90.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for eiqr
+   //
+   s = cnt_info.eiqr.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.eiqr.v_bcl[i],
+                            cnt_info.eiqr.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for mad
    //
-   remove_temp_file(cnt_r_file);
+   s = cnt_info.mad.v;
+   cnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mad.v_bcl[i],
+                            cnt_info.mad.v_bcu[i]);
 
    return;
 }
@@ -2340,14 +2007,16 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
    int n = 0;
    int i, j, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
-   NBRCTSInfo *nbrcts_tmp = (NBRCTSInfo *) 0;
+   NumArray i_na, si_na, sr_na;
+   CTSInfo *cts_tmp = (CTSInfo *) 0;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for categorical statistics
+   // Replicate stores for categorical statistics
    //
-   ofstream *nbrcts_i_out = (ofstream *) 0, *nbrcts_r_out = (ofstream *) 0;
-   ConcatString *nbrcts_i_file = (ConcatString *) 0, *nbrcts_r_file = (ConcatString *) 0, prefix;
+   BootRepStore *nbrcts_i_rep = (BootRepStore *) 0;
+   BootRepStore *nbrcts_r_rep = (BootRepStore *) 0;
+   ConcatString prefix;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2383,388 +2052,297 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space to store the full sample categorical stats for
+   // each threshold and for the replicate stores
    //
-   nbrcts_tmp    = new NBRCTSInfo [n_nbrcts];
-   nbrcts_i_out  = new ofstream [n_nbrcts];
-   nbrcts_r_out  = new ofstream [n_nbrcts];
-   nbrcts_i_file = new ConcatString [n_nbrcts];
-   nbrcts_r_file = new ConcatString [n_nbrcts];
-   for(i=0; i<n_nbrcts; i++) {
-      nbrcts_tmp[i].cts_info.fthresh = nbrcts_info[i].cts_info.fthresh;
-      nbrcts_tmp[i].cts_info.othresh = nbrcts_info[i].cts_info.othresh;
-      nbrcts_tmp[i].fthresh          = nbrcts_info[i].fthresh;
-      nbrcts_tmp[i].othresh          = nbrcts_info[i].othresh;
-      nbrcts_tmp[i].cthresh          = nbrcts_info[i].cthresh;
-   }
+   cts_tmp      = new CTSInfo      [n_nbrcts];
+   nbrcts_i_rep = new BootRepStore [n_nbrcts];
+   nbrcts_r_rep = new BootRepStore [n_nbrcts];
+   for(i=0; i<n_nbrcts; i++) cts_tmp[i] = nbrcts_info[i].cts_info;
 
    //
-   // Build the temp file names
+   // Size the replicate stores for each threshold
    //
    for(i=0; i<n_nbrcts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_i_" << i;
-      nbrcts_i_file[i] = make_temp_file_name(prefix.c_str(), NULL);
+      prefix << cs_erase << "tmp_nbrcts_i_" << i;
+      nbrcts_i_rep[i].set_size(n_cts_boot_stat, n, tmp_dir, prefix.c_str());
 
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_r_" << i;
-      nbrcts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
+      prefix << cs_erase << "tmp_nbrcts_r_" << i;
+      nbrcts_r_rep[i].set_size(n_cts_boot_stat, b, tmp_dir, prefix.c_str());
    }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Compute the categorical stats from the raw data with the i-th data
+   // point removed and for each resampled replicate, splitting the
+   // work across threads
    //
-   try {
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.n_info      = n_nbrcts;
+   info.cts_info    = cts_tmp;
+   info.jack_rep    = nbrcts_i_rep;
+   info.boot_rep    = nbrcts_r_rep;
+   run_boot_tasks(info, rng_ptr, cts_jack_task, n,
+                  cts_boot_task, b);
+
+   //
+   // Compute bootstrap intervals for each threshold value
+   //
+   for(i=0; i<n_nbrcts; i++) {
 
       //
-      // Open up the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_i_out[i].open(nbrcts_i_file[i].c_str());
-         nbrcts_r_out[i].open(nbrcts_r_file[i].c_str());
-         if(!nbrcts_i_out[i] || !nbrcts_r_out[i]) {
-            mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
-                 << "can't open one or more temporary files for writing:\n"
-                 << nbrcts_i_file[i] << "\n"
-                 << nbrcts_r_file[i] << "\n\n";
+      c = 0;
 
-            //
-            // Attempt to delete temp files
-            //
-            for(i=0; i<n_nbrcts; i++) {
-               remove_temp_file(nbrcts_i_file[i]);
-               remove_temp_file(nbrcts_r_file[i]);
-            }
+      //
+      // Compute bootstrap interval for baser
+      //
+      s = nbrcts_info[i].cts_info.baser.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.baser.v_bcl[j],
+                              nbrcts_info[i].cts_info.baser.v_bcu[j]);
 
-            // deallocate memory
-            if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-             if(nbrcts_i_out)  { delete [] nbrcts_i_out;  nbrcts_i_out  = (ofstream *)     0; }
-            if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-            if(nbrcts_i_file) { delete [] nbrcts_i_file; nbrcts_i_file = (ConcatString *) 0; }
-            if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = nbrcts_info[i].cts_info.fmean.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.fmean.v_bcl[j],
+                              nbrcts_info[i].cts_info.fmean.v_bcu[j]);
 
-            throw(1);
-         }
-      }
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = nbrcts_info[i].cts_info.acc.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.acc.v_bcl[j],
+                              nbrcts_info[i].cts_info.acc.v_bcu[j]);
 
       //
-      // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
+      // Compute bootstrap interval for fbias
       //
-      for(i=0; i<n_nbrcts; i++) {
-         for(j=0; j<n; j++) {
-            compute_i_ctsinfo(pd, j, false, nbrcts_tmp[i].cts_info);
-            write_ctsinfo(nbrcts_i_out[i], nbrcts_tmp[i].cts_info);
-         }
-      } // end for i
+      s = nbrcts_info[i].cts_info.fbias.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.fbias.v_bcl[j],
+                              nbrcts_info[i].cts_info.fbias.v_bcu[j]);
 
       //
-      // Resample the array of indices with replacement
+      // Compute bootstrap interval for pody
       //
-      for(i=0; i<b; i++) {
+      s = nbrcts_info[i].cts_info.pody.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.pody.v_bcl[j],
+                              nbrcts_info[i].cts_info.pody.v_bcu[j]);
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = nbrcts_info[i].cts_info.podn.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.podn.v_bcl[j],
+                              nbrcts_info[i].cts_info.podn.v_bcu[j]);
 
-         //
-         // Compute categorical stats for each replicate with the
-         // nbrcts_flag flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_nbrcts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false,
-                            nbrcts_tmp[j].cts_info);
-            write_ctsinfo(nbrcts_r_out[j], nbrcts_tmp[j].cts_info);
-         } // end for j
-      }
+      //
+      // Compute bootstrap interval for pofd
+      //
+      s = nbrcts_info[i].cts_info.pofd.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.pofd.v_bcl[j],
+                              nbrcts_info[i].cts_info.pofd.v_bcu[j]);
 
       //
-      // Close the temp files
+      // Compute bootstrap interval for far
       //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_i_out[i].close();
-         nbrcts_r_out[i].close();
-      }
+      s = nbrcts_info[i].cts_info.far.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.far.v_bcl[j],
+                              nbrcts_info[i].cts_info.far.v_bcu[j]);
 
       //
-      // Compute bootstrap intervals for each threshold value
-      //
-      for(i=0; i<n_nbrcts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = nbrcts_info[i].cts_info.baser.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.baser.v_bcl[j],
-                                 nbrcts_info[i].cts_info.baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = nbrcts_info[i].cts_info.fmean.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.fmean.v_bcl[j],
-                                 nbrcts_info[i].cts_info.fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = nbrcts_info[i].cts_info.acc.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.acc.v_bcl[j],
-                                 nbrcts_info[i].cts_info.acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = nbrcts_info[i].cts_info.fbias.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.fbias.v_bcl[j],
-                                 nbrcts_info[i].cts_info.fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = nbrcts_info[i].cts_info.pody.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.pody.v_bcl[j],
-                                 nbrcts_info[i].cts_info.pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = nbrcts_info[i].cts_info.podn.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.podn.v_bcl[j],
-                                 nbrcts_info[i].cts_info.podn.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = nbrcts_info[i].cts_info.pofd.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.pofd.v_bcl[j],
-                                 nbrcts_info[i].cts_info.pofd.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for far
-         //
-         s = nbrcts_info[i].cts_info.far.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.far.v_bcl[j],
-                                 nbrcts_info[i].cts_info.far.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = nbrcts_info[i].cts_info.csi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.csi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.csi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = nbrcts_info[i].cts_info.gss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.gss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.gss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = nbrcts_info[i].cts_info.hk.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.hk.v_bcl[j],
-                                 nbrcts_info[i].cts_info.hk.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = nbrcts_info[i].cts_info.hss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.hss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.hss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = nbrcts_info[i].cts_info.odds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.odds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.odds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = nbrcts_info[i].cts_info.lodds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = nbrcts_info[i].cts_info.orss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = nbrcts_info[i].cts_info.eds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = nbrcts_info[i].cts_info.seds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = nbrcts_info[i].cts_info.edi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = nbrcts_info[i].cts_info.sedi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = nbrcts_info[i].cts_info.bagss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcu[j]);
-      } // end for i
-
-   } // end try block
-
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      // Compute bootstrap interval for csi
+      //
+      s = nbrcts_info[i].cts_info.csi.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.csi.v_bcl[j],
+                              nbrcts_info[i].cts_info.csi.v_bcu[j]);
 
-      mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
-      
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = nbrcts_info[i].cts_info.gss.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.gss.v_bcl[j],
+                              nbrcts_info[i].cts_info.gss.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_nbrcts; i++) {
-      remove_temp_file(nbrcts_i_file[i]);
-      remove_temp_file(nbrcts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = nbrcts_info[i].cts_info.hk.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.hk.v_bcl[j],
+                              nbrcts_info[i].cts_info.hk.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = nbrcts_info[i].cts_info.hss.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.hss.v_bcl[j],
+                              nbrcts_info[i].cts_info.hss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = nbrcts_info[i].cts_info.odds.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.odds.v_bcl[j],
+                              nbrcts_info[i].cts_info.odds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = nbrcts_info[i].cts_info.lodds.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcl[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = nbrcts_info[i].cts_info.orss.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.orss.v_bcl[j],
+                              nbrcts_info[i].cts_info.orss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = nbrcts_info[i].cts_info.eds.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.eds.v_bcl[j],
+                              nbrcts_info[i].cts_info.eds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = nbrcts_info[i].cts_info.seds.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.seds.v_bcl[j],
+                              nbrcts_info[i].cts_info.seds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = nbrcts_info[i].cts_info.edi.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.edi.v_bcl[j],
+                              nbrcts_info[i].cts_info.edi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = nbrcts_info[i].cts_info.sedi.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcl[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = nbrcts_info[i].cts_info.bagss.v;
+      nbrcts_i_rep[i].get_stat(c,   si_na);
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcl[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-   if(nbrcts_i_out)  { delete [] nbrcts_i_out;  nbrcts_i_out  = (ofstream *)     0; }
-   if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-   if(nbrcts_i_file) { delete [] nbrcts_i_file; nbrcts_i_file = (ConcatString *) 0; }
-   if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+   if(cts_tmp)      { delete [] cts_tmp;      cts_tmp      = (CTSInfo *)      0; }
+   if(nbrcts_i_rep) { delete [] nbrcts_i_rep; nbrcts_i_rep = (BootRepStore *) 0; }
+   if(nbrcts_r_rep) { delete [] nbrcts_r_rep; nbrcts_r_rep = (BootRepStore *) 0; }
 
    return;
 }
@@ -2780,14 +2358,14 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
    int n = 0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
-   NBRCNTInfo nbrcnt_tmp;
+   NumArray i_na, si_na, sr_na;
+   NBRCNTJackSums nbrcnt_sums;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for continuous statistics
+   // Replicate stores for continuous statistics
    //
-   ofstream nbrcnt_i_out, nbrcnt_r_out;
-   ConcatString nbrcnt_i_file, nbrcnt_r_file, prefix;
+   BootRepStore nbrcnt_i_rep, nbrcnt_r_rep;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2819,164 +2397,104 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcnt_flag) return;
 
    //
-   // Build the temp file names
+   // Size the replicate stores
    //
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_i";
-   nbrcnt_i_file = make_temp_file_name(prefix.c_str(), NULL);
-
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_r";
-   nbrcnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
+   nbrcnt_i_rep.set_size(n_nbrcnt_boot_stat, n, tmp_dir, "tmp_nbrcnt_i");
+   nbrcnt_r_rep.set_size(n_nbrcnt_boot_stat, b, tmp_dir, "tmp_nbrcnt_r");
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Compute the continuous stats from the raw data with the i-th data
+   // point removed and for each resampled replicate, splitting the
+   // work across threads
    //
-   try {
+   compute_nbrcnt_jack_sums(pd, pd_thr, nbrcnt_sums);
 
-      //
-      // Open up the temp files
-      //
-      nbrcnt_i_out.open(nbrcnt_i_file.c_str());
-      nbrcnt_r_out.open(nbrcnt_r_file.c_str());
-      if(!nbrcnt_i_out || !nbrcnt_r_out) {
-         mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << nbrcnt_i_file << "\n"
-              << nbrcnt_r_file << "\n\n";
-         throw(1);
-      }
+   info.pd          = &pd;
+   info.pd_thr      = &pd_thr;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.nbrcnt_sums = &nbrcnt_sums;
+   info.jack_rep    = &nbrcnt_i_rep;
+   info.boot_rep    = &nbrcnt_r_rep;
+   run_boot_tasks(info, rng_ptr, nbrcnt_jack_task, n,
+                  nbrcnt_boot_task, b);
 
-      //
-      // Compute continuous stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n; i++) {
-         compute_i_nbrcntinfo(pd, pd_thr, i, nbrcnt_tmp);
-         write_nbrcntinfo(nbrcnt_i_out, nbrcnt_tmp);
-      }
-
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
-
-         ran_sample(rng_ptr, i_na, ir_na, n);
-
-         //
-         // Compute continuous stats for each replicate
-         //
-         compute_nbrcntinfo(pd, pd_thr, ir_na, nbrcnt_tmp, 1);
-         write_nbrcntinfo(nbrcnt_r_out, nbrcnt_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      nbrcnt_i_out.close();
-      nbrcnt_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for FBS
-      //
-      s = nbrcnt_info.fbs.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fbs.v_bcl[i],
-                              nbrcnt_info.fbs.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for FSS
-      //
-      s = nbrcnt_info.fss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fss.v_bcl[i],
-                              nbrcnt_info.fss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for AFSS
-      //
-      s = nbrcnt_info.afss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.afss.v_bcl[i],
-                              nbrcnt_info.afss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for UFSS
-      //
-      s = nbrcnt_info.ufss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.ufss.v_bcl[i],
-                              nbrcnt_info.ufss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for F_RATE
-      //
-      s = nbrcnt_info.f_rate.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.f_rate.v_bcl[i],
-                              nbrcnt_info.f_rate.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for O_RATE
-      //
-      s = nbrcnt_info.o_rate.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.o_rate.v_bcl[i],
-                              nbrcnt_info.o_rate.v_bcu[i]);
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-   } // end try block
+   //
+   // Compute bootstrap interval for FBS
+   //
+   s = nbrcnt_info.fbs.v;
+   nbrcnt_i_rep.get_stat(c,   si_na);
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fbs.v_bcl[i],
+                           nbrcnt_info.fbs.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for FSS
    //
-   catch(int i_err) {
+   s = nbrcnt_info.fss.v;
+   nbrcnt_i_rep.get_stat(c,   si_na);
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fss.v_bcl[i],
+                           nbrcnt_info.fss.v_bcu[i]);
 
-      mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for AFSS
+   //
+   s = nbrcnt_info.afss.v;
+   nbrcnt_i_rep.get_stat(c,   si_na);
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.afss.v_bcl[i],
+                           nbrcnt_info.afss.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(nbrcnt_i_file);
-      remove_temp_file(nbrcnt_r_file);
+   //
+   // Compute bootstrap interval for UFSS
+   //
+   s = nbrcnt_info.ufss.v;
+   nbrcnt_i_rep.get_stat(c,   si_na);
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.ufss.v_bcl[i],
+                           nbrcnt_info.ufss.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for F_RATE
+   //
+   s = nbrcnt_info.f_rate.v;
+   nbrcnt_i_rep.get_stat(c,   si_na);
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.f_rate.v_bcl[i],
+                           nbrcnt_info.f_rate.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for O_RATE
    //
-   remove_temp_file(nbrcnt_i_file);
-   remove_temp_file(nbrcnt_r_file);
+   s = nbrcnt_info.o_rate.v;
+   nbrcnt_i_rep.get_stat(c,   si_na);
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.o_rate.v_bcl[i],
+                           nbrcnt_info.o_rate.v_bcu[i]);
 
    return;
 }
@@ -2992,14 +2510,15 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
    int n = 0;
    int i, j, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
-   NBRCTSInfo *nbrcts_tmp = ( NBRCTSInfo *) 0;
+   NumArray i_na, sr_na;
+   CTSInfo *cts_tmp = (CTSInfo *) 0;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for categorical statistics
+   // Replicate stores for categorical statistics
    //
-   ofstream *nbrcts_r_out = (ofstream *) 0;
-   ConcatString *nbrcts_r_file = (ConcatString *) 0, prefix;
+   BootRepStore *nbrcts_r_rep = (BootRepStore *) 0;
+   ConcatString prefix;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -3035,339 +2554,270 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space to store the full sample categorical stats for
+   // each threshold and for the replicate stores
    //
-   nbrcts_tmp    = new NBRCTSInfo [n_nbrcts];
-   nbrcts_r_out  = new ofstream [n_nbrcts];
-   nbrcts_r_file = new ConcatString [n_nbrcts];
-   for(i=0; i<n_nbrcts; i++) {
-      nbrcts_tmp[i].cts_info.fthresh = nbrcts_info[i].cts_info.fthresh;
-      nbrcts_tmp[i].cts_info.othresh = nbrcts_info[i].cts_info.othresh;
-      nbrcts_tmp[i].fthresh          = nbrcts_info[i].fthresh;
-      nbrcts_tmp[i].othresh          = nbrcts_info[i].othresh;
-      nbrcts_tmp[i].cthresh          = nbrcts_info[i].cthresh;
-   }
+   cts_tmp      = new CTSInfo      [n_nbrcts];
+   nbrcts_r_rep = new BootRepStore [n_nbrcts];
+   for(i=0; i<n_nbrcts; i++) cts_tmp[i] = nbrcts_info[i].cts_info;
 
    //
-   // Build the temp file names
+   // Size the replicate stores for each threshold
    //
    for(i=0; i<n_nbrcts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_r_" << i;
-      nbrcts_r_file[i] = make_temp_file_name(prefix.c_str(), NULL);
+      prefix << cs_erase << "tmp_nbrcts_r_" << i;
+      nbrcts_r_rep[i].set_size(n_cts_boot_stat, b, tmp_dir, prefix.c_str());
    }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Compute the categorical stats for each resampled replicate,
+   // splitting the work across threads
+   //
+   info.pd          = &pd;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.n_info      = n_nbrcts;
+   info.cts_info    = cts_tmp;
+   info.boot_rep    = nbrcts_r_rep;
+   run_boot_tasks(info, rng_ptr, (ThreadTaskFunction) 0, n,
+                  cts_boot_task, b);
+
+   //
+   // Compute bootstrap intervals for each threshold value
    //
-   try {
+   for(i=0; i<n_nbrcts; i++) {
 
       //
-      // Open up the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_r_out[i].open(nbrcts_r_file[i].c_str());
-         if(!nbrcts_r_out[i]) {
-            mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
-                 << "can't open the temporary file for writing:\n"
-                 << nbrcts_r_file[i] << "\n\n";
+      c = 0;
 
-            //
-          // Attempt to delete temp files
-          //
-          for(i=0; i<n_nbrcts; i++) remove_temp_file(nbrcts_r_file[i]);
-         // Deallocate memory
-         //
-         if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-         if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-         if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
-	 
-            throw(1);
-         }
-      }
+      //
+      // Compute bootstrap interval for baser
+      //
+      s = nbrcts_info[i].cts_info.baser.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.baser.v_bcl[j],
+                               nbrcts_info[i].cts_info.baser.v_bcu[j]);
 
       //
-      // Resample the array of indices with replacement
+      // Compute bootstrap interval for fmean
       //
-      for(i=0; i<b; i++) {
+      s = nbrcts_info[i].cts_info.fmean.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.fmean.v_bcl[j],
+                               nbrcts_info[i].cts_info.fmean.v_bcu[j]);
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = nbrcts_info[i].cts_info.acc.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.acc.v_bcl[j],
+                               nbrcts_info[i].cts_info.acc.v_bcu[j]);
 
-         //
-         // Compute categorical stats for each replicate with the
-         // nbrcts_flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_nbrcts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false,
-                            nbrcts_tmp[j].cts_info);
-            write_ctsinfo(nbrcts_r_out[j], nbrcts_tmp[j].cts_info);
-         } // end for j
-      }
+      //
+      // Compute bootstrap interval for fbias
+      //
+      s = nbrcts_info[i].cts_info.fbias.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.fbias.v_bcl[j],
+                               nbrcts_info[i].cts_info.fbias.v_bcu[j]);
 
       //
-      // Close the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) nbrcts_r_out[i].close();
-
-      //
-      // Compute bootstrap intervals for each threshold value
-      //
-      for(i=0; i<n_nbrcts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = nbrcts_info[i].cts_info.baser.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.baser.v_bcl[j],
-                                  nbrcts_info[i].cts_info.baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = nbrcts_info[i].cts_info.fmean.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.fmean.v_bcl[j],
-                                  nbrcts_info[i].cts_info.fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = nbrcts_info[i].cts_info.acc.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.acc.v_bcl[j],
-                                  nbrcts_info[i].cts_info.acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = nbrcts_info[i].cts_info.fbias.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.fbias.v_bcl[j],
-                                  nbrcts_info[i].cts_info.fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = nbrcts_info[i].cts_info.pody.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.pody.v_bcl[j],
-                                  nbrcts_info[i].cts_info.pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = nbrcts_info[i].cts_info.podn.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.podn.v_bcl[j],
-                                  nbrcts_info[i].cts_info.podn.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = nbrcts_info[i].cts_info.pofd.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.pofd.v_bcl[j],
-                                  nbrcts_info[i].cts_info.pofd.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for far
-         //
-         s = nbrcts_info[i].cts_info.far.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.far.v_bcl[j],
-                                  nbrcts_info[i].cts_info.far.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = nbrcts_info[i].cts_info.csi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.csi.v_bcl[j],
-                                  nbrcts_info[i].cts_info.csi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = nbrcts_info[i].cts_info.gss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.gss.v_bcl[j],
-                                  nbrcts_info[i].cts_info.gss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = nbrcts_info[i].cts_info.hk.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.hk.v_bcl[j],
-                                  nbrcts_info[i].cts_info.hk.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = nbrcts_info[i].cts_info.hss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.hss.v_bcl[j],
-                                  nbrcts_info[i].cts_info.hss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = nbrcts_info[i].cts_info.odds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.odds.v_bcl[j],
-                                  nbrcts_info[i].cts_info.odds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = nbrcts_info[i].cts_info.lodds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = nbrcts_info[i].cts_info.orss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = nbrcts_info[i].cts_info.eds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = nbrcts_info[i].cts_info.seds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = nbrcts_info[i].cts_info.edi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = nbrcts_info[i].cts_info.sedi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = nbrcts_info[i].cts_info.bagss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcu[j]);
-      } // end for i
-
-   } // end try block
-
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      // Compute bootstrap interval for pody
+      //
+      s = nbrcts_info[i].cts_info.pody.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.pody.v_bcl[j],
+                               nbrcts_info[i].cts_info.pody.v_bcu[j]);
 
-      mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = nbrcts_info[i].cts_info.podn.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.podn.v_bcl[j],
+                               nbrcts_info[i].cts_info.podn.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for pofd
+      //
+      s = nbrcts_info[i].cts_info.pofd.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.pofd.v_bcl[j],
+                               nbrcts_info[i].cts_info.pofd.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_nbrcts; i++) {
-      remove_temp_file(nbrcts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for far
+      //
+      s = nbrcts_info[i].cts_info.far.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.far.v_bcl[j],
+                               nbrcts_info[i].cts_info.far.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = nbrcts_info[i].cts_info.csi.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.csi.v_bcl[j],
+                               nbrcts_info[i].cts_info.csi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = nbrcts_info[i].cts_info.gss.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.gss.v_bcl[j],
+                               nbrcts_info[i].cts_info.gss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = nbrcts_info[i].cts_info.hk.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.hk.v_bcl[j],
+                               nbrcts_info[i].cts_info.hk.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = nbrcts_info[i].cts_info.hss.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.hss.v_bcl[j],
+                               nbrcts_info[i].cts_info.hss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = nbrcts_info[i].cts_info.odds.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.odds.v_bcl[j],
+                               nbrcts_info[i].cts_info.odds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = nbrcts_info[i].cts_info.lodds.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcl[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = nbrcts_info[i].cts_info.orss.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.orss.v_bcl[j],
+                              nbrcts_info[i].cts_info.orss.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = nbrcts_info[i].cts_info.eds.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.eds.v_bcl[j],
+                              nbrcts_info[i].cts_info.eds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = nbrcts_info[i].cts_info.seds.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.seds.v_bcl[j],
+                              nbrcts_info[i].cts_info.seds.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = nbrcts_info[i].cts_info.edi.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.edi.v_bcl[j],
+                              nbrcts_info[i].cts_info.edi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = nbrcts_info[i].cts_info.sedi.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcl[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcu[j]);
+
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = nbrcts_info[i].cts_info.bagss.v;
+      nbrcts_r_rep[i].get_stat(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcl[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-   if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-   if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+   if(cts_tmp)      { delete [] cts_tmp;      cts_tmp      = (CTSInfo *)      0; }
+   if(nbrcts_r_rep) { delete [] nbrcts_r_rep; nbrcts_r_rep = (BootRepStore *) 0; }
 
    return;
 }
@@ -3384,14 +2834,13 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
    int n = 0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
-   NBRCNTInfo nbrcnt_tmp;
+   NumArray i_na, sr_na;
+   BootTaskInfo info;
 
    //
-   // Temp file streams for continuous statistics
+   // Replicate stores for continuous statistics
    //
-   ofstream nbrcnt_r_out;
-   ConcatString nbrcnt_r_file, prefix;
+   BootRepStore nbrcnt_r_rep;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -3423,141 +2872,92 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcnt_flag) return;
 
    //
-   // Build the temp file names
-   //
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_r";
-   nbrcnt_r_file = make_temp_file_name(prefix.c_str(), NULL);
-
-   //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Size the replicate stores
    //
-   try {
+   nbrcnt_r_rep.set_size(n_nbrcnt_boot_stat, b, tmp_dir, "tmp_nbrcnt_r");
 
-      //
-      // Open up the temp files
-      //
-      nbrcnt_r_out.open(nbrcnt_r_file.c_str());
-      if(!nbrcnt_r_out) {
-         mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << nbrcnt_r_file << "\n\n";
-         throw(1);
-      }
-
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
-
-         ran_sample(rng_ptr, i_na, ir_na, n);
-
-         //
-         // Compute continuous stats for each replicate
-         //
-         compute_nbrcntinfo(pd, pd_thr, ir_na, nbrcnt_tmp, 1);
-         write_nbrcntinfo(nbrcnt_r_out, nbrcnt_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      nbrcnt_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for FBS
-      //
-      s = nbrcnt_info.fbs.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fbs.v_bcl[i],
-                              nbrcnt_info.fbs.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for FSS
-      //
-      s = nbrcnt_info.fss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fss.v_bcl[i],
-                              nbrcnt_info.fss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for AFSS
-      //
-      s = nbrcnt_info.afss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.afss.v_bcl[i],
-                              nbrcnt_info.afss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for UFSS
-      //
-      s = nbrcnt_info.ufss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.ufss.v_bcl[i],
-                              nbrcnt_info.ufss.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for F_RATE
-      //
-      s = nbrcnt_info.f_rate.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.f_rate.v_bcl[i],
-                              nbrcnt_info.f_rate.v_bcu[i]);
+   //
+   // Compute the continuous stats for each resampled replicate,
+   // splitting the work across threads
+   //
+   info.pd          = &pd;
+   info.pd_thr      = &pd_thr;
+   info.i_na        = &i_na;
+   info.m           = n;
+   info.boot_rep    = &nbrcnt_r_rep;
+   run_boot_tasks(info, rng_ptr, (ThreadTaskFunction) 0, n,
+                  nbrcnt_boot_task, b);
 
-      //
-      // Compute bootstrap interval for O_RATE
-      //
-      s = nbrcnt_info.o_rate.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.o_rate.v_bcl[i],
-                              nbrcnt_info.o_rate.v_bcu[i]);
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-   } // end try block
+   //
+   // Compute bootstrap interval for FBS
+   //
+   s = nbrcnt_info.fbs.v;
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fbs.v_bcl[i],
+                           nbrcnt_info.fbs.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for FSS
    //
-   catch(int i_err) {
+   s = nbrcnt_info.fss.v;
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fss.v_bcl[i],
+                           nbrcnt_info.fss.v_bcu[i]);
 
-      mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for AFSS
+   //
+   s = nbrcnt_info.afss.v;
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.afss.v_bcl[i],
+                           nbrcnt_info.afss.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(nbrcnt_r_file);
+   //
+   // Compute bootstrap interval for UFSS
+   //
+   s = nbrcnt_info.ufss.v;
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.ufss.v_bcl[i],
+                           nbrcnt_info.ufss.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for F_RATE
+   //
+   s = nbrcnt_info.f_rate.v;
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.f_rate.v_bcl[i],
+                           nbrcnt_info.f_rate.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for O_RATE
    //
-   remove_temp_file(nbrcnt_r_file);
+   s = nbrcnt_info.o_rate.v;
+   nbrcnt_r_rep.get_stat(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.o_rate.v_bcl[i],
+                           nbrcnt_info.o_rate.v_bcu[i]);
 
    return;
 }
@@ -3828,103 +3228,766 @@ void compute_perc_interval(double s, NumArray &sr_na,
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_cntinfo(ofstream &tmp_out, const CNTInfo &c) {
-   char line[max_line_len];
+void store_cntinfo(BootRepStore &rep, int i_rep, const CNTInfo &c) {
+   const double v[n_cnt_boot_stat] = {
+      c.fbar.v,    c.fstdev.v,    c.obar.v,    c.ostdev.v,
+      c.pr_corr.v, c.anom_corr.v, c.rmsfa.v,   c.rmsoa.v,
+      c.me.v,      c.me2.v,       c.estdev.v,  c.mbias.v,
+      c.mae.v,     c.mse.v,       c.msess.v,   c.bcmse.v,
+      c.rmse.v,    c.e10.v,       c.e25.v,     c.e50.v,
+      c.e75.v,     c.e90.v,       c.eiqr.v,    c.mad.v
+   };
+
+   rep.set_rep(i_rep, v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void store_ctsinfo(BootRepStore &rep, int i_rep, const CTSInfo &c) {
+   const double v[n_cts_boot_stat] = {
+      c.baser.v,   c.fmean.v,   c.acc.v,     c.fbias.v,
+      c.pody.v,    c.podn.v,    c.pofd.v,    c.far.v,
+      c.csi.v,     c.gss.v,     c.hk.v,      c.hss.v,
+      c.odds.v,    c.lodds.v,   c.orss.v,    c.eds.v,
+      c.seds.v,    c.edi.v,     c.sedi.v,    c.bagss.v
+   };
+
+   rep.set_rep(i_rep, v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void store_mctsinfo(BootRepStore &rep, int i_rep, const MCTSInfo &c) {
+   const double v[n_mcts_boot_stat] = {
+      c.acc.v, c.hk.v, c.hss.v, c.ger.v
+   };
+
+   rep.set_rep(i_rep, v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void store_nbrcntinfo(BootRepStore &rep, int i_rep, const NBRCNTInfo &c) {
+   const double v[n_nbrcnt_boot_stat] = {
+      c.fbs.v, c.fss.v, c.afss.v, c.ufss.v, c.f_rate.v, c.o_rate.v
+   };
+
+   rep.set_rep(i_rep, v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+//
+// Jackknife and bootstrap tasks run over the index range [i_beg, i_end)
+// with per-thread temporary objects.
+//
+////////////////////////////////////////////////////////////////////////
+
+void cts_jack_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   CTSInfo cts_tmp[n_cts_jack_cell];
+   bool vld[n_cts_jack_cell];
+   int i, j, k;
+
+   for(i=0; i<info->n_info; i++) {
+
+      //
+      // Removing a pair only decrements the cell it falls in, so
+      // compute the stats once for each cell of the full table
+      //
+      for(k=0; k<n_cts_jack_cell; k++) {
+         cts_tmp[k].cts = info->cts_info[i].cts;
+         vld[k] = dec_cts_jack_cell(cts_tmp[k].cts, k);
+         if(vld[k]) cts_tmp[k].compute_stats();
+      }
+
+      for(j=i_beg; j<i_end; j++) {
+         k = cts_jack_cell(info->cts_info[i], *info->pd, j);
+         if(!vld[k]) {
+            mlog << Error << "\ncts_jack_task() -> "
+                 << "pair " << j << " does not match the contingency "
+                 << "table counts!\n\n";
+            exit(1);
+         }
+         store_ctsinfo(info->jack_rep[i], j, cts_tmp[k]);
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void cts_boot_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   CTSInfo *cts_tmp = new CTSInfo [info->n_info];
+   NumArray ir_na;
+   int i, j;
+
+   for(j=0; j<info->n_info; j++) {
+      cts_tmp[j].fthresh = info->cts_info[j].fthresh;
+      cts_tmp[j].othresh = info->cts_info[j].othresh;
+   }
+
+   for(i=i_beg; i<i_end; i++) {
+
+      ran_sample(info->rng[i_thread], *info->i_na, ir_na, info->m);
+
+      //
+      // Compute categorical stats for each replicate with the
+      // cts_flag set and the normal_ci_flag unset
+      //
+      for(j=0; j<info->n_info; j++) {
+         compute_ctsinfo(*info->pd, ir_na, true, false, cts_tmp[j]);
+         store_ctsinfo(info->boot_rep[j], i, cts_tmp[j]);
+      }
+   }
+
+   if(cts_tmp) { delete [] cts_tmp; cts_tmp = (CTSInfo *) 0; }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void mcts_jack_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   const MCTSInfo *mi = info->mcts_info;
+   const PairDataPoint *pd = info->pd;
+   int i, k, r, c, n_cat, v;
+   vector<MCTSInfo *> mcts_tmp;
+
+   //
+   // Removing a pair only decrements the cell it falls in, so
+   // compute the stats once for each non-empty cell of the full table
+   //
+   n_cat = mi->cts.nrows();
+   mcts_tmp.assign(n_cat*n_cat, (MCTSInfo *) 0);
+   for(r=0; r<n_cat; r++) {
+      for(c=0; c<n_cat; c++) {
+         if((v = mi->cts.entry(r, c)) <= 0) continue;
+         k = r*n_cat + c;
+         mcts_tmp[k] = new MCTSInfo;
+         mcts_tmp[k]->cts = mi->cts;
+         mcts_tmp[k]->cts.set_entry(r, c, v - 1);
+         mcts_tmp[k]->compute_stats();
+      }
+   }
+
+   for(i=i_beg; i<i_end; i++) {
+      k = mcts_jack_cell(*mi, *pd, i);
+      if(k < 0 || !mcts_tmp[k]) {
+         mlog << Error << "\nmcts_jack_task() -> "
+              << "pair " << i << " does not match the contingency "
+              << "table counts!\n\n";
+         exit(1);
+      }
+      store_mctsinfo(*info->jack_rep, i, *mcts_tmp[k]);
+   }
+
+   for(k=0; k<(int) mcts_tmp.size(); k++) {
+      if(mcts_tmp[k]) { delete mcts_tmp[k]; mcts_tmp[k] = (MCTSInfo *) 0; }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void mcts_boot_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   MCTSInfo mcts_tmp = *info->mcts_info;
+   NumArray ir_na;
+   int i;
+
+   for(i=i_beg; i<i_end; i++) {
+      ran_sample(info->rng[i_thread], *info->i_na, ir_na, info->m);
+      compute_mctsinfo(*info->pd, ir_na, true, false, mcts_tmp);
+      store_mctsinfo(*info->boot_rep, i, mcts_tmp);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void cnt_jack_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   CNTInfo cnt_tmp;
+   int i;
+
+   for(i=i_beg; i<i_end; i++) {
+      compute_i_cnt_jack(*info->cnt_sums, *info->pd, i, cnt_tmp);
+      store_cntinfo(*info->jack_rep, i, cnt_tmp);
+   }
+
+   return;
+}
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f",
-           c.fbar.v,    c.fstdev.v,    c.obar.v,    c.ostdev.v,
-           c.pr_corr.v, c.anom_corr.v, c.rmsfa.v,   c.rmsoa.v,
-           c. me.v,     c.me2.v,       c.estdev.v,  c.mbias.v,
-           c.mae.v,     c.mse.v,       c.msess.v,   c.bcmse.v,
-           c.rmse.v,    c.e10.v,       c.e25.v,     c.e50.v,
-           c.e75.v,     c.e90.v,       c.eiqr.v,    c.mad.v);
+////////////////////////////////////////////////////////////////////////
 
-   tmp_out << line << "\n";
+void cnt_boot_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   CNTInfo cnt_tmp;
+   NumArray ir_na;
+   int i;
+
+   for(i=i_beg; i<i_end; i++) {
+      ran_sample(info->rng[i_thread], *info->i_na, ir_na, info->m);
+      compute_cntinfo(*info->pd, ir_na, info->precip_flag,
+                      false, false, cnt_tmp);
+      store_cntinfo(*info->boot_rep, i, cnt_tmp);
+   }
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_ctsinfo(ofstream &tmp_out, const CTSInfo &c) {
-   char line[max_line_len];
+void nbrcnt_jack_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   NBRCNTInfo nbrcnt_tmp;
+   int i;
+
+   for(i=i_beg; i<i_end; i++) {
+      compute_i_nbrcnt_jack(*info->nbrcnt_sums, *info->pd, *info->pd_thr,
+                            i, nbrcnt_tmp);
+      store_nbrcntinfo(*info->jack_rep, i, nbrcnt_tmp);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f",
-           c.baser.v,   c.fmean.v,   c.acc.v,     c.fbias.v,
-           c.pody.v,    c.podn.v,    c.pofd.v,    c.far.v,
-           c.csi.v,     c.gss.v,     c.hk.v,      c.hss.v,
-           c.odds.v,    c.lodds.v,   c.orss.v,    c.eds.v,
-           c.seds.v,    c.edi.v,     c.sedi.v,    c.bagss.v
-          );
+void nbrcnt_boot_task(void *data, int i_thread, int i_beg, int i_end) {
+   const BootTaskInfo *info = (const BootTaskInfo *) data;
+   NBRCNTInfo nbrcnt_tmp;
+   NumArray ir_na;
+   int i;
 
-   tmp_out << line << "\n";
+   for(i=i_beg; i<i_end; i++) {
+      ran_sample(info->rng[i_thread], *info->i_na, ir_na, info->m);
+      compute_nbrcntinfo(*info->pd, *info->pd_thr, ir_na, nbrcnt_tmp, 1);
+      store_nbrcntinfo(*info->boot_rep, i, nbrcnt_tmp);
+   }
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
+//
+// Run the jackknife task over the n data points and the bootstrap
+// task over the b replicates.  With a single thread, the caller's
+// random number generator is used directly so that the results match
+// the serial computation.  Otherwise, each thread draws from its own
+// stream seeded from the caller's generator, so the results are
+// reproducible for a given seed and number of threads.
+//
+////////////////////////////////////////////////////////////////////////
+
+void run_boot_tasks(BootTaskInfo &info, const gsl_rng *rng_ptr,
+                    ThreadTaskFunction jack_task, int n,
+                    ThreadTaskFunction boot_task, int b) {
+   vector<gsl_rng *> streams;
+   vector<const gsl_rng *> rngs;
+   int i, n_threads;
+
+   //
+   // Jackknife samples do not depend on the random number generator
+   //
+   if(jack_task) run_thread_tasks(jack_task, &info, n, get_num_threads());
+
+   if(!boot_task || b <= 0) return;
 
-void write_mctsinfo(ofstream &tmp_out, const MCTSInfo &c) {
-   char line[max_line_len];
+   n_threads = min(get_num_threads(), b);
+
+   if(n_threads <= 1) {
+      rngs.push_back(rng_ptr);
+   }
+   else {
+      streams.resize(n_threads);
+      rng_split(rng_ptr, n_threads, streams.data());
+      for(i=0; i<n_threads; i++) rngs.push_back(streams[i]);
+   }
 
-   snprintf(line, max_line_len, "%f %f %f %f",
-           c.acc.v, c.hk.v, c.hss.v, c.ger.v);
+   info.rng = rngs.data();
+   run_thread_tasks(boot_task, &info, b, n_threads);
+   info.rng = (const gsl_rng **) 0;
 
-   tmp_out << line << "\n";
+   for(i=0; i<(int) streams.size(); i++) rng_free(streams[i]);
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_nbrcntinfo(ofstream &tmp_out, const NBRCNTInfo &c) {
-   char line[max_line_len];
+////////////////////////////////////////////////////////////////////////
+//
+// Contingency table cell for the i-th pair, matching CTSInfo::add().
+//
+////////////////////////////////////////////////////////////////////////
+
+int cts_jack_cell(const CTSInfo &cts_info, const PairDataPoint &pd, int i) {
+   bool f_flag, o_flag;
+
+   f_flag = cts_info.fthresh.check(pd.f_na[i], pd.cmn_na[i], pd.csd_na[i]);
+   o_flag = cts_info.othresh.check(pd.o_na[i], pd.cmn_na[i], pd.csd_na[i]);
+
+   return((f_flag ? 0 : 2) + (o_flag ? 0 : 1));
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Multi-category contingency table cell, r*n_cat + c, for the i-th
+// pair, matching MCTSInfo::add().  Returns -1 if the pair falls outside
+// the table.
+//
+////////////////////////////////////////////////////////////////////////
+
+int mcts_jack_cell(const MCTSInfo &mcts_info, const PairDataPoint &pd, int i) {
+   int r, c, n_cat;
+
+   n_cat = mcts_info.cts.nrows();
+   r = mcts_info.fthresh.check_bins(pd.f_na[i], pd.cmn_na[i], pd.csd_na[i]);
+   c = mcts_info.othresh.check_bins(pd.o_na[i], pd.cmn_na[i], pd.csd_na[i]);
+
+   if(r < 0 || r >= n_cat || c < 0 || c >= n_cat) return(-1);
+
+   return(r*n_cat + c);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Remove one count from a contingency table cell.  Returns false if the
+// cell is empty.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool dec_cts_jack_cell(TTContingencyTable &cts, int k) {
+   bool status = true;
+
+   switch(k) {
+      case 0:  if((status = cts.fy_oy() > 0)) cts.set_fy_oy(cts.fy_oy() - 1); break;
+      case 1:  if((status = cts.fy_on() > 0)) cts.set_fy_on(cts.fy_on() - 1); break;
+      case 2:  if((status = cts.fn_oy() > 0)) cts.set_fn_oy(cts.fn_oy() - 1); break;
+      case 3:  if((status = cts.fn_on() > 0)) cts.set_fn_on(cts.fn_on() - 1); break;
+      default: status = false; break;
+   }
+
+   return(status);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Percentile of a sorted array with the element at index skip removed,
+// matching percentile() on the reduced array.  No element is removed
+// when skip is negative.
+//
+////////////////////////////////////////////////////////////////////////
+
+double percentile_skip(const vector<double> &v, int skip, double t) {
+   int n, index, i1, i2;
+   double delta;
+
+   n = (int) v.size() - (skip >= 0 ? 1 : 0);
+
+   if(n <= 0) return(bad_data_double);
+
+   index = nint(floor((n - 1)*t));
+   delta = (n - 1)*t - index;
+
+   i1 = (skip >= 0 && index     >= skip ? index + 1 : index    );
+   i2 = (skip >= 0 && index + 1 >= skip ? index + 2 : index + 1);
+
+   if(i2 >= (int) v.size()) return(v[i1]);
+
+   return((1 - delta)*v[i1] + delta*v[i2]);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Accumulate the weighted partial sums and sorted errors of the valid
+// pairs, as used by compute_cntinfo().
+//
+////////////////////////////////////////////////////////////////////////
+
+void compute_cnt_jack_sums(const PairDataPoint &pd, CNTJackSums &s) {
+   int i, j, k, n_pair, n_vld, idx;
+   double f, o, c, wgt, err;
+   vector< pair<double,int> > srt;
+   vector<int> skip;
+
+   n_pair = pd.f_na.n();
+
+   s.cmn_flag = set_climo_flag(pd.f_na, pd.cmn_na);
+   s.n = 0;
+   s.w = s.f = s.o = s.ff = s.oo = s.fo = 0.0;
+   s.err = s.abs_err = s.err_sq = 0.0;
+   s.fa = s.oa = s.ffa = s.ooa = s.foa = 0.0;
+   s.vld.assign(n_pair, false);
+   s.err_rank.assign(n_pair, -1);
+
+   for(i=0; i<n_pair; i++) {
+
+      f   = pd.f_na[i];
+      o   = pd.o_na[i];
+      c   = (s.cmn_flag ? pd.cmn_na[i] : bad_data_double);
+      wgt = pd.wgt_na[i];
+
+      if(is_bad_data(f) ||
+         is_bad_data(o) ||
+         (s.cmn_flag && is_bad_data(c))) continue;
+
+      err = f-o;
+      srt.push_back(pair<double,int>(err, i));
+
+      s.vld[i]    = true;
+      s.w        += wgt;
+      s.f        += wgt*f;
+      s.o        += wgt*o;
+      s.ff       += wgt*f*f;
+      s.oo       += wgt*o*o;
+      s.fo       += wgt*f*o;
+      s.err      += wgt*err;
+      s.abs_err  += wgt*fabs(err);
+      s.err_sq   += wgt*err*err;
+      s.n++;
+
+      if(s.cmn_flag) {
+         s.fa  += wgt*(f-c);
+         s.oa  += wgt*(o-c);
+         s.foa += wgt*(f-c)*(o-c);
+         s.ffa += wgt*(f-c)*(f-c);
+         s.ooa += wgt*(o-c)*(o-c);
+      }
+   }
+
+   //
+   // Sort the errors and store the rank of each pair
+   //
+   sort(srt.begin(), srt.end());
+   n_vld = (int) srt.size();
+   s.err_srt.resize(n_vld);
+   for(i=0; i<n_vld; i++) {
+      s.err_srt[i]             = srt[i].first;
+      s.err_rank[srt[i].second] = i;
+   }
+
+   //
+   // The leave-one-out median takes at most a few distinct values,
+   // depending on where the removed error falls relative to the
+   // middle of the sorted array.  Store the sorted absolute deviations
+   // from each of them for the median absolute deviation.
+   //
+   idx = (n_vld >= 2 ? nint(floor((n_vld - 2)*0.5)) : 0);
+   skip.push_back(0);
+   skip.push_back(idx);
+   skip.push_back(idx + 1);
+   skip.push_back(idx + 2);
+   skip.push_back(n_vld - 1);
+   if(n_vld < n_pair) skip.push_back(-1);
+
+   s.mad_ctr.clear();
+   s.dev_srt.clear();
+   for(i=0; i<(int) skip.size(); i++) {
+
+      if(skip[i] >= n_vld || (skip[i] < 0 && n_vld == n_pair)) continue;
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f",
-           c.fbs.v, c.fss.v, c.afss.v, c.ufss.v, c.f_rate.v, c.o_rate.v);
+      c = percentile_skip(s.err_srt, skip[i], 0.50);
+      if(is_bad_data(c)) continue;
 
-   tmp_out << line << "\n";
+      for(j=0; j<(int) s.mad_ctr.size(); j++) if(s.mad_ctr[j] == c) break;
+      if(j < (int) s.mad_ctr.size()) continue;
+
+      s.mad_ctr.push_back(c);
+      s.dev_srt.push_back(vector<double>(n_vld));
+      for(k=0; k<n_vld; k++) s.dev_srt.back()[k] = fabs(s.err_srt[k] - c);
+      sort(s.dev_srt.back().begin(), s.dev_srt.back().end());
+   }
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
+//
+// Compute the CNTInfo object with the pair at index skip removed from
+// the partial sums, using the same formulas as compute_cntinfo() with
+// the rank_flag and normal_ci_flag unset.  The weights of the
+// remaining pairs are normalized to sum to one.
+//
+////////////////////////////////////////////////////////////////////////
+
+void compute_i_cnt_jack(const CNTJackSums &s, const PairDataPoint &pd,
+                        int skip, CNTInfo &cnt_info) {
+   int i, n, rank, i_dev;
+   double f, o, c, wgt, err, w, den;
+   double f_bar, o_bar, ff_bar, oo_bar, fo_bar;
+   double fa_bar, oa_bar, ffa_bar, ooa_bar, foa_bar;
+   double err_bar, abs_err_bar, err_sq_bar;
+   const vector<double> *dev = (const vector<double> *) 0;
+
+   //
+   // Remove the skipped pair, if valid, from the partial sums
+   //
+   n           = s.n;
+   w           = s.w;
+   f_bar       = s.f;
+   o_bar       = s.o;
+   ff_bar      = s.ff;
+   oo_bar      = s.oo;
+   fo_bar      = s.fo;
+   err_bar     = s.err;
+   abs_err_bar = s.abs_err;
+   err_sq_bar  = s.err_sq;
+   fa_bar      = s.fa;
+   oa_bar      = s.oa;
+   ffa_bar     = s.ffa;
+   ooa_bar     = s.ooa;
+   foa_bar     = s.foa;
+   rank        = -1;
+
+   if(s.vld[skip]) {
+
+      f    = pd.f_na[skip];
+      o    = pd.o_na[skip];
+      c    = (s.cmn_flag ? pd.cmn_na[skip] : bad_data_double);
+      wgt  = pd.wgt_na[skip];
+      err  = f-o;
+      rank = s.err_rank[skip];
+
+      n--;
+      w           -= wgt;
+      f_bar       -= wgt*f;
+      o_bar       -= wgt*o;
+      ff_bar      -= wgt*f*f;
+      oo_bar      -= wgt*o*o;
+      fo_bar      -= wgt*f*o;
+      err_bar     -= wgt*err;
+      abs_err_bar -= wgt*fabs(err);
+      err_sq_bar  -= wgt*err*err;
+
+      if(s.cmn_flag) {
+         fa_bar  -= wgt*(f-c);
+         oa_bar  -= wgt*(o-c);
+         foa_bar -= wgt*(f-c)*(o-c);
+         ffa_bar -= wgt*(f-c)*(f-c);
+         ooa_bar -= wgt*(o-c)*(o-c);
+      }
+   }
+
+   //
+   // Store the sample size
+   //
+   cnt_info.n = n;
+
+   if(n == 0 || is_eq(w, 0.0)) {
+      cnt_info.fbar.v      = cnt_info.fstdev.v    = bad_data_double;
+      cnt_info.obar.v      = cnt_info.ostdev.v    = bad_data_double;
+      cnt_info.pr_corr.v   = cnt_info.anom_corr.v = bad_data_double;
+      cnt_info.rmsfa.v     = cnt_info.rmsoa.v     = bad_data_double;
+      cnt_info.me.v        = cnt_info.me2.v       = bad_data_double;
+      cnt_info.estdev.v    = cnt_info.mbias.v     = bad_data_double;
+      cnt_info.mae.v       = cnt_info.mse.v       = bad_data_double;
+      cnt_info.msess.v     = cnt_info.bcmse.v     = bad_data_double;
+      cnt_info.rmse.v      = cnt_info.e10.v       = bad_data_double;
+      cnt_info.e25.v       = cnt_info.e50.v       = bad_data_double;
+      cnt_info.e75.v       = cnt_info.e90.v       = bad_data_double;
+      cnt_info.eiqr.v      = cnt_info.mad.v       = bad_data_double;
+      return;
+   }
+
+   //
+   // Normalize the sums by the remaining weight
+   //
+   f_bar       /= w;
+   o_bar       /= w;
+   ff_bar      /= w;
+   oo_bar      /= w;
+   fo_bar      /= w;
+   err_bar     /= w;
+   abs_err_bar /= w;
+   err_sq_bar  /= w;
+   fa_bar      /= w;
+   oa_bar      /= w;
+   ffa_bar     /= w;
+   ooa_bar     /= w;
+   foa_bar     /= w;
+
+   //
+   // Compute forecast and observation means and standard deviations
+   //
+   cnt_info.fbar.v   = f_bar;
+   cnt_info.fstdev.v = compute_stdev(f_bar*n, ff_bar*n, n);
+   cnt_info.obar.v   = o_bar;
+   cnt_info.ostdev.v = compute_stdev(o_bar*n, oo_bar*n, n);
 
-void read_ldf(const ConcatString file_name, int col, NumArray &na) {
-   LineDataFile ldf_in;
-   DataLine line;
-   double v;
+   //
+   // Compute multiplicative bias
+   //
+   if(is_eq(cnt_info.obar.v, 0.0))
+      cnt_info.mbias.v = bad_data_double;
+   else
+      cnt_info.mbias.v = cnt_info.fbar.v/cnt_info.obar.v;
+
+   //
+   // Compute Pearson correlation coefficient
+   //
+   cnt_info.pr_corr.v = compute_corr( f_bar*n,  o_bar*n,
+                                     ff_bar*n, oo_bar*n,
+                                     fo_bar*n, n);
 
    //
-   // Open up the input file for reading
+   // Process anomaly scores
    //
-   if(!ldf_in.open(file_name.c_str())) {
-      mlog << Error << "\nread_ldf() -> "
-           << "can't open file: " << file_name << "\n\n"
-          ;
-      throw(1);
+   if(s.cmn_flag) {
+      cnt_info.anom_corr.v = compute_corr( fa_bar*n,  oa_bar*n,
+                                          ffa_bar*n, ooa_bar*n,
+                                          foa_bar*n, n);
+      cnt_info.rmsfa.v     = sqrt(ffa_bar);
+      cnt_info.rmsoa.v     = sqrt(ooa_bar);
+   }
+   else {
+      cnt_info.anom_corr.v = bad_data_double;
+      cnt_info.rmsfa.v     = bad_data_double;
+      cnt_info.rmsoa.v     = bad_data_double;
    }
 
    //
-   // Clear out the NumArray
+   // Compute percentiles of the error from the sorted errors
    //
-   na.clear();
+   cnt_info.e10.v  = percentile_skip(s.err_srt, rank, 0.10);
+   cnt_info.e25.v  = percentile_skip(s.err_srt, rank, 0.25);
+   cnt_info.e50.v  = percentile_skip(s.err_srt, rank, 0.50);
+   cnt_info.e75.v  = percentile_skip(s.err_srt, rank, 0.75);
+   cnt_info.e90.v  = percentile_skip(s.err_srt, rank, 0.90);
+   cnt_info.eiqr.v = cnt_info.e75.v - cnt_info.e25.v;
 
    //
-   // Read the data in the column specified
+   // Compute the median absolute deviation by removing the deviation
+   // of the skipped pair from the sorted deviations about this median
    //
-   while(ldf_in >> line) {
-      v = atof(line.get_item(col-1));
-      if(!is_bad_data(v)) na.add(v);
+   for(i=0; i<(int) s.mad_ctr.size(); i++) {
+      if(s.mad_ctr[i] == cnt_info.e50.v) { dev = &s.dev_srt[i]; break; }
+   }
+
+   if(!dev) {
+      mlog << Error << "\ncompute_i_cnt_jack() -> "
+           << "no deviations stored for the median error of pair "
+           << skip << "!\n\n";
+      exit(1);
+   }
+
+   if(rank >= 0) {
+      err   = fabs(s.err_srt[rank] - cnt_info.e50.v);
+      i_dev = (int) (lower_bound(dev->begin(), dev->end(), err) - dev->begin());
    }
+   else {
+      i_dev = -1;
+   }
+   cnt_info.mad.v = percentile_skip(*dev, i_dev, 0.50);
 
    //
-   // Close the input file
+   // Compute the error statistics
    //
-   ldf_in.close();
+   cnt_info.me.v     = err_bar;
+   cnt_info.estdev.v = compute_stdev(n*err_bar, n*err_sq_bar, n);
+   cnt_info.me2.v    = cnt_info.me.v * cnt_info.me.v;
+   cnt_info.mae.v    = abs_err_bar;
+   cnt_info.mse.v    = err_sq_bar;
+
+   den = cnt_info.ostdev.v * cnt_info.ostdev.v;
+   cnt_info.msess.v = (is_eq(den, 0.0) ? bad_data_double :
+                       1.0 - (cnt_info.mse.v / den));
+
+   f = cnt_info.fbar.v;
+   o = cnt_info.obar.v;
+   cnt_info.bcmse.v = cnt_info.mse.v - (f-o)*(f-o);
+   cnt_info.rmse.v  = sqrt(err_sq_bar);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Accumulate the weighted partial sums used by compute_nbrcntinfo().
+//
+////////////////////////////////////////////////////////////////////////
+
+void compute_nbrcnt_jack_sums(const PairDataPoint &pd,
+                              const PairDataPoint &pd_thr,
+                              NBRCNTJackSums &s) {
+   int i;
+   double f, o, wgt;
+
+   s.n = pd.f_na.n();
+   s.w = s.ff = s.oo = s.fo = s.f_thr = s.o_thr = 0.0;
+
+   for(i=0; i<s.n; i++) {
+
+      f   = pd.f_na[i];
+      o   = pd.o_na[i];
+      wgt = pd.wgt_na[i];
+
+      s.w     += wgt;
+      s.ff    += wgt*f*f;
+      s.oo    += wgt*o*o;
+      s.fo    += wgt*f*o;
+      s.f_thr += wgt*pd_thr.f_na[i];
+      s.o_thr += wgt*pd_thr.o_na[i];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Compute the NBRCNTInfo object with the pair at index skip removed
+// from the partial sums.  The weights of the remaining pairs are
+// normalized to sum to one.
+//
+////////////////////////////////////////////////////////////////////////
+
+void compute_i_nbrcnt_jack(const NBRCNTJackSums &s,
+                           const PairDataPoint &pd,
+                           const PairDataPoint &pd_thr,
+                           int skip, NBRCNTInfo &nbrcnt_info) {
+   double f, o, wgt, w;
+
+   f   = pd.f_na[skip];
+   o   = pd.o_na[skip];
+   wgt = pd.wgt_na[skip];
+   w   = s.w - wgt;
+
+   nbrcnt_info.sl1l2_info.scount = s.n - 1;
+
+   if(s.n <= 1 || is_eq(w, 0.0)) {
+      nbrcnt_info.sl1l2_info.fobar = bad_data_double;
+      nbrcnt_info.sl1l2_info.ffbar = bad_data_double;
+      nbrcnt_info.sl1l2_info.oobar = bad_data_double;
+      nbrcnt_info.f_rate.v = nbrcnt_info.o_rate.v = bad_data_double;
+      nbrcnt_info.fbs.v    = nbrcnt_info.fss.v    = bad_data_double;
+      nbrcnt_info.afss.v   = nbrcnt_info.ufss.v   = bad_data_double;
+      return;
+   }
+
+   nbrcnt_info.sl1l2_info.fobar = (s.fo - wgt*f*o)/w;
+   nbrcnt_info.sl1l2_info.ffbar = (s.ff - wgt*f*f)/w;
+   nbrcnt_info.sl1l2_info.oobar = (s.oo - wgt*o*o)/w;
+
+   nbrcnt_info.f_rate.v = (s.f_thr - wgt*pd_thr.f_na[skip])/w;
+   nbrcnt_info.o_rate.v = (s.o_thr - wgt*pd_thr.o_na[skip])/w;
+
+   nbrcnt_info.compute_stats();
 
    return;
 }
@@ -97,6 +97,61 @@ extern void compute_bca_interval(double, NumArray &, NumArray &,
 extern void compute_perc_interval(double, NumArray &,
    double, double &, double &);
 
+////////////////////////////////////////////////////////////////////////
+//
+// Jackknife (leave-one-out) statistics for the BCa intervals, computed
+// from the full sample in constant time per pair rather than from the
+// remaining n-1 pairs.
+//
+////////////////////////////////////////////////////////////////////////
+
+//
+// Removing a pair only decrements the contingency table cell it falls
+// in: fy_oy, fy_on, fn_oy, or fn_on for cts and r*n_cat + c for mcts
+//
+
+extern int  cts_jack_cell(const CTSInfo &, const PairDataPoint &, int);
+extern bool dec_cts_jack_cell(TTContingencyTable &, int);
+extern int  mcts_jack_cell(const MCTSInfo &, const PairDataPoint &, int);
+
+//
+// Weighted partial sums of the full sample, from which the pair at
+// index skip is subtracted
+//
+
+struct CNTJackSums {
+   bool   cmn_flag;                 // Process climatology anomalies
+   int    n;                        // Number of valid pairs
+   double w;                        // Sum of the weights
+   double f, o, ff, oo, fo;         // Weighted sums of the pairs
+   double err, abs_err, err_sq;     // Weighted sums of the errors
+   double fa, oa, ffa, ooa, foa;    // Weighted sums of the anomalies
+
+   vector<bool>   vld;              // Valid flag for each pair
+   vector<int>    err_rank;         // Rank of each pair in err_srt
+   vector<double> err_srt;          // Sorted errors of the valid pairs
+
+   vector<double>           mad_ctr; // Possible leave-one-out medians
+   vector< vector<double> > dev_srt; // Sorted deviations from each one
+};
+
+struct NBRCNTJackSums {
+   int    n;                        // Number of pairs
+   double w;                        // Sum of the weights
+   double ff, oo, fo;               // Weighted sums of the pairs
+   double f_thr, o_thr;             // Weighted sums of the event flags
+};
+
+extern void compute_cnt_jack_sums(const PairDataPoint &, CNTJackSums &);
+extern void compute_i_cnt_jack(const CNTJackSums &, const PairDataPoint &,
+   int skip, CNTInfo &);
+
+extern void compute_nbrcnt_jack_sums(const PairDataPoint &,
+   const PairDataPoint &, NBRCNTJackSums &);
+extern void compute_i_nbrcnt_jack(const NBRCNTJackSums &,
+   const PairDataPoint &, const PairDataPoint &, int skip,
+   NBRCNTInfo &);
+
 ////////////////////////////////////////////////////////////////////////
 
 #endif   // __COMPUTE_CI_H__
@@ -225,6 +225,7 @@ void PairBase::set_msg_typ(const char *c) {
 void PairBase::set_msg_typ_vals(const StringArray &sa) {
 
    msg_typ_vals = sa;
+   msg_typ_vals.set_hashed(true);
 
    return;
 }
@@ -993,6 +993,7 @@ void VxPairDataEnsemble::set_interp_thresh(double t) {
 void VxPairDataEnsemble::set_msg_typ_sfc(const StringArray &sa) {
 
    msg_typ_sfc = sa;
+   msg_typ_sfc.set_hashed(true);
 
    return;
 }
@@ -1065,6 +1066,7 @@ void VxPairDataEnsemble::set_end_ut(const unixtime ut) {
 void VxPairDataEnsemble::set_sid_inc_filt(const StringArray sa) {
 
    sid_inc_filt = sa;
+   sid_inc_filt.set_hashed(true);
 
    return;
 }
@@ -1074,6 +1076,7 @@ void VxPairDataEnsemble::set_sid_inc_filt(const StringArray sa) {
 void VxPairDataEnsemble::set_sid_exc_filt(const StringArray sa) {
 
    sid_exc_filt = sa;
+   sid_exc_filt.set_hashed(true);
 
    return;
 }
@@ -1161,6 +1164,9 @@ void VxPairDataEnsemble::set_mask_sid(int i_mask, const char *name,
                                       StringArray *sid_ptr) {
    int i, j;
 
+   // Station ID lists are searched once per observation
+   if(sid_ptr) sid_ptr->set_hashed(true);
+
    for(i=0; i<n_msg_typ; i++) {
       for(j=0; j<n_interp; j++) {
          pd[i][i_mask][j].set_mask_name(name);
@@ -543,6 +543,7 @@ void VxPairDataPoint::set_end_ut(const unixtime ut) {
 void VxPairDataPoint::set_sid_inc_filt(const StringArray sa) {
 
    sid_inc_filt = sa;
+   sid_inc_filt.set_hashed(true);
 
    return;
 }
@@ -552,6 +553,7 @@ void VxPairDataPoint::set_sid_inc_filt(const StringArray sa) {
 void VxPairDataPoint::set_sid_exc_filt(const StringArray sa) {
 
    sid_exc_filt = sa;
+   sid_exc_filt.set_hashed(true);
 
    return;
 }
@@ -666,6 +668,9 @@ void VxPairDataPoint::set_mask_sid(int i_mask, const char *name,
                                    StringArray *sid_ptr) {
    int i, j;
 
+   // Station ID lists are searched once per observation
+   if(sid_ptr) sid_ptr->set_hashed(true);
+
    for(i=0; i<n_msg_typ; i++) {
       for(j=0; j<n_interp; j++) {
          pd[i][i_mask][j].set_mask_name(name);
@@ -733,6 +738,7 @@ void VxPairDataPoint::set_interp(int i_interp,
 void VxPairDataPoint::set_msg_typ_sfc(const StringArray &sa) {
 
    msg_typ_sfc = sa;
+   msg_typ_sfc.set_hashed(true);
 
    return;
 }
@@ -742,6 +748,7 @@ void VxPairDataPoint::set_msg_typ_sfc(const StringArray &sa) {
 void VxPairDataPoint::set_msg_typ_lnd(const StringArray &sa) {
 
    msg_typ_lnd = sa;
+   msg_typ_lnd.set_hashed(true);
 
    return;
 }
@@ -974,6 +981,22 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
    bool spfh_flag = fcst_info->is_specific_humidity() &&
                      obs_info->is_specific_humidity();
 
+   // Interpolate using the observation pressure level or height
+   to_lvl = (fcst_info->level().type() == LevelType_Pres ?
+             obs_lvl : obs_hgt);
+
+   // Flags for surface verification with land/sea and topo masks
+   bool is_sfc  = (sfc_info.land_ptr || sfc_info.topo_ptr) &&
+                  msg_typ_sfc.has(hdr_typ_str);
+   bool is_land = is_sfc && msg_typ_lnd.has(hdr_typ_str);
+
+   // The interpolated values depend only on the observation and the
+   // interpolation method, so they're computed at most once per method
+   vector<bool>   interp_done(n_interp, false);
+   vector<double> fcst_interp(n_interp, bad_data_double);
+   vector<double> cmn_interp(n_interp, bad_data_double);
+   vector<double> csd_interp(n_interp, bad_data_double);
+
    // Look through all of the PairDataPoint objects to see if the
    // observation should be added.
 
@@ -1019,19 +1042,22 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
          // Compute the interpolated values
          for(k=0; k<n_interp; k++) {
 
-            // Compute the interpolated forecast value using the
-            // observation pressure level or height
-            to_lvl = (fcst_info->level().type() == LevelType_Pres ?
-                      obs_lvl : obs_hgt);
+            // Interpolate once for each method and reuse the values
+            // for the remaining message types and masks
+            if(!interp_done[k]) {
+               compute_interp_vals(k, obs_x, obs_y, hdr_elv, obs_v,
+                                   to_lvl, spfh_flag, is_sfc, is_land,
+                                   f_lvl_blw, f_lvl_abv,
+                                   cmn_lvl_blw, cmn_lvl_abv,
+                                   csd_lvl_blw, csd_lvl_abv,
+                                   fcst_interp[k], cmn_interp[k],
+                                   csd_interp[k]);
+               interp_done[k] = true;
+            }
 
-            // Compute the interpolated climatology mean
-            cmn_v = compute_interp(climo_mn_dpa, obs_x, obs_y, obs_v,
-                       bad_data_double, bad_data_double,
-                       pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                       pd[0][0][k].interp_shape,
-                       interp_thresh, spfh_flag,
-                       fcst_info->level().type(),
-                       to_lvl, cmn_lvl_blw, cmn_lvl_abv);
+            fcst_v = fcst_interp[k];
+            cmn_v  = cmn_interp[k];
+            csd_v  = csd_interp[k];
 
             // Check for bad data
             if(climo_mn_dpa.n_planes() > 0 && is_bad_data(cmn_v)) {
@@ -1039,65 +1065,12 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
                continue;
             }
 
-            // Check for valid interpolation options
-            if(climo_sd_dpa.n_planes() > 0 &&
-               (pd[0][0][k].interp_mthd == InterpMthd_Min    ||
-                pd[0][0][k].interp_mthd == InterpMthd_Max    ||
-                pd[0][0][k].interp_mthd == InterpMthd_Median ||
-                pd[0][0][k].interp_mthd == InterpMthd_Best)) {
-               mlog << Warning << "\nVxPairDataPoint::add_point_obs() -> "
-                    << "applying the "
-                    << interpmthd_to_string(pd[0][0][k].interp_mthd)
-                    << " interpolation method to climatological spread "
-                    << "may cause unexpected results.\n\n";
-            }
-
-            // Compute the interpolated climatology standard deviation
-            csd_v = compute_interp(climo_sd_dpa, obs_x, obs_y, obs_v,
-                       bad_data_double, bad_data_double,
-                       pd[0][0][k].interp_mthd,  pd[0][0][k].interp_wdth,
-                       pd[0][0][k].interp_shape,
-                       interp_thresh, spfh_flag,
-                       fcst_info->level().type(),
-                       to_lvl, csd_lvl_blw, csd_lvl_abv);
-
             // Check for bad data
             if(climo_sd_dpa.n_planes() > 0 && is_bad_data(csd_v)) {
                inc_count(rej_csd, i, j, k);
                continue;
             }
 
-            // For surface verification, apply land/sea and topo masks
-            if((sfc_info.land_ptr || sfc_info.topo_ptr) &&
-               (msg_typ_sfc.has(hdr_typ_str))) {
-
-               bool is_land = msg_typ_lnd.has(hdr_typ_str);
-
-               // Check for a single forecast DataPlane
-               if(fcst_dpa.n_planes() != 1) {
-                  mlog << Error << "\nVxPairDataPoint::add_point_obs() -> "
-                       << "unexpected number of forecast levels ("
-                       << fcst_dpa.n_planes()
-                       << ") for surface verification! Set \"land_mask.flag\" and "
-                       << "\"topo_mask.flag\" to false to disable this check.\n\n";
-                  exit(1);
-               }
-
-               fcst_v = compute_sfc_interp(fcst_dpa[0], obs_x, obs_y, hdr_elv, obs_v,
-                           pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                           pd[0][0][k].interp_shape, interp_thresh, sfc_info,
-                           is_land);
-            }
-            // Otherwise, compute interpolated value
-            else {
-               fcst_v = compute_interp(fcst_dpa, obs_x, obs_y, obs_v, cmn_v, csd_v,
-                           pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                           pd[0][0][k].interp_shape,
-                           interp_thresh, spfh_flag,
-                           fcst_info->level().type(),
-                           to_lvl, f_lvl_blw, f_lvl_abv);
-            }
-
             if(is_bad_data(fcst_v)) {
                inc_count(rej_fcst, i, j, k);
                continue;
@@ -1123,6 +1096,92 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Compute the interpolated forecast, climatology mean, and climatology
+// standard deviation values for the k-th interpolation method.  The
+// later values are left as bad data once an earlier one is rejected.
+//
+////////////////////////////////////////////////////////////////////////
+
+void VxPairDataPoint::compute_interp_vals(int k, double obs_x, double obs_y,
+                                          double hdr_elv, double obs_v,
+                                          double to_lvl, bool spfh_flag,
+                                          bool is_sfc, bool is_land,
+                                          int f_lvl_blw, int f_lvl_abv,
+                                          int cmn_lvl_blw, int cmn_lvl_abv,
+                                          int csd_lvl_blw, int csd_lvl_abv,
+                                          double &fcst_v, double &cmn_v,
+                                          double &csd_v) const {
+
+   fcst_v = cmn_v = csd_v = bad_data_double;
+
+   // Compute the interpolated climatology mean
+   cmn_v = compute_interp(climo_mn_dpa, obs_x, obs_y, obs_v,
+              bad_data_double, bad_data_double,
+              pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+              pd[0][0][k].interp_shape,
+              interp_thresh, spfh_flag,
+              fcst_info->level().type(),
+              to_lvl, cmn_lvl_blw, cmn_lvl_abv);
+
+   if(climo_mn_dpa.n_planes() > 0 && is_bad_data(cmn_v)) return;
+
+   // Check for valid interpolation options
+   if(climo_sd_dpa.n_planes() > 0 &&
+      (pd[0][0][k].interp_mthd == InterpMthd_Min    ||
+       pd[0][0][k].interp_mthd == InterpMthd_Max    ||
+       pd[0][0][k].interp_mthd == InterpMthd_Median ||
+       pd[0][0][k].interp_mthd == InterpMthd_Best)) {
+      mlog << Warning << "\nVxPairDataPoint::add_point_obs() -> "
+           << "applying the "
+           << interpmthd_to_string(pd[0][0][k].interp_mthd)
+           << " interpolation method to climatological spread "
+           << "may cause unexpected results.\n\n";
+   }
+
+   // Compute the interpolated climatology standard deviation
+   csd_v = compute_interp(climo_sd_dpa, obs_x, obs_y, obs_v,
+              bad_data_double, bad_data_double,
+              pd[0][0][k].interp_mthd,  pd[0][0][k].interp_wdth,
+              pd[0][0][k].interp_shape,
+              interp_thresh, spfh_flag,
+              fcst_info->level().type(),
+              to_lvl, csd_lvl_blw, csd_lvl_abv);
+
+   if(climo_sd_dpa.n_planes() > 0 && is_bad_data(csd_v)) return;
+
+   // For surface verification, apply land/sea and topo masks
+   if(is_sfc) {
+
+      // Check for a single forecast DataPlane
+      if(fcst_dpa.n_planes() != 1) {
+         mlog << Error << "\nVxPairDataPoint::add_point_obs() -> "
+              << "unexpected number of forecast levels ("
+              << fcst_dpa.n_planes()
+              << ") for surface verification! Set \"land_mask.flag\" and "
+              << "\"topo_mask.flag\" to false to disable this check.\n\n";
+         exit(1);
+      }
+
+      fcst_v = compute_sfc_interp(fcst_dpa[0], obs_x, obs_y, hdr_elv, obs_v,
+                  pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+                  pd[0][0][k].interp_shape, interp_thresh, sfc_info,
+                  is_land);
+   }
+   // Otherwise, compute interpolated value
+   else {
+      fcst_v = compute_interp(fcst_dpa, obs_x, obs_y, obs_v, cmn_v, csd_v,
+                  pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+                  pd[0][0][k].interp_shape,
+                  interp_thresh, spfh_flag,
+                  fcst_info->level().type(),
+                  to_lvl, f_lvl_blw, f_lvl_abv);
+   }
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 int VxPairDataPoint::get_n_pair() const {
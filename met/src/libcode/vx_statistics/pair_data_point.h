@@ -80,6 +80,11 @@ class VxPairDataPoint {
       void init_from_scratch();
       void assign(const VxPairDataPoint &);
 
+      void compute_interp_vals(int, double, double, double, double,
+                               double, bool, bool, bool,
+                               int, int, int, int, int, int,
+                               double &, double &, double &) const;
+
    public:
 
       VxPairDataPoint();
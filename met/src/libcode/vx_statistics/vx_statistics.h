@@ -19,6 +19,7 @@
 
 
 #include "apply_mask.h"
+#include "boot_rep_store.h"
 #include "compute_ci.h"
 #include "contable.h"
 #include "met_stats.h"
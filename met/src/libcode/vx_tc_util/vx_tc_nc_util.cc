@@ -473,7 +473,7 @@ void write_tc_data(NcFile* nc_out, const TcrmwGrid& grid,
 ////////////////////////////////////////////////////////////////////////
 
 void write_tc_data_rev(NcFile* nc_out, const TcrmwGrid& grid,
-    const int& i_point, const NcVar& var, const double* data) {
+    const int& i_point, const NcVar& var, const dataplane_t* data) {
 
     vector<size_t> offsets;
     vector<size_t> counts;
@@ -553,7 +553,7 @@ void write_tc_azi_mean_data(NcFile* nc_out, const TcrmwGrid& grid,
 extern void write_tc_pressure_level_data(
     NcFile* nc_out, const TcrmwGrid& grid,
     map<string, int> pressure_level_indices, const string& level_str,
-    const int& i_point, const NcVar& var, const double* data) {
+    const int& i_point, const NcVar& var, const dataplane_t* data) {
 
     vector<size_t> offsets;
     vector<size_t> counts;
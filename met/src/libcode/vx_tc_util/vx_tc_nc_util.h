@@ -80,14 +80,14 @@ extern void write_tc_data(NcFile*, const TcrmwGrid&,
     const int&, const NcVar&, const double*);
 
 extern void write_tc_data_rev(NcFile*, const TcrmwGrid&,
-    const int&, const NcVar&, const double*);
+    const int&, const NcVar&, const dataplane_t*);
 
 extern void write_tc_azi_mean_data(NcFile*, const TcrmwGrid&,
     const int&, const NcVar&, const double*);
 
 extern void write_tc_pressure_level_data(NcFile*, const TcrmwGrid&,
     map<string, int>, const string&,
-    const int&, const NcVar&, const double*);
+    const int&, const NcVar&, const dataplane_t*);
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -2123,7 +2123,7 @@ void track_counts(int i_vx, const DataPlane &dp) {
    double v;
 
    // Pointers to data buffers for faster access
-   const double *Data = dp.data();
+   const dataplane_t *Data = dp.data();
    double *CountBuf   = count_na.buf();
    double *MinBuf     = min_na.buf();
    double *MaxBuf     = max_na.buf();
@@ -2178,7 +2178,7 @@ void track_counts(int i_vx, const DataPlane &dp) {
                ThreshBuf[i], conf_info.nbrhd_prob.vld_thresh); 
 
             // Increment counts
-            const double *Frac = frac_dp.data();
+            const dataplane_t *Frac = frac_dp.data();
             for(k=0; k<nxy; k++) {
                if(Frac[k] > 0) thresh_nbrhd_count_na[i][j].inc(k, 1);
             } // end for k 
@@ -2654,7 +2654,7 @@ void write_ens_nc(int i_ens, DataPlane &dp) {
                   prob_dp.buf()[k] = bad_data_double;
                }
                else {
-                  prob_dp.buf()[k] = (double) (thresh_nbrhd_count_na[i][j][k]/count_na[k]);
+                  prob_dp.buf()[k] = (dataplane_t) (thresh_nbrhd_count_na[i][j][k]/count_na[k]);
                }
             } // end for k
 
@@ -178,6 +178,9 @@ static void set_verbosity(const StringArray &);
 static void set_compress(const StringArray &);
 static bool read_data_plane(VarInfo* info, DataPlane& dp, Met2dDataFile* mtddf,
                             const ConcatString &filename);
+static void read_data_plane_list(VarInfo** info, int n, DataPlane* dp,
+                                 bool* status, Met2dDataFile* mtddf,
+                                 const ConcatString &filename);
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -642,12 +645,33 @@ void process_scores() {
    vl1l2_info  = new VL1L2Info  [n_wind];
    nbrcts_info = new NBRCTSInfo [n_cov];
 
+   // The forecast and observation fields are read one group at a time,
+   // so that the files can decode the fields of a group together
+   const int n_group = get_num_threads();
+   vector<VarInfo *> fcst_info_list(n_group), obs_info_list(n_group);
+   vector<DataPlane> fcst_dp_list(n_group),   obs_dp_list(n_group);
+   bool *fcst_status = new bool [n_group];
+   bool *obs_status  = new bool [n_group];
+
    // Compute scores for each verification task and write output_flag
    for(i=0; i<conf_info.get_n_vx(); i++) {
 
-      // Read the gridded data from the input forecast file
-      if(!read_data_plane(conf_info.vx_opt[i].fcst_info,
-                          fcst_dp, fcst_mtddf, fcst_file)) continue;
+      // Read the next group of forecast and observation fields
+      if(i%n_group == 0) {
+         n = min(n_group, conf_info.get_n_vx() - i);
+         for(j=0; j<n; j++) {
+            fcst_info_list[j] = conf_info.vx_opt[i+j].fcst_info;
+            obs_info_list[j]  = conf_info.vx_opt[i+j].obs_info;
+         }
+         read_data_plane_list(fcst_info_list.data(), n, fcst_dp_list.data(),
+                              fcst_status, fcst_mtddf, fcst_file);
+         read_data_plane_list(obs_info_list.data(), n, obs_dp_list.data(),
+                              obs_status, obs_mtddf, obs_file);
+      }
+
+      // Gridded data from the input forecast file
+      if(!fcst_status[i%n_group]) continue;
+      fcst_dp = fcst_dp_list[i%n_group];
 
       mlog << Debug(3)
            << "Reading forecast data for "
@@ -660,9 +684,9 @@ void process_scores() {
       shc.set_fcst_valid_beg(fcst_dp.valid());
       shc.set_fcst_valid_end(fcst_dp.valid());
 
-      // Read the gridded data from the input observation file
-      if(!read_data_plane(conf_info.vx_opt[i].obs_info,
-                          obs_dp, obs_mtddf, obs_file)) continue;
+      // Gridded data from the input observation file
+      if(!obs_status[i%n_group]) continue;
+      obs_dp = obs_dp_list[i%n_group];
 
       mlog << Debug(3)
            << "Reading observation data for "
@@ -1788,6 +1812,8 @@ void process_scores() {
    if(cts_info)    { delete [] cts_info;    cts_info    = (CTSInfo *)    0; }
    if(vl1l2_info)  { delete [] vl1l2_info;  vl1l2_info  = (VL1L2Info *)  0; }
    if(nbrcts_info) { delete [] nbrcts_info; nbrcts_info = (NBRCTSInfo *) 0; }
+   if(fcst_status) { delete [] fcst_status; fcst_status = (bool *)       0; }
+   if(obs_status)  { delete [] obs_status;  obs_status  = (bool *)       0; }
 
    return;
 }
@@ -2997,30 +3023,50 @@ void set_compress(const StringArray & a) {
 
 bool read_data_plane(VarInfo* info, DataPlane& dp, Met2dDataFile* mtddf,
                      const ConcatString &filename) {
+   bool status;
 
-   bool status = mtddf->data_plane(*info, dp);
+   read_data_plane_list(&info, 1, &dp, &status, mtddf, filename);
 
-   if(!status) {
-      mlog << Warning << "\nread_data_plane() -> "
-           << info->magic_str()
-           << " not found in file: " << filename
-           << "\n\n";
-      return false;
-   }
+   return(status);
+}
 
-   // Regrid, if necessary
-   if(!(mtddf->grid() == grid)) {
-      mlog << Debug(1)
-           << "Regridding field "
-           << info->magic_str()
-           << " to the verification grid.\n";
-      dp = met_regrid(dp, mtddf->grid(), grid, info->regrid());
-   }
+////////////////////////////////////////////////////////////////////////
+//
+// Read several fields from the same file at once, which lets GRIB2
+// files unpack them concurrently.
+//
+////////////////////////////////////////////////////////////////////////
 
-   // Rescale probabilities from [0, 100] to [0, 1]
-   if(info->p_flag()) rescale_probability(dp);
+void read_data_plane_list(VarInfo** info, int n, DataPlane* dp,
+                          bool* status, Met2dDataFile* mtddf,
+                          const ConcatString &filename) {
 
-   return(true);
+   mtddf->data_plane_list(info, n, dp, status);
+
+   for(int i=0; i<n; i++) {
+
+      if(!status[i]) {
+         mlog << Warning << "\nread_data_plane() -> "
+              << info[i]->magic_str()
+              << " not found in file: " << filename
+              << "\n\n";
+         continue;
+      }
+
+      // Regrid, if necessary
+      if(!(mtddf->grid() == grid)) {
+         mlog << Debug(1)
+              << "Regridding field "
+              << info[i]->magic_str()
+              << " to the verification grid.\n";
+         dp[i] = met_regrid(dp[i], mtddf->grid(), grid, info[i]->regrid());
+      }
+
+      // Rescale probabilities from [0, 100] to [0, 1]
+      if(info[i]->p_flag()) rescale_probability(dp[i]);
+   }
+
+   return;
 }
 
 ////////////////////////////////////////////////////////////////////////
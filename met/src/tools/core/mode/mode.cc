@@ -107,8 +107,26 @@ static int compress_level = -1;
 ///////////////////////////////////////////////////////////////////////
 
 
-static void do_quilt    ();
-static void do_straight ();
+   //
+   //  the threshold runs of one quilt radius
+   //
+
+struct QuiltTaskInfo {
+
+   const ModeExecutive * conv_exec;   //  not allocated, convolved for the current radius
+
+   ModeExecutive * runs;              //  not allocated, one per convolution threshold
+
+};
+
+///////////////////////////////////////////////////////////////////////
+
+
+static void do_quilt        ();
+static void do_quilt_serial ();
+static void do_straight     ();
+
+static void quilt_run_task(void *, int, int, int);
 
 static void process_command_line(int, char **);
 
@@ -228,6 +246,84 @@ void do_quilt()
 
 {
 
+const ModeConfInfo & conf = mode_exec.engine.conf_info;
+
+const int NCR = mode_exec.n_conv_radii();
+const int NCT = mode_exec.n_conv_threshs();
+
+const int n_threads = get_num_threads();
+
+const bool merge_engine = (conf.fcst_merge_flag == MergeType_Engine) ||
+                          (conf.fcst_merge_flag == MergeType_Both)   ||
+                          (conf.obs_merge_flag  == MergeType_Engine) ||
+                          (conf.obs_merge_flag  == MergeType_Both);
+
+int t_index, r_index;   //  indices into the convolution threshold and radius arrays
+ModeExecutive * runs = (ModeExecutive *) 0;
+QuiltTaskInfo info;
+
+   //
+   //  The fuzzy engine merging reads config files, which can't be
+   //  done concurrently, so run those serially
+   //
+
+if ( (n_threads < 2) || (NCT < 2) || merge_engine ||
+     (mlog.verbosity_level() >= print_interest_log_level) )  {
+
+   do_quilt_serial();
+
+   return;
+
+}
+
+   //
+   //  One executive per convolution threshold, each with its own engine
+   //
+
+runs = new ModeExecutive [NCT];
+
+for (t_index=0; t_index<NCT; ++t_index)  runs[t_index].init_quilt_run(mode_exec);
+
+info.conv_exec = &mode_exec;
+info.runs      = runs;
+
+for (r_index=0; r_index<NCR; ++r_index)  {
+
+      //
+      //  Convolve once for this radius, then identify, merge and match
+      //  the objects for each threshold concurrently from those fields
+      //
+
+   mode_exec.do_conv(r_index);
+
+   run_thread_tasks(quilt_run_task, &info, NCT, n_threads);
+
+      //
+      //  Write the output in the same order as the serial runs
+      //
+
+   for (t_index=0; t_index<NCT; ++t_index)  runs[t_index].process_output();
+
+}
+
+delete [] runs;  runs = (ModeExecutive *) 0;
+
+   //
+   //  done
+   //
+
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
+void do_quilt_serial()
+
+{
+
 int t_index, r_index;   //  indices into the convolution threshold and radius arrays
 
 
@@ -257,6 +353,29 @@ return;
 ///////////////////////////////////////////////////////////////////////
 
 
+void quilt_run_task(void * data, int, int i_beg, int i_end)
+
+{
+
+QuiltTaskInfo & info = *((QuiltTaskInfo *) data);
+int t_index;
+
+for (t_index=i_beg; t_index<i_end; ++t_index)  {
+
+   info.runs[t_index].do_conv_thresh(*(info.conv_exec), t_index);
+
+   info.runs[t_index].do_match_merge();
+
+}
+
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
 void process_command_line(int argc, char **argv)
 
 {
@@ -128,6 +128,8 @@ data_min = data_max = 0.0;
 
 R_index = T_index = 0;
 
+Conv_R_index = -1;
+
 
    //
    //  done
@@ -150,6 +152,8 @@ Met2dDataFileFactory mtddf_factory;
 
 R_index = T_index = 0;
 
+Conv_R_index = -1;
+
    // Create the default config file name
    default_config_file = replace_path(default_config_filename);
 
@@ -210,6 +214,68 @@ return;
 }
 
 
+///////////////////////////////////////////////////////////////////////
+//
+//  Set up this executive to run one convolution threshold of a quilt
+//  alongside the executive e, which has already been through init()
+//  and setup_fcst_obs_data().  The config files are read again since
+//  ModeConfInfo can't be copied, but the input files are not opened.
+//  The raw and convolved fields come from e in do_conv_thresh().
+//
+///////////////////////////////////////////////////////////////////////
+
+
+void ModeExecutive::init_quilt_run(const ModeExecutive & e)
+
+{
+
+ModeConfInfo & conf = engine.conf_info;
+
+clear();
+
+default_config_file = e.default_config_file;
+match_config_file   = e.match_config_file;
+merge_config_file   = e.merge_config_file;
+
+fcst_file = e.fcst_file;
+obs_file  = e.obs_file;
+
+out_dir = e.out_dir;
+
+conf.read_config(default_config_file.c_str(), match_config_file.c_str());
+
+   //
+   //  e has already reported any config warnings
+   //
+
+conf.process_config(e.fcst_mtddf->file_type(), e.obs_mtddf->file_type(), false);
+
+   //
+   //  pick up anything set while reading the data and
+   //  from the command line
+   //
+
+*(conf.fcst_info) = *(e.engine.conf_info.fcst_info);
+*(conf.obs_info)  = *(e.engine.conf_info.obs_info);
+
+conf.nc_info = e.engine.conf_info.nc_info;
+
+conf.set_perc_thresh(e.Fcst_sd.data, e.Obs_sd.data);
+
+grid = e.grid;
+
+engine.set_grid(&grid);
+
+xy_bb = e.xy_bb;
+
+data_min = e.data_min;
+data_max = e.data_max;
+
+return;
+
+}
+
+
 ///////////////////////////////////////////////////////////////////////
 
 
@@ -362,14 +428,12 @@ return;
 ///////////////////////////////////////////////////////////////////////
 
 
-void ModeExecutive::do_conv_thresh(const int r_index, const int t_index)
+void ModeExecutive::set_conv_thresh_indices(const int r_index, const int t_index)
 
 {
 
 ModeConfInfo & conf = engine.conf_info;
 
-static int local_r_index = -1;
-
 R_index = r_index;
 T_index = t_index;
 
@@ -379,6 +443,47 @@ conf.set_conv_thresh_by_index  (T_index);
 if ( conf.need_fcst_merge_thresh () )  conf.set_fcst_merge_thresh_by_index (T_index);
 if ( conf.need_obs_merge_thresh  () )  conf.set_obs_merge_thresh_by_index  (T_index);
 
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
+void ModeExecutive::do_conv(const int r_index)
+
+{
+
+ModeConfInfo & conf = engine.conf_info;
+
+R_index = r_index;
+
+conf.set_conv_radius_by_index(R_index);
+
+mlog << Debug(2)
+     << "Convolving the forecast and observation fields...\n";
+
+engine.set_conv_only(Fcst_sd, Obs_sd);
+
+Conv_R_index = R_index;
+
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////
+
+
+void ModeExecutive::do_conv_thresh(const int r_index, const int t_index)
+
+{
+
+ModeConfInfo & conf = engine.conf_info;
+
+set_conv_thresh_indices(r_index, t_index);
+
    //
    //  Set up the engine with these raw fields
    //
@@ -386,7 +491,7 @@ if ( conf.need_obs_merge_thresh  () )  conf.set_obs_merge_thresh_by_index  (T_in
 mlog << Debug(2)
      << "Identifying objects in the forecast and observation fields...\n";
 
-if ( r_index != local_r_index )  {   //  need to do convolution
+if ( r_index != Conv_R_index )  {   //  need to do convolution
 
    engine.set(Fcst_sd, Obs_sd);
 
@@ -407,7 +512,47 @@ if ( conf.ct_stats_flag )  compute_ct_stats();
    //  done
    //
 
-local_r_index = r_index;
+Conv_R_index = r_index;
+
+return;
+
+}
+
+
+///////////////////////////////////////////////////////////////////////
+//
+//  Same as above, but take the raw and convolved fields from conv_exec,
+//  which has been through do_conv() for the radius to use.  conv_exec
+//  is only read, so this may run concurrently for several thresholds.
+//
+///////////////////////////////////////////////////////////////////////
+
+
+void ModeExecutive::do_conv_thresh(const ModeExecutive & conv_exec, const int t_index)
+
+{
+
+ModeConfInfo & conf = engine.conf_info;
+
+set_conv_thresh_indices(conv_exec.Conv_R_index, t_index);
+
+mlog << Debug(2)
+     << "Identifying objects in the forecast and observation fields...\n";
+
+engine.set_conv(conv_exec.engine);
+
+Conv_R_index = R_index;
+
+   //
+   //  Compute the contingency table statistics for the fields, if needed
+   //
+
+if ( conf.ct_stats_flag )  compute_ct_stats();
+
+
+   //
+   //  done
+   //
 
 return;
 
@@ -551,6 +696,8 @@ void ModeExecutive::compute_ct_stats()
 
    for(i=0; i<n_cts; i++) {
 
+      // Count only the current run
+      cts[i].zero_out();
       cts[i].set_name(cts_str[i]);
 
       // Raw fields
@@ -73,6 +73,8 @@ class ModeExecutive {
 
       void init_from_scratch();
 
+      void set_conv_thresh_indices(const int r_index, const int t_index);
+
    public:
 
       ModeExecutive();
@@ -81,6 +83,7 @@ class ModeExecutive {
       void clear();
 
       void init();
+      void init_quilt_run(const ModeExecutive &);
 
       int n_conv_radii   () const;
       int n_conv_threshs () const;
@@ -90,6 +93,8 @@ class ModeExecutive {
       int R_index;   //  indices into the convolution radius and threshold arrays
       int T_index;   //    for the current run
 
+      int Conv_R_index;   //  radius index of the current convolved fields, or -1
+
          //
          // Input configuration files
          //
@@ -118,7 +123,9 @@ class ModeExecutive {
       ShapeData Fcst_sd, Obs_sd;
 
       void setup_fcst_obs_data();
+      void do_conv(const int r_index);
       void do_conv_thresh(const int r_index, const int t_index);
+      void do_conv_thresh(const ModeExecutive & conv_exec, const int t_index);
       void do_match_merge();
 
       void process_masks(ShapeData &, ShapeData &);
@@ -133,6 +133,10 @@ static void build_outfile_name(unixtime, int, const char *,
 
 static void process_fcst_climo_files();
 static void process_obs_file(int);
+static void add_obs_block(PointObsBlock &, const float *, const float *,
+                          const char *, const char *, unixtime,
+                          const char *, const char *);
+static void process_obs_block_task(void *, int, int, int);
 static void process_scores();
 
 static void do_cts       (CTSInfo   *&, int, const PairDataPoint *);
@@ -642,7 +646,7 @@ void process_fcst_climo_files() {
 ////////////////////////////////////////////////////////////////////////
 
 void process_obs_file(int i_nc) {
-   int j, i_obs;
+   int j, i_obs, n_threads;
    float obs_arr[OBS_ARRAY_LEN], hdr_arr[hdr_arr_len];
    float prev_obs_arr[OBS_ARRAY_LEN];
    char hdr_typ_str[max_str_len];
@@ -761,12 +765,22 @@ void process_obs_file(int i_nc) {
       }
    }
 
+   // Pair each block of observations with the verification tasks,
+   // split across threads
+   PointObsBlock obs_block;
+   n_threads = min(get_num_threads(), max(conf_info.get_n_vx(), 1));
+
+   mlog << Debug(3) << "Pairing observations for " << conf_info.get_n_vx()
+        << " verification task(s) using " << n_threads << " thread(s).\n";
+
    // Process each observation in the file
    int str_length, block_size;
    for(int i_block_start_idx=0; i_block_start_idx<obs_count; i_block_start_idx+=block_size) {
       block_size = (obs_count - i_block_start_idx);
       if (block_size > BUFFER_SIZE) block_size = BUFFER_SIZE;
 
+      obs_block.n_obs = 0;
+
       if (!read_nc_obs_data(obs_vars, block_size, i_block_start_idx, qty_len,
             (float *)obs_arr_block, obs_qty_idx_block, (char *)obs_qty_block)) {
          exit(1);
@@ -870,23 +884,19 @@ void process_obs_file(int i_nc) {
             strcpy(var_name, "");
          }
 
-         // Check each conf_info.vx_pd object to see if this observation
-         // should be added
-         for(j=0; j<conf_info.get_n_vx(); j++) {
-
-            // Check for no forecast fields
-            if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
-
-            // Attempt to add the observation to the conf_info.vx_pd object
-            conf_info.vx_opt[j].vx_pd.add_point_obs(hdr_arr,
-                                         hdr_typ_str, hdr_sid_str,
-                                         hdr_ut, obs_qty_str, obs_arr,
-                                         grid, var_name);
-         }
+         // Store the observation to be paired
+         add_obs_block(obs_block, hdr_arr, obs_arr,
+                       hdr_typ_str, hdr_sid_str, hdr_ut,
+                       obs_qty_str, var_name);
 
          obs_arr[1] = grib_code;
       }
 
+      // Check each conf_info.vx_pd object to see if these observations
+      // should be added
+      run_thread_tasks(process_obs_block_task, &obs_block,
+                       conf_info.get_n_vx(), n_threads);
+
    } // end for i_block_start_idx
 
    // Deallocate and clean up
@@ -901,6 +911,74 @@ void process_obs_file(int i_nc) {
 
 ////////////////////////////////////////////////////////////////////////
 
+void add_obs_block(PointObsBlock &block,
+                   const float *hdr_arr, const float *obs_arr,
+                   const char *hdr_typ_str, const char *hdr_sid_str,
+                   unixtime hdr_ut, const char *obs_qty_str,
+                   const char *var_name) {
+   int i = block.n_obs;
+
+   // Reuse the storage from previous blocks
+   if(i >= (int) block.hdr_ut.size()) {
+      block.hdr_arr.resize((i+1)*hdr_arr_len);
+      block.obs_arr.resize((i+1)*OBS_ARRAY_LEN);
+      block.hdr_typ.resize(i+1);
+      block.hdr_sid.resize(i+1);
+      block.obs_qty.resize(i+1);
+      block.var_name.resize(i+1);
+      block.hdr_ut.resize(i+1);
+   }
+
+   copy(hdr_arr, hdr_arr + hdr_arr_len,
+        block.hdr_arr.begin() + i*hdr_arr_len);
+   copy(obs_arr, obs_arr + OBS_ARRAY_LEN,
+        block.obs_arr.begin() + i*OBS_ARRAY_LEN);
+   block.hdr_typ[i]  = hdr_typ_str;
+   block.hdr_sid[i]  = hdr_sid_str;
+   block.obs_qty[i]  = obs_qty_str;
+   block.var_name[i] = var_name;
+   block.hdr_ut[i]   = hdr_ut;
+
+   block.n_obs++;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Add the observations of one block to a range of verification tasks.
+// Each task owns its pairs, so the tasks can run concurrently and the
+// pairs, duplicate checks, and observation summaries match a serial run.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_obs_block_task(void *data, int i_thread, int i_beg, int i_end) {
+   PointObsBlock *block = (PointObsBlock *) data;
+   int i, j;
+
+   for(j=i_beg; j<i_end; j++) {
+
+      // Check for no forecast fields
+      if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
+
+      // Attempt to add each observation to the conf_info.vx_pd object
+      for(i=0; i<block->n_obs; i++) {
+         conf_info.vx_opt[j].vx_pd.add_point_obs(
+                                   &block->hdr_arr[i*hdr_arr_len],
+                                   block->hdr_typ[i].c_str(),
+                                   block->hdr_sid[i].c_str(),
+                                   block->hdr_ut[i],
+                                   block->obs_qty[i].c_str(),
+                                   &block->obs_arr[i*OBS_ARRAY_LEN],
+                                   grid, block->var_name[i].c_str());
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void process_scores() {
    int i, j, k, l, m;
    int n_cat, n_wind;
@@ -39,6 +39,8 @@ using namespace std;
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <string>
+#include <vector>
 
 #include <netcdf>
 using namespace netCDF;
@@ -163,6 +165,25 @@ static gsl_rng *rng_ptr = (gsl_rng *) 0;
 // Strings to be output in the STAT and optional text files
 static StatHdrColumns shc;
 
+////////////////////////////////////////////////////////////////////////
+//
+// Observations read from one block of the input file.  They're decoded
+// once and then paired with the verification tasks, which are split
+// across threads.  Each task sees the observations in file order.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct PointObsBlock {
+   int                 n_obs;
+   vector<float>       hdr_arr;   // hdr_arr_len values per observation
+   vector<float>       obs_arr;   // obs_arr_len values per observation
+   vector<string>      hdr_typ;   // Message type
+   vector<string>      hdr_sid;   // Station ID
+   vector<string>      obs_qty;   // Quality flag
+   vector<string>      var_name;  // Variable name, when stored by name
+   vector<unixtime>    hdr_ut;    // Valid time
+};
+
 ////////////////////////////////////////////////////////////////////////
 
 #endif   //  __POINT_STAT_H__
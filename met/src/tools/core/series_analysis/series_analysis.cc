@@ -74,10 +74,13 @@ static bool read_single_entry(VarInfo *, const ConcatString &,
                               const GrdFileType, DataPlane &, Grid &);
 
 static void process_scores();
+static void store_series_data(int, const DataPlane &, const DataPlane &,
+                              const DataPlane &, const DataPlane &);
+static void process_point_task(void *, int, int, int);
 
-static void do_cts   (int, const PairDataPoint *);
-static void do_mcts  (int, const PairDataPoint *);
-static void do_cnt   (int, const PairDataPoint *);
+static void do_cts   (int, const PairDataPoint *, const gsl_rng *);
+static void do_mcts  (int, const PairDataPoint *, const gsl_rng *);
+static void do_cnt   (int, const PairDataPoint *, const gsl_rng *);
 static void do_sl1l2 (int, const PairDataPoint *);
 static void do_pct   (int, const PairDataPoint *);
 
@@ -335,24 +338,14 @@ void process_grid(const Grid &fcst_grid, const Grid &obs_grid) {
    // Process masking regions
    conf_info.process_masks(grid);
 
-   // Compute the number of reads required
-   n_reads = nint(ceil((double) nxy / conf_info.block_size));
-   
-   mlog << Debug(2)
-        << "Computing statistics using a block size of "
-        << conf_info.block_size << ", requiring " << n_reads
-        << " pass(es) through the " << grid.nx() << " x "
-        << grid.ny() << " grid.\n";
+   // Compute the number of blocks of grid points
+   block_nxy = min(conf_info.block_size, nxy);
+   n_blocks  = nint(ceil((double) nxy / block_nxy));
 
-   // Print a warning for too many passes through the data
-   if(n_reads > 4) {
-      mlog << Warning
-           << "\nA block size of " << conf_info.block_size << " for a "
-           << grid.nx() << " x " << grid.ny() << " grid requires "
-           << n_reads << " passes through the data which will be slow.\n"
-           << "Consider increasing \"block_size\" in the configuration "
-           << "file based on available memory.\n\n";
-   }
+   mlog << Debug(2)
+        << "Storing the series for the " << grid.nx() << " x "
+        << grid.ny() << " grid in " << n_blocks << " block(s) of "
+        << block_nxy << " grid points.\n";
 
    return;
 }
@@ -650,11 +643,12 @@ bool read_single_entry(VarInfo *info, const ConcatString &cur_file,
 ////////////////////////////////////////////////////////////////////////
 
 void process_scores() {
-   int i, x, y, i_read, i_series, i_point, i_fcst;
+   int i, i_series, i_fcst, n_threads;
    VarInfo *fcst_info = (VarInfo *) 0;
    VarInfo *obs_info  = (VarInfo *) 0;
-   PairDataPoint *pd_ptr = (PairDataPoint *) 0;
    DataPlane fcst_dp, obs_dp;
+   vector<gsl_rng *> streams;
+   PointTaskInfo info;
 
    // Climatology mean and standard deviation
    DataPlane cmn_dp, csd_dp;
@@ -664,164 +658,102 @@ void process_scores() {
    int n_skip_zero = 0;
    int n_skip_pos  = 0;
 
-   // Allocate space to store the pairs for each grid point
-   pd_ptr = new PairDataPoint [conf_info.block_size];
-   for(i=0; i<conf_info.block_size; i++) pd_ptr[i].extend(n_series);
-
-   // Loop over the data reads
-   for(i_read=0; i_read<n_reads; i_read++) {
+   // Read each series entry once and store the pairs for each point
+   for(i_series=0; i_series<n_series; i_series++) {
 
-      // Initialize PairDataPoint objects
-      for(i=0; i<conf_info.block_size; i++) pd_ptr[i].erase();
+      // Get the index for the forecast and climo VarInfo objects
+      i_fcst = (conf_info.get_n_fcst() > 1 ? i_series : 0);
 
-      // Starting grid point
-      i_point = i_read*conf_info.block_size;
+      // Store the current VarInfo objects
+      fcst_info = conf_info.fcst_info[i_fcst];
+      obs_info  = (conf_info.get_n_obs() > 1 ?
+                   conf_info.obs_info[i_series] :
+                   conf_info.obs_info[0]);
 
-      // Loop over the series variable
-      for(i_series=0; i_series<n_series; i_series++) {
-
-         // Get the index for the forecast and climo VarInfo objects
-         i_fcst = (conf_info.get_n_fcst() > 1 ? i_series : 0);
-
-         // Store the current VarInfo objects
-         fcst_info = conf_info.fcst_info[i_fcst];
-         obs_info  = (conf_info.get_n_obs() > 1 ?
-                      conf_info.obs_info[i_series] :
-                      conf_info.obs_info[0]);
+      // Retrieve the data planes for the current series entry
+      get_series_data(i_series, fcst_info, obs_info, fcst_dp, obs_dp);
 
-         // Retrieve the data planes for the current series entry
-         get_series_data(i_series, fcst_info, obs_info, fcst_dp, obs_dp);
+      // Allocate space for the pairs on the first pass, in memory when
+      // it fits within the scratch memory limit and memory mapped
+      // otherwise
+      if(i_series == 0) {
+         pair_store.set_size(
+            (long long) n_blocks * block_nxy * n_series * n_pair_val,
+            get_scratch_mem_limit(),
+            conf_info.tmp_dir.c_str(), "tmp_series_analysis");
 
-         if(i_series == 0) {
+         if(pair_store.on_disk()) {
             mlog << Debug(2)
-                 << "Processing data pass number " << i_read + 1 << " of "
-                 << n_reads << " for grid points " << i_point + 1 << " to "
-                 << min(i_point + conf_info.block_size, nxy) << ".\n";
-         }
-
-         // Read climatology data for the current series entry
-         cmn_dp = read_climo_data_plane(
-                  conf_info.conf.lookup_array(conf_key_climo_mean_field, false),
-                  i_fcst, fcst_dp.valid(), grid);
-         csd_dp = read_climo_data_plane(
-                  conf_info.conf.lookup_array(conf_key_climo_stdev_field, false),
-                  i_fcst, fcst_dp.valid(), grid);
-
-         cmn_flag = (cmn_dp.nx() == fcst_dp.nx() && cmn_dp.ny() == fcst_dp.ny());
-         csd_flag = (csd_dp.nx() == fcst_dp.nx() && csd_dp.ny() == fcst_dp.ny());
-
-         mlog << Debug(3)
-           << "Found " << (cmn_flag ? 0 : 1)
-           << " climatology mean and " << (csd_flag == 0 ? 0 : 1)
-           << " climatology standard deviation field(s) for forecast "
-           << fcst_info->magic_str() << ".\n";
-
-         // Setup the output NetCDF file on the first pass
-         if(nc_out == (NcFile *) 0) setup_nc_file(fcst_info, obs_info);
-
-         // Update timing info
-         set_range(fcst_dp.init(),  fcst_init_beg,  fcst_init_end);
-         set_range(fcst_dp.valid(), fcst_valid_beg, fcst_valid_end);
-         set_range(fcst_dp.lead(),  fcst_lead_beg,  fcst_lead_end);
-         set_range(obs_dp.init(),   obs_init_beg,   obs_init_end);
-         set_range(obs_dp.valid(),  obs_valid_beg,  obs_valid_end);
-         set_range(obs_dp.lead(),   obs_lead_beg,   obs_lead_end);
-
-         // Store matched pairs for each grid point
-         for(i=0; i<conf_info.block_size && (i_point+i)<nxy; i++) {
-
-            // Convert n to x, y
-            DefaultTO.one_to_two(grid.nx(), grid.ny(), i_point+i, x, y);
-
-            // Skip points outside the mask and bad data
-            if(!conf_info.mask_area(x, y)              ||
-               is_bad_data(fcst_dp(x, y))              ||
-               is_bad_data(obs_dp(x,y))                ||
-               (cmn_flag && is_bad_data(cmn_dp(x, y))) ||
-               (csd_flag && is_bad_data(csd_dp(x, y)))) continue; 
-
-            pd_ptr[i].add_grid_pair(fcst_dp(x, y), obs_dp(x, y),
-                         (cmn_flag ? cmn_dp(x, y) : bad_data_double),
-                         (csd_flag ? csd_dp(x, y) : bad_data_double),
-                         default_grid_weight);
-
-         } // end for i
-
-      } // end for i_series
-
-      // Compute statistics for each grid point in the block
-      for(i=0; i<conf_info.block_size && (i_point+i)<nxy; i++) {
-
-         // Determine x,y location
-         DefaultTO.one_to_two(grid.nx(), grid.ny(), i_point+i, x, y);
-
-         // Check for the required number of matched pairs
-         if(pd_ptr[i].f_na.n()/(double) n_series < conf_info.vld_data_thresh) {
-            mlog << Debug(4)
-                 << "[" << i+1 << " of " << conf_info.block_size
-                 << "] Skipping point (" << x << ", " << y << ") with "
-                 << pd_ptr[i].f_na.n() << " matched pairs.\n";
-
-            // Keep track of the number of points skipped
-            if(pd_ptr[i].f_na.n() == 0) n_skip_zero++;
-            else                        n_skip_pos++;
-
-            continue;
-         }
-         else {
-            mlog << Debug(4)
-                 << "[" << i+1 << " of " << conf_info.block_size
-                 << "] Processing point (" << x << ", " << y << ") with "
-                 << pd_ptr[i].n_obs << " matched pairs.\n";
+                 << "Storing the series for " << nxy << " grid points "
+                 << "in temporary file: " << pair_store.file_name()
+                 << "\n";
          }
+      }
 
-         // Compute contingency table counts and statistics
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_fho].n() +
-             conf_info.output_stats[stat_ctc].n() +
-             conf_info.output_stats[stat_cts].n()) > 0) {
-            do_cts(i_point+i, &pd_ptr[i]);
-         }
+      // Read climatology data for the current series entry
+      cmn_dp = read_climo_data_plane(
+               conf_info.conf.lookup_array(conf_key_climo_mean_field, false),
+               i_fcst, fcst_dp.valid(), grid);
+      csd_dp = read_climo_data_plane(
+               conf_info.conf.lookup_array(conf_key_climo_stdev_field, false),
+               i_fcst, fcst_dp.valid(), grid);
+
+      cmn_flag = (cmn_dp.nx() == fcst_dp.nx() && cmn_dp.ny() == fcst_dp.ny());
+      csd_flag = (csd_dp.nx() == fcst_dp.nx() && csd_dp.ny() == fcst_dp.ny());
+
+      mlog << Debug(3)
+        << "Found " << (cmn_flag ? 0 : 1)
+        << " climatology mean and " << (csd_flag == 0 ? 0 : 1)
+        << " climatology standard deviation field(s) for forecast "
+        << fcst_info->magic_str() << ".\n";
+
+      // Setup the output NetCDF file on the first pass
+      if(nc_out == (NcFile *) 0) setup_nc_file(fcst_info, obs_info);
+
+      // Update timing info
+      set_range(fcst_dp.init(),  fcst_init_beg,  fcst_init_end);
+      set_range(fcst_dp.valid(), fcst_valid_beg, fcst_valid_end);
+      set_range(fcst_dp.lead(),  fcst_lead_beg,  fcst_lead_end);
+      set_range(obs_dp.init(),   obs_init_beg,   obs_init_end);
+      set_range(obs_dp.valid(),  obs_valid_beg,  obs_valid_end);
+      set_range(obs_dp.lead(),   obs_lead_beg,   obs_lead_end);
+
+      // Store matched pairs for each grid point
+      if(!cmn_flag) cmn_dp.clear();
+      if(!csd_flag) csd_dp.clear();
+      store_series_data(i_series, fcst_dp, obs_dp, cmn_dp, csd_dp);
+
+   } // end for i_series
+
+   // Give each thread its own random number stream
+   n_threads = max(1, min(get_num_threads(), nxy));
+   if(n_threads == 1) {
+      info.rng.push_back(rng_ptr);
+   }
+   else {
+      streams.resize(n_threads);
+      rng_split(rng_ptr, n_threads, streams.data());
+      for(i=0; i<n_threads; i++) info.rng.push_back(streams[i]);
+   }
+   info.n_skip_zero.assign(n_threads, 0);
+   info.n_skip_pos.assign(n_threads, 0);
 
-         // Compute multi-category contingency table counts and statistics
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_mctc].n() +
-             conf_info.output_stats[stat_mcts].n()) > 0) {
-            do_mcts(i_point+i, &pd_ptr[i]);
-         }
+   mlog << Debug(2)
+        << "Computing statistics for " << nxy << " grid points using "
+        << n_threads << " thread(s).\n";
 
-         // Compute continuous statistics
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            conf_info.output_stats[stat_cnt].n() > 0) {
-            do_cnt(i_point+i, &pd_ptr[i]);
-         }
+   // Compute statistics for each grid point
+   run_thread_tasks(process_point_task, &info, nxy, n_threads);
 
-         // Compute partial sums
-         if(!conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_sl1l2].n()  > 0 ||
-             conf_info.output_stats[stat_sal1l2].n() > 0)) {
-            do_sl1l2(i_point+i, &pd_ptr[i]);
-         }
+   for(i=0; i<n_threads; i++) {
+      n_skip_zero += info.n_skip_zero[i];
+      n_skip_pos  += info.n_skip_pos[i];
+   }
 
-         // Compute probabilistics counts and statistics
-         if(conf_info.fcst_info[0]->is_prob() &&
-            (conf_info.output_stats[stat_pct].n() +
-             conf_info.output_stats[stat_pstd].n() +
-             conf_info.output_stats[stat_pjc].n() +
-             conf_info.output_stats[stat_prc].n()) > 0) {
-            do_pct(i_point+i, &pd_ptr[i]);
-         }
-      } // end for i
-
-      // Erase the data
-      for(i=0; i<conf_info.block_size; i++) {
-         pd_ptr[i].f_na.erase();
-         pd_ptr[i].o_na.erase();
-         pd_ptr[i].cmn_na.erase();
-         pd_ptr[i].csd_na.erase();
-      }
+   for(i=0; i<(int) streams.size(); i++) rng_free(streams[i]);
 
-   } // end for i_read
+   // Release the pairs
+   pair_store.clear();
 
    // Add time range information to the global NetCDF attributes
    add_att(nc_out, "fcst_init_beg",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_beg));
@@ -837,9 +769,6 @@ void process_scores() {
    add_att(nc_out, "obs_lead_beg",   (string)sec_to_hhmmss(obs_lead_beg));
    add_att(nc_out, "obs_lead_end",   (string)sec_to_hhmmss(obs_lead_end));
 
-   // Clean up
-   if(pd_ptr) { delete [] pd_ptr; pd_ptr = (PairDataPoint *) 0; }
-
    // Print summary counts
    mlog << Debug(2)
         << "Finished processing statistics for "
@@ -863,9 +792,144 @@ void process_scores() {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Transpose the fields for the current series entry into the pair
+// store.  The values for each block of grid points are contiguous for
+// each series entry so that the store is written and read sequentially.
+// Points outside the mask or with bad data get a bad forecast value.
+//
 ////////////////////////////////////////////////////////////////////////
 
-void do_cts(int n, const PairDataPoint *pd_ptr) {
+void store_series_data(int i_series,
+                       const DataPlane &fcst_dp, const DataPlane &obs_dp,
+                       const DataPlane &cmn_dp, const DataPlane &csd_dp) {
+   int i, x, y;
+   double f, o, cmn, csd;
+   double *v = (double *) 0;
+   bool cmn_flag = (cmn_dp.nx() > 0);
+   bool csd_flag = (csd_dp.nx() > 0);
+
+   for(i=0; i<nxy; i++) {
+
+      // Convert n to x, y
+      DefaultTO.one_to_two(grid.nx(), grid.ny(), i, x, y);
+
+      f   = fcst_dp(x, y);
+      o   = obs_dp(x, y);
+      cmn = (cmn_flag ? cmn_dp(x, y) : bad_data_double);
+      csd = (csd_flag ? csd_dp(x, y) : bad_data_double);
+
+      // Flag points outside the mask and bad data
+      if(!conf_info.mask_area(x, y) ||
+         is_bad_data(f)             ||
+         is_bad_data(o)             ||
+         (cmn_flag && is_bad_data(cmn)) ||
+         (csd_flag && is_bad_data(csd))) f = bad_data_double;
+
+      v = pair_store.buf() + pair_store_offset(i, i_series);
+      v[0] = f;
+      v[1] = o;
+      v[2] = cmn;
+      v[3] = csd;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Build the pairs and compute statistics for the grid points in
+// [i_beg, i_end).
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_point_task(void *data, int i_thread, int i_beg, int i_end) {
+   PointTaskInfo *info = (PointTaskInfo *) data;
+   const gsl_rng *rng = info->rng[i_thread];
+   const double *v = (const double *) 0;
+   int i, i_series, x, y;
+   PairDataPoint pd;
+
+   pd.extend(n_series);
+
+   for(i=i_beg; i<i_end; i++) {
+
+      // Determine x,y location
+      DefaultTO.one_to_two(grid.nx(), grid.ny(), i, x, y);
+
+      // Retrieve the matched pairs for this point
+      pd.erase();
+      for(i_series=0; i_series<n_series; i_series++) {
+         v = pair_store.buf() + pair_store_offset(i, i_series);
+         if(is_bad_data(v[0])) continue;
+         pd.add_grid_pair(v[0], v[1], v[2], v[3], default_grid_weight);
+      }
+
+      // Check for the required number of matched pairs
+      if(pd.f_na.n()/(double) n_series < conf_info.vld_data_thresh) {
+         mlog << Debug(4)
+              << "[" << i+1 << " of " << nxy
+              << "] Skipping point (" << x << ", " << y << ") with "
+              << pd.f_na.n() << " matched pairs.\n";
+
+         // Keep track of the number of points skipped
+         if(pd.f_na.n() == 0) info->n_skip_zero[i_thread]++;
+         else                 info->n_skip_pos[i_thread]++;
+
+         continue;
+      }
+      else {
+         mlog << Debug(4)
+              << "[" << i+1 << " of " << nxy
+              << "] Processing point (" << x << ", " << y << ") with "
+              << pd.n_obs << " matched pairs.\n";
+      }
+
+      // Compute contingency table counts and statistics
+      if(!conf_info.fcst_info[0]->is_prob() &&
+         (conf_info.output_stats[stat_fho].n() +
+          conf_info.output_stats[stat_ctc].n() +
+          conf_info.output_stats[stat_cts].n()) > 0) {
+         do_cts(i, &pd, rng);
+      }
+
+      // Compute multi-category contingency table counts and statistics
+      if(!conf_info.fcst_info[0]->is_prob() &&
+         (conf_info.output_stats[stat_mctc].n() +
+          conf_info.output_stats[stat_mcts].n()) > 0) {
+         do_mcts(i, &pd, rng);
+      }
+
+      // Compute continuous statistics
+      if(!conf_info.fcst_info[0]->is_prob() &&
+         conf_info.output_stats[stat_cnt].n() > 0) {
+         do_cnt(i, &pd, rng);
+      }
+
+      // Compute partial sums
+      if(!conf_info.fcst_info[0]->is_prob() &&
+         (conf_info.output_stats[stat_sl1l2].n()  > 0 ||
+          conf_info.output_stats[stat_sal1l2].n() > 0)) {
+         do_sl1l2(i, &pd);
+      }
+
+      // Compute probabilistics counts and statistics
+      if(conf_info.fcst_info[0]->is_prob() &&
+         (conf_info.output_stats[stat_pct].n() +
+          conf_info.output_stats[stat_pstd].n() +
+          conf_info.output_stats[stat_pjc].n() +
+          conf_info.output_stats[stat_prc].n()) > 0) {
+         do_pct(i, &pd);
+      }
+   } // end for i
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_cts(int n, const PairDataPoint *pd_ptr, const gsl_rng *rng) {
    int i, j;
 
    mlog << Debug(4) << "Computing Categorical Statistics.\n";
@@ -888,18 +952,21 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
    // Compute the counts, stats, normal confidence intervals, and
    // bootstrap confidence intervals
    if(conf_info.boot_interval == BootIntervalType_BCA) {
-      compute_cts_stats_ci_bca(rng_ptr, *pd_ptr,
+      compute_cts_stats_ci_bca(rng, *pd_ptr,
          conf_info.n_boot_rep,
          cts_info, n_cts, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
    }
    else {
-      compute_cts_stats_ci_perc(rng_ptr, *pd_ptr,
+      compute_cts_stats_ci_perc(rng, *pd_ptr,
          conf_info.n_boot_rep, conf_info.boot_rep_prop,
          cts_info, n_cts, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
    }
 
+   // Serialize output across threads
+   lock_guard<mutex> lock(nc_out_mutex);
+
    // Loop over the categorical thresholds
    for(i=0; i<n_cts; i++) {
 
@@ -930,7 +997,7 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void do_mcts(int n, const PairDataPoint *pd_ptr) {
+void do_mcts(int n, const PairDataPoint *pd_ptr, const gsl_rng *rng) {
    int i;
 
    mlog << Debug(4) << "Computing Multi-Category Statistics.\n";
@@ -951,18 +1018,21 @@ void do_mcts(int n, const PairDataPoint *pd_ptr) {
    // Compute the counts, stats, normal confidence intervals, and
    // bootstrap confidence intervals
    if(conf_info.boot_interval == BootIntervalType_BCA) {
-      compute_mcts_stats_ci_bca(rng_ptr, *pd_ptr,
+      compute_mcts_stats_ci_bca(rng, *pd_ptr,
          conf_info.n_boot_rep,
          mcts_info, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
    }
    else {
-      compute_mcts_stats_ci_perc(rng_ptr, *pd_ptr,
+      compute_mcts_stats_ci_perc(rng, *pd_ptr,
          conf_info.n_boot_rep, conf_info.boot_rep_prop,
          mcts_info, true,
          conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
    }
 
+   // Serialize output across threads
+   lock_guard<mutex> lock(nc_out_mutex);
+
    // Add statistic value for each possible MCTC column
    for(i=0; i<conf_info.output_stats[stat_mctc].n(); i++) {
       store_stat_mctc(n, conf_info.output_stats[stat_mctc][i],
@@ -980,7 +1050,7 @@ void do_mcts(int n, const PairDataPoint *pd_ptr) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void do_cnt(int n, const PairDataPoint *pd_ptr) {
+void do_cnt(int n, const PairDataPoint *pd_ptr, const gsl_rng *rng) {
    int i, j;
    CNTInfo cnt_info;
    PairDataPoint pd;
@@ -1017,19 +1087,20 @@ void do_cnt(int n, const PairDataPoint *pd_ptr) {
                          conf_info.obs_info[0]->is_precipitation());
 
       if(conf_info.boot_interval == BootIntervalType_BCA) {
-         compute_cnt_stats_ci_bca(rng_ptr, pd,
+         compute_cnt_stats_ci_bca(rng, pd,
             precip_flag, conf_info.rank_corr_flag,
             conf_info.n_boot_rep,
             cnt_info, conf_info.tmp_dir.c_str());
       }
       else {
-         compute_cnt_stats_ci_perc(rng_ptr, pd,
+         compute_cnt_stats_ci_perc(rng, pd,
             precip_flag, conf_info.rank_corr_flag,
             conf_info.n_boot_rep, conf_info.boot_rep_prop,
             cnt_info, conf_info.tmp_dir.c_str());
       }
 
       // Add statistic value for each possible CNT column
+      lock_guard<mutex> lock(nc_out_mutex);
       for(j=0; j<conf_info.output_stats[stat_cnt].n(); j++) {
          store_stat_cnt(n, conf_info.output_stats[stat_cnt][j],
                         cnt_info);
@@ -1059,6 +1130,7 @@ void do_sl1l2(int n, const PairDataPoint *pd_ptr) {
       s_info.set(*pd_ptr);
 
       // Add statistic value for each possible SL1L2 column
+      lock_guard<mutex> lock(nc_out_mutex);
       for(j=0; j<conf_info.output_stats[stat_sl1l2].n(); j++) {
          store_stat_sl1l2(n, conf_info.output_stats[stat_sl1l2][j], s_info);
       }
@@ -1094,6 +1166,9 @@ void do_pct(int n, const PairDataPoint *pd_ptr) {
       // Compute the probabilistic counts and statistics
       compute_pctinfo(*pd_ptr, true, pct_info);
 
+      // Serialize output across threads
+      lock_guard<mutex> lock(nc_out_mutex);
+
       // Add statistic value for each possible PCT column
       for(j=0; j<conf_info.output_stats[stat_pct].n(); j++) {
          store_stat_pct(n, conf_info.output_stats[stat_pct][j],
@@ -33,10 +33,12 @@ using namespace std;
 #include <iostream>
 #include <fstream>
 #include <math.h>
+#include <mutex>
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <vector>
 
 #include <netcdf>
 using namespace netCDF;
@@ -90,6 +92,7 @@ static SeriesAnalysisConfInfo conf_info;
 
 // Output NetCDF file
 static NcFile *nc_out  = (NcFile *) 0;
+static mutex   nc_out_mutex; // Serializes stat_data and nc_out updates across threads
 static NcDim  lat_dim;
 static NcDim  lon_dim ;
 
@@ -110,7 +113,20 @@ map<ConcatString, NcVarData> stat_data;
 // Grid variables
 static Grid grid;
 static int nxy = 0;
-static int n_reads = 1; // Initialize to at least one pass
+static int block_nxy = 0; // Number of grid points per block
+static int n_blocks  = 1; // Number of blocks of grid points
+
+// Pairs for each grid point and series entry, stored as the forecast,
+// observation, climatology mean, and climatology standard deviation
+static const int n_pair_val = 4;
+static ScratchArray pair_store;
+
+// Inputs and outputs for the threads computing statistics
+struct PointTaskInfo {
+   vector<const gsl_rng *> rng;  // Random number stream for each thread
+   vector<int> n_skip_zero;      // Points skipped with no valid data
+   vector<int> n_skip_pos;       // Points skipped below the threshold
+};
 
 // Data file factory and input files
 static Met2dDataFileFactory mtddf_factory;
@@ -133,6 +149,12 @@ static SeriesType series_type = SeriesType_None;
 // Series length
 static int n_series = 0;
 
+// Offset of the pairs for a grid point and series entry in pair_store
+inline size_t pair_store_offset(int n, int i_series) {
+   return((((size_t) (n / block_nxy) * n_series + i_series) * block_nxy +
+           n % block_nxy) * n_pair_val);
+}
+
 // Range of timing values encountered in the data
 static unixtime fcst_init_beg  = (unixtime) 0;
 static unixtime fcst_init_end  = (unixtime) 0;
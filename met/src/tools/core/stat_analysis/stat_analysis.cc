@@ -90,14 +90,22 @@ static void set_tmp_dir(const StringArray &);
 static void set_logfile(const StringArray &);
 static void set_verbosity_level(const StringArray &);
 static void set_config_file(const StringArray &);
+static void set_cache(const StringArray &);
 static void process_search_dirs();
-static void process_stat_file(const char *, const STATAnalysisJob &, int &, int &);
+static void process_stat_file_task(void *, int, int, int);
+static void process_stat_file(const char *, const STATAnalysisJob &,
+                              ofstream &, int &, int &);
 
 #ifdef WITH_PYTHON
 static void process_python(const STATAnalysisJob &);
 #endif
 
+static void process_jobs(const StringArray &);
 static void process_job(const char *, int);
+static void set_up_job(const char *, int, STATAnalysisJob &);
+static void split_job_lines(JobTaskInfo &);
+static void process_job_task(void *, int, int, int);
+static void remove_work_temps();
 static void clean_up();
 
 //
@@ -114,7 +122,6 @@ static void open_temps();
 ////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char * argv []) {
-   int i;
    StringArray jobs_sa;
    ConcatString default_config_file;
 
@@ -206,9 +213,7 @@ int main(int argc, char * argv []) {
 
          jobs_sa = conf.lookup_string_array(conf_key_jobs);
 
-         for(i=0; i<jobs_sa.n_elements(); i++) {
-            process_job(jobs_sa[i].c_str(), i+1);
-         }
+         process_jobs(jobs_sa);
       }
       //
       // Otherwise, process the job specified on the command line.
@@ -278,6 +283,7 @@ void parse_command_line(int &argc, char **argv) {
    cline.add(set_logfile, "-log", 1);
    cline.add(set_verbosity_level, "-v", 1);
    cline.add(set_config_file, "-config", 1);
+   cline.add(set_cache, "-cache", 0);
 
    //
    // parse the command line
@@ -444,9 +450,12 @@ void set_verbosity(int i) {
 ////////////////////////////////////////////////////////////////////////
 
 void process_search_dirs() {
-   int n, i, j, max_len, n_read, n_keep;
+   int n, i, j, max_len, n_read, n_keep, n_threads;
    MetConfig go_conf;
    STATAnalysisJob go_job;
+   StatFileTaskInfo info;
+   ConcatString cs;
+   ifstream in;
 
    //
    // Initialize
@@ -513,24 +522,52 @@ void process_search_dirs() {
    }
    max_len += 3;
 
-   mlog << Debug(2) << "Processing " << n << " STAT files.\n";
+   n_threads = min(get_num_threads(), n);
 
-   for(i=0; i<n; i++) {
-      if(mlog.verbosity_level() > 2) {
+   mlog << Debug(2) << "Processing " << n << " STAT files using "
+        << n_threads << " thread(s).\n";
 
-         mlog << Debug(3) << "Processing STAT file \"" << files[i] << "\" ";
+   info.out_path.resize(n_threads);
+   info.n_read.assign(n_threads, 0);
+   info.n_keep.assign(n_threads, 0);
+   info.status.assign(n_threads, 0);
+   info.max_len = max_len;
 
-         for(j=files[i].length(); j<max_len; j++) mlog << '.';
+   cs << cs_erase << tmp_dir << "/tmp_stat_analysis_read";
+   for(i=1; i<n_threads; i++) {
+      info.out_path[i] = make_temp_file_name(cs.c_str(), NULL);
+      work_tmp_files.add(info.out_path[i]);
+   }
 
-         mlog << " " << i+1 << " of " << n << "\n";
+   run_thread_tasks(process_stat_file_task, &info, n, n_threads);
 
-         if((i%5) == 4) mlog << '\n';
+   //
+   // Append the lines of each thread in file order
+   //
+   for(i=0; i<n_threads; i++) {
 
-      }
+      if(info.status[i] != 0) throw(info.status[i]);
 
-      process_stat_file(files[i].c_str(), default_job, n_read, n_keep);
+      n_read += info.n_read[i];
+      n_keep += info.n_keep[i];
+
+      if(i == 0) continue;
+
+      in.open(info.out_path[i].c_str());
+      tmp_out << in.rdbuf();
+      in.close();
+      in.clear();
+
+      if(!tmp_out) {
+         mlog << Error << "\nprocess_search_dirs() -> "
+              << "error writing to the temporary file \""
+              << tmp_path << "\"\n\n";
+         throw(1);
+      }
    }
 
+   remove_work_temps();
+
    mlog << Debug(2) << "STAT Lines read     = " << n_read << "\n";
    mlog << Debug(2) << "STAT Lines retained = " << n_keep << "\n";
 
@@ -541,12 +578,78 @@ void process_search_dirs() {
 
 ////////////////////////////////////////////////////////////////////////
 
-void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_read, int &n_keep) {
+void process_stat_file_task(void *data, int i_thread, int i_beg, int i_end) {
+   StatFileTaskInfo *info = (StatFileTaskInfo *) data;
+   ofstream buf_out;
+   ofstream *out = &tmp_out;
+   ConcatString cs;
+   int i, j;
+
+   try {
+
+      if(i_thread > 0) {
+         buf_out.open(info->out_path[i_thread].c_str());
+
+         if(!buf_out) {
+            mlog << Error << "\nprocess_stat_file_task() -> "
+                 << "can't open the temporary file \""
+                 << info->out_path[i_thread] << "\" for writing!\n\n";
+            throw(1);
+         }
+
+         out = &buf_out;
+      }
+
+      for(i=i_beg; i<i_end; i++) {
+         if(mlog.verbosity_level() > 2) {
+
+            cs << cs_erase << "Processing STAT file \"" << files[i] << "\" ";
+
+            for(j=files[i].length(); j<info->max_len; j++) cs << '.';
+
+            cs << " " << i+1 << " of " << files.n_elements() << "\n";
+
+            if((i%5) == 4) cs << '\n';
+
+            mlog << Debug(3) << cs;
+         }
+
+         process_stat_file(files[i].c_str(), default_job, *out,
+                           info->n_read[i_thread], info->n_keep[i_thread]);
+      }
+   }
+   catch(int e) {
+      info->status[i_thread] = e;
+   }
+
+   if(buf_out.is_open()) buf_out.close();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void process_stat_file(const char *filename, const STATAnalysisJob &job,
+                       ofstream &out, int &n_read, int &n_keep) {
 
    STATLine line;
-   LineDataFile f;
+   LineDataFile text_file;
+   STATCacheFile cache_file;
+   LineDataFile *f = &text_file;
+   int status;
+
+   //
+   // Read the parsed columns from the binary cache, if requested
+   //
+   if(use_stat_cache) {
+      f = &cache_file;
+      status = cache_file.open(filename);
+   }
+   else {
+      status = text_file.open(filename);
+   }
 
-   if(!(f.open(filename))) {
+   if(!status) {
       mlog << Error << "\nprocess_stat_file() -> "
            << "unable to open input stat file \""
            << filename << "\"\n\n";
@@ -555,7 +658,7 @@ void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_
    }
 
 
-   while(f >> line) {
+   while((*f) >> line) {
 
       //
       // Continue if the line is not a valid STAT line.
@@ -571,11 +674,11 @@ void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_
 
          if(!line.is_header()) n_keep++;
 
-         tmp_out << line;
+         out << line;
       }
    } // end while
 
-   f.close();
+   f->close();
 
    return;
 }
@@ -658,9 +761,116 @@ return;
 
 ////////////////////////////////////////////////////////////////////////
 
+void process_jobs(const StringArray &jobs_sa) {
+   JobTaskInfo info;
+   StringArray out_files;
+   ConcatString cs;
+   ifstream in;
+   int i, n_jobs, n_threads;
+
+   n_jobs = jobs_sa.n_elements();
+
+   //
+   // A single job reads the temp file directly
+   //
+   if(n_jobs <= 1) {
+      for(i=0; i<n_jobs; i++) process_job(jobs_sa[i].c_str(), i+1);
+      return;
+   }
+
+   info.job.resize(n_jobs);
+   info.jobstring.resize(n_jobs);
+   info.line_path.resize(n_jobs);
+   info.out_path.resize(n_jobs);
+   info.n_skip.assign(n_jobs, 0);
+   info.status.assign(n_jobs, 0);
+   info.next_job = 0;
+
+   for(i=0; i<n_jobs; i++) {
+      set_up_job(jobs_sa[i].c_str(), i+1, info.job[i]);
+      info.jobstring[i] = info.job[i].get_jobstring();
+   }
+
+   //
+   // Read the STAT lines once and hand each job only the lines it keeps
+   //
+   split_job_lines(info);
+
+   //
+   // Run the jobs concurrently unless they write to the same files
+   //
+   n_threads = min(get_num_threads(), n_jobs);
+
+   for(i=0; i<n_jobs && n_threads > 1; i++) {
+      if(info.job[i].dump_row) {
+         if(out_files.has(info.job[i].dump_row)) n_threads = 1;
+         else                                    out_files.add(info.job[i].dump_row);
+      }
+      if(info.job[i].stat_file) {
+         if(out_files.has(info.job[i].stat_file)) n_threads = 1;
+         else                                     out_files.add(info.job[i].stat_file);
+      }
+   }
+
+   //
+   // Concurrent jobs write their output to temp files which are
+   // copied to the output in job order
+   //
+   info.buffer_out = (n_threads > 1);
+
+   if(info.buffer_out) {
+      cs << cs_erase << tmp_dir << "/tmp_stat_analysis_out";
+      for(i=0; i<n_jobs; i++) {
+         info.out_path[i] = make_temp_file_name(cs.c_str(), NULL);
+         work_tmp_files.add(info.out_path[i]);
+      }
+   }
+
+   mlog << Debug(2) << "Running " << n_jobs << " jobs using "
+        << n_threads << " thread(s).\n";
+
+   run_thread_tasks(process_job_task, &info, n_threads, n_threads);
+
+   //
+   // Write the output of each job, stopping at the first failed job
+   //
+   for(i=0; i<n_jobs; i++) {
+
+      if(info.buffer_out && file_exists(info.out_path[i].c_str())) {
+         in.open(info.out_path[i].c_str());
+         if(sa_out) *(sa_out) << in.rdbuf() << flush;
+         else       cout      << in.rdbuf() << flush;
+         in.close();
+         in.clear();
+      }
+
+      if(info.status[i] != 0) {
+         remove_work_temps();
+         throw(info.status[i]);
+      }
+   }
+
+   remove_work_temps();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void process_job(const char * jobstring, int n_job) {
-   STATAnalysisJob job, go_job;
-   ConcatString full_jobstring;
+   STATAnalysisJob job;
+
+   set_up_job(jobstring, n_job, job);
+
+   do_job(job.get_jobstring(), job, n_job, tmp_dir, tmp_path, sa_out, 0);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void set_up_job(const char * jobstring, int n_job, STATAnalysisJob &job) {
+   STATAnalysisJob go_job;
    MetConfig go_conf;
 
    mlog << Debug(4) << "process_job(jobstring):"
@@ -725,15 +935,167 @@ void process_job(const char * jobstring, int n_job) {
       job.parse_job_command(command_line_job_options.c_str());
    }
 
-   //
-   // Get the full jobstring
-   //
-   full_jobstring = job.get_jobstring();
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Read the STAT lines from the temp file and write the lines each job
+// keeps to its own temp file.  The GO Index and SS Index jobs apply
+// their own filtering to every line and read the temp file directly.
+//
+// The STAT lines are filtered in a single pass, but each job still
+// reads back and parses the lines it keeps, so a line kept by N jobs
+// is written and parsed N more times.
+//
+////////////////////////////////////////////////////////////////////////
+
+void split_job_lines(JobTaskInfo &info) {
+   LineDataFile f;
+   STATLine line;
+   vector<int> split;
+   vector<ofstream *> out;
+   ConcatString cs;
+   int i, j, k, n_batch, n_pass;
+
+   for(i=0; i<(int) info.job.size(); i++) {
+      if(info.job[i].job_type == stat_job_go_index ||
+         info.job[i].job_type == stat_job_ss_index) {
+         info.line_path[i] = tmp_path;
+      }
+      else {
+         split.push_back(i);
+      }
+   }
+
+   cs << cs_erase << tmp_dir << "/tmp_stat_analysis_job";
 
    //
-   // Do the job
+   // Limit the number of files open at once
    //
-   do_job(full_jobstring, job, n_job, tmp_dir, tmp_path, sa_out);
+   for(i=0, n_pass=0; i<(int) split.size(); i+=n_batch, n_pass++) {
+
+      n_batch = min(max_job_line_files, (int) split.size() - i);
+
+      out.assign(n_batch, (ofstream *) 0);
+
+      for(j=0; j<n_batch; j++) {
+         k = split[i+j];
+         info.line_path[k] = make_temp_file_name(cs.c_str(), NULL);
+         work_tmp_files.add(info.line_path[k]);
+         out[j] = new ofstream;
+         out[j]->open(info.line_path[k].c_str());
+
+         if(!(*out[j])) {
+            mlog << Error << "\nsplit_job_lines() -> "
+                 << "can't open the temporary file \""
+                 << info.line_path[k] << "\" for writing!\n\n";
+            throw(1);
+         }
+      }
+
+      if(!f.open(tmp_path.c_str())) {
+         mlog << Error << "\nsplit_job_lines() -> "
+              << "can't open the temporary file \"" << tmp_path
+              << "\" for reading!\n\n";
+         throw(1);
+      }
+
+      while(f >> line) {
+
+         //
+         // Pass header lines through to every job
+         //
+         if(line.is_header()) {
+            for(j=0; j<n_batch; j++) *(out[j]) << line;
+            continue;
+         }
+
+         for(j=0; j<n_batch; j++) {
+            k = split[i+j];
+            if(info.job[k].is_keeper(line)) *(out[j]) << line;
+            else                            info.n_skip[k]++;
+         }
+      }
+
+      f.close();
+
+      for(j=0; j<n_batch; j++) {
+         out[j]->close();
+         delete out[j];
+         out[j] = (ofstream *) 0;
+      }
+   }
+
+   mlog << Debug(3) << "Split the STAT lines among " << (int) split.size()
+        << " jobs in " << n_pass << " pass(es).\n";
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Each thread runs the next job not yet started until none are left.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_job_task(void *data, int i_thread, int i_beg, int i_end) {
+   JobTaskInfo *info = (JobTaskInfo *) data;
+   const int n_jobs = (int) info->job.size();
+   ofstream out;
+   int i;
+
+   while((i = info->next_job++) < n_jobs) {
+
+      try {
+
+         if(info->buffer_out) {
+            out.open(info->out_path[i].c_str());
+
+            if(!out) {
+               mlog << Error << "\nprocess_job_task() -> "
+                    << "can't open the temporary file \""
+                    << info->out_path[i] << "\" for writing!\n\n";
+               throw(1);
+            }
+
+            do_job(info->jobstring[i], info->job[i], i+1, tmp_dir,
+                   info->line_path[i], &out, info->n_skip[i]);
+
+            out.close();
+         }
+         else {
+            do_job(info->jobstring[i], info->job[i], i+1, tmp_dir,
+                   info->line_path[i], sa_out, info->n_skip[i]);
+         }
+      }
+      catch(int j) {
+         if(out.is_open()) out.close();
+         out.clear();
+         info->status[i] = j;
+
+         //
+         // Do not start any later jobs
+         //
+         info->next_job = n_jobs;
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void remove_work_temps() {
+   int i;
+
+   for(i=0; i<work_tmp_files.n_elements(); i++) {
+      if(file_exists(work_tmp_files[i].c_str())) {
+         remove_temp_file(work_tmp_files[i]);
+      }
+   }
+
+   work_tmp_files.clear();
 
    return;
 }
@@ -747,6 +1109,11 @@ void clean_up() {
    //
    if(tmp_path.nonempty()) remove_temp_file(tmp_path);
 
+   //
+   // Delete any temp files used by the jobs
+   //
+   remove_work_temps();
+
    return;
 }
 
@@ -763,6 +1130,7 @@ void usage() {
         << "\t[-tmp_dir path]\n"
         << "\t[-log file]\n"
         << "\t[-v level]\n"
+        << "\t[-cache]\n"
         << "\t[-config config_file] | [JOB COMMAND LINE]\n\n"
 
         << "\twhere\t\"-lookin path\" specifies one or more STAT or "
@@ -782,6 +1150,11 @@ void usage() {
         << "\t\t\"-v level\" overrides the default level of logging ("
         << mlog.verbosity_level() << ") (optional).\n"
 
+        << "\t\t\"-cache\" reads each STAT file from a binary cache "
+        << "of its parsed columns, written alongside it as "
+        << "\".<file>" << stat_cache_file_ext << "\" and rebuilt "
+        << "when the STAT file changes (optional).\n"
+
         << "\t\t\"-config config_file\" specifies a STATAnalysis "
         << "config file containing STATAnalysis jobs to be run.\n"
 
@@ -880,6 +1253,12 @@ void set_config_file(const StringArray & a) {
 
 ////////////////////////////////////////////////////////////////////////
 
+void set_cache(const StringArray & a) {
+   use_stat_cache = true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 
 void open_temps()
 
@@ -35,6 +35,8 @@ using namespace std;
 #include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <atomic>
+#include <vector>
 
 #include "vx_config.h"
 #include "vx_analysis_util.h"
@@ -55,6 +57,10 @@ static const char * default_config_filename =
 
 static const char * go_index_config_file =
    "MET_BASE/config/STATAnalysisConfig_GO_Index";
+
+// Maximum number of job line files written at once when the STAT
+// lines are split among the jobs
+static const int max_job_line_files = 256;
    
 ////////////////////////////////////////////////////////////////////////
 //
@@ -76,6 +82,9 @@ static ConcatString config_file;
 // Job command which may be set on the command line
 static ConcatString command_line_job_options;
 
+// Read STAT files through the binary cache set with -cache
+static bool use_stat_cache = false;
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Variables for Output Files
@@ -90,12 +99,50 @@ static ConcatString tmp_path;
 // Output file stream for the temporary file
 static ofstream tmp_out;
 
+// Temporary files used while reading the STAT lines and running the jobs
+static StringArray work_tmp_files;
+
 // STAT-Analysis configuration object
 static MetConfig conf;
 
 // STAT-Analysis default job
 static STATAnalysisJob default_job;
 
+////////////////////////////////////////////////////////////////////////
+//
+// Data for reading the STAT files.  Each thread reads a contiguous
+// range of files.  The first thread writes its lines directly to the
+// temp file and the others to their own files, which are appended in
+// order so that the lines match those of a serial run.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct StatFileTaskInfo {
+   std::vector<ConcatString> out_path;  // Lines kept by each thread
+   std::vector<int>          n_read;    // Lines read by each thread
+   std::vector<int>          n_keep;    // Lines kept by each thread
+   std::vector<int>          status;    // Error value thrown, or 0
+   int                       max_len;   // Width of the file names
+};
+
+////////////////////////////////////////////////////////////////////////
+//
+// Data for running the config file jobs.  The STAT lines are read once
+// and the lines each job keeps are written to its own temp file.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct JobTaskInfo {
+   std::vector<STATAnalysisJob> job;
+   std::vector<ConcatString>    jobstring;
+   std::vector<ConcatString>    line_path;  // STAT lines read by the job
+   std::vector<ConcatString>    out_path;   // Job output when threaded
+   std::vector<int>             n_skip;     // Lines rejected in the split
+   std::vector<int>             status;     // Error value thrown, or 0
+   std::atomic<int>             next_job;   // Next job to be run
+   bool                         buffer_out;
+};
+
 ////////////////////////////////////////////////////////////////////////
 
 #endif   //  __STAT_ANALYSIS_H__
@@ -130,7 +130,8 @@ void set_job_from_config(MetConfig &c, STATAnalysisJob &job) {
 
 void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
             int n_job, const ConcatString &tmp_dir,
-            const ConcatString &tmp_path, ofstream *sa_out) {
+            const ConcatString &tmp_path, ofstream *sa_out,
+            int n_skip) {
    LineDataFile f;
    int n_in, n_out;
    gsl_rng *rng_ptr = (gsl_rng *) 0;
@@ -232,6 +233,11 @@ void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
          throw(1);
    }
 
+   //
+   // Include the lines rejected before the job was run
+   //
+   n_in += n_skip;
+
    mlog << Debug(2) << "Job " << n_job << " used " << n_out << " out of "
         << n_in << " STAT lines.\n";
 
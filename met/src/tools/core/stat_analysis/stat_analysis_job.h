@@ -53,7 +53,7 @@ extern void set_job_from_config(MetConfig &, STATAnalysisJob &);
 
 extern void do_job(const ConcatString &, STATAnalysisJob &, int,
                const ConcatString &, const ConcatString &,
-               ofstream *);
+               ofstream *, int);
 
 extern void do_job_filter(const ConcatString &, LineDataFile &,
                STATAnalysisJob &, int &, int &, ofstream *);
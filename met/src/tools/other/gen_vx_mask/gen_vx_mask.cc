@@ -743,18 +743,32 @@ void apply_track_mask(DataPlane &dp) {
 void apply_grid_mask(DataPlane &dp) {
    int x, y, n_in;
    bool inside;
-   double lat, lon, mask_x, mask_y;
+   double mask_x, mask_y;
+   vector<double> col_x(grid.ny()), col_y(grid.ny());
+   vector<double> col_lat(grid.ny()), col_lon(grid.ny());
 
    // Check each grid point being inside the masking grid
    for(x=0,n_in=0; x<grid.nx(); x++) {
+
+      // Lat/Lon values for the current grid column
+      for(y=0; y<grid.ny(); y++) {
+         col_x[y] = x;
+         col_y[y] = y;
+      }
+      grid.xy_to_latlon(col_x.data(), col_y.data(),
+                        col_lat.data(), col_lon.data(), grid.ny());
       for(y=0; y<grid.ny(); y++) {
+         col_lon[y] -= 360.0*floor((col_lon[y] + 180.0)/360.0);
+      }
 
-         // Lat/Lon value for the current grid point
-         grid.xy_to_latlon(x, y, lat, lon);
-         lon -= 360.0*floor((lon + 180.0)/360.0);
+      // Convert Lat/Lon to masking grid x/y
+      grid_mask.latlon_to_xy(col_lat.data(), col_lon.data(),
+                             col_x.data(), col_y.data(), grid.ny());
+
+      for(y=0; y<grid.ny(); y++) {
 
-         // Convert Lat/Lon to masking grid x/y
-         grid_mask.latlon_to_xy(lat, lon, mask_x, mask_y);
+         mask_x = col_x[y];
+         mask_y = col_y[y];
 
          // Check for point falling within the masking grid
          inside = (mask_x >= 0 && mask_x < grid_mask.nx() &&
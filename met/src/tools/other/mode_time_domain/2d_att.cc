@@ -391,7 +391,7 @@ SingleAtt2D a;
 Mtd_2D_Moments moments;
 float * values = (float *) 0;
 const int    * i = 0;
-const double * r = 0;
+const dataplane_t * r = 0;
 const int nxy = (mask_2d.nx())*(mask_2d.ny());
 int j, n;
 
@@ -22,7 +22,6 @@ using namespace std;
 #include <ctime>
 
 #include "mtd_file.h"
-#include "mtd_partition.h"
 #include "mtd_nc_defs.h"
 #include "nc_utils_local.h"
 
@@ -36,7 +35,7 @@ static MtdIntFile split(const MtdIntFile & mask, int & n_shapes);
 
 static void adjust_obj_numbers(MtdIntFile & s, int delta);
 
-static void find_overlap(const MtdIntFile & before, const MtdIntFile & after, Mtd_Partition & p);
+static void find_overlap(const MtdIntFile & before, const MtdIntFile & after, UnionFind & uf);
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -1014,22 +1013,25 @@ if ( Nt != 1 )  {
 
 }
 
-int k, i, ii;
+int j, k, n;
 int x, y, xx, yy;
-int current_shape;
-int value;
+int label, nbr;
 bool shape_assigned = false;
-MtdIntFile d;
-Mtd_Partition p;
-const MtdIntFile & id = *this;
-
+vector<int> d;
+vector<int> index;
+UnionFind uf;
+const int * id = Data;
 
+   //
+   //  neighbors already labeled:  above left, above,
+   //  upper right, and to the right
+   //
 
-d.set_size(Nx, Ny, 1);
+static const int nbr_dx[] = { -1, 0, 1, 1 };
+static const int nbr_dy[] = {  1, 1, 1, 0 };
 
-d.set_grid(*G);
 
-d.set_to_zeroes();
+d.assign(Nx*Ny, 0);
 
 n_shapes = 0;
 
@@ -1037,83 +1039,27 @@ n_shapes = 0;
    //  shape numbers start at ONE here!!
    //
 
-current_shape = 0;
-
 for (y=(Ny - 2); y>=0; --y)  {
 
    for (x=(Nx - 2); x>=0; --x)  {
 
-      shape_assigned = false;
-
-      if ( !(id(x, y, 0)) )  continue;
-
-         //
-         //  check above left
-         //
-
-      xx = x - 1;  yy = y + 1;
-
-      if ( (xx >= 0) && (yy < Ny) && id(xx, yy, 0) )  {
-
-         i  = d( x,  y, 0);
-         ii = d(xx, yy, 0);
-
-         if ( shape_assigned )  p.merge_values(i, ii);
-         else                   d.put(ii, x, y, 0);
-
-         shape_assigned = true;
+      if ( !(id[y*Nx + x]) )  continue;
 
-      }
-
-         //
-         //  check above
-         //
-
-      xx = x;  yy = y + 1;
-
-      if ( (yy < Ny) && id(xx, yy, 0) )  {
-
-         i  = d( x,  y, 0);
-         ii = d(xx, yy, 0);
-
-         if ( shape_assigned )  p.merge_values(i, ii);
-         else                   d.put(ii, x, y, 0);
-
-         shape_assigned = true;
-
-      }
-
-         //
-         //  check upper right
-         //
+      label = 0;
 
-      xx = x + 1;  yy = y + 1;
-
-      if ( (xx < Nx) && (yy < Ny) && id(xx, yy, 0) )  {
-
-         i  = d( x,  y, 0);
-         ii = d(xx, yy, 0);
-
-         if ( shape_assigned )  p.merge_values(i, ii);
-         else                   d.put(ii, x, y, 0);
+      shape_assigned = false;
 
-         shape_assigned = true;
+      for (k=0; k<4; ++k)  {
 
-      }
+         xx = x + nbr_dx[k];
+         yy = y + nbr_dy[k];
 
-         //
-         //  check to the right
-         //
+         if ( (xx < 0) || (xx >= Nx) || (yy >= Ny) || !(id[yy*Nx + xx]) )  continue;
 
-      xx = x + 1;  yy = y;
+         nbr = d[yy*Nx + xx];
 
-      if ( (xx < Nx) && id(xx, yy, 0) )  {
-
-         i  = d( x,  y, 0);
-         ii = d(xx, yy, 0);
-
-         if ( shape_assigned )  p.merge_values(i, ii);
-         else                   d.put(ii, x, y, 0);
+         if ( shape_assigned )  { if ( label != nbr )  uf.merge(label, nbr); }
+         else                   label = nbr;
 
          shape_assigned = true;
 
@@ -1123,55 +1069,40 @@ for (y=(Ny - 2); y>=0; --y)  {
          //  is it a new shape?
          //
 
-      if ( !shape_assigned )  {
-
-         ++current_shape;
-
-         d.put(current_shape, x, y, 0);
+      if ( !shape_assigned )  label = uf.add();
 
-         p.add_no_repeat(current_shape);
-
-      }
+      d[y*Nx + x] = label;
 
    }   //  for x
 
 }   //  for y
 
 
+   //
+   //  number the objects in the order of their first label
+   //
 
+uf.ordered_set_index(index);
 
 MtdIntFile q;
 
 
 q.set_size(Nx, Ny, 1);
 
-q.set_grid(id.grid());
+q.set_grid(grid());
 
 q.set_to_zeroes();
 
+n = Nx*Ny;
 
-for (x=0; x<Nx; ++x)  {
-
-   for (y=0; y<Ny; ++y)  {
-
-      i = d(x, y, 0);
-
-      value = 0;
+for (j=0; j<n; ++j)  {
 
-      for (k=0; k<(p.n_elements()); ++k)  {
-
-         if ( p.has(k, i) )  { value = k + 1;  break; }
-
-      }
-
-      q.put(value, x, y, 0);
-
-   }
+   if ( d[j] )  q.Data[j] = index[d[j]] + 1;
 
 }
 
 
-n_shapes = p.n_elements();
+n_shapes = uf.n_sets();
 
 
    //
@@ -1914,7 +1845,8 @@ MtdIntFile f2;
 MtdIntFile before;
 MtdIntFile after;
 MtdIntFile rv;
-Mtd_Partition p;
+UnionFind uf;
+vector<int> index;
 const int zero_border_size = 2;
 // int imin, imax;
 
@@ -1936,7 +1868,7 @@ before = f2.split_const_t(n_before);
 
 n_so_far = n_before;
 
-for (j=0; j<n_before; ++j)  p.add_no_repeat(j + 1);
+for (j=0; j<n_before; ++j)  uf.add();
 
 for (j=1; j<(mask.nt()); ++j)  {
 
@@ -1948,20 +1880,24 @@ for (j=1; j<(mask.nt()); ++j)  {
 
    adjust_obj_numbers(after, n_so_far);
 
-   for (k=0; k<n_after; ++k)  p.add_no_repeat(n_so_far + k + 1);
+   for (k=0; k<n_after; ++k)  uf.add();
 
    n_so_far += n_after;
 
-   find_overlap(before, after, p);
+   find_overlap(before, after, uf);
 
    before   = after;
    n_before = n_after;
 
 }
 
-// p.dump(cout);
+n_shapes = uf.n_sets();
+
+   //
+   //  number the objects in the order of their first label
+   //
 
-n_shapes = p.n_elements();
+uf.ordered_set_index(index);
 
    //
    //  use the partition
@@ -1993,7 +1929,7 @@ for (t=0; t<(mask.nt()); ++t)  {
 
          if ( v == 0 ) continue;
 
-         nc = p.which_class(v);
+         nc = ( v <= uf.n_labels() ? index[v] : -1 );
 
          if ( nc < 0 )  {
 
@@ -2064,7 +2000,7 @@ return;
 ////////////////////////////////////////////////////////////////////////
 
 
-void find_overlap(const MtdIntFile & before, const MtdIntFile & after, Mtd_Partition & p)
+void find_overlap(const MtdIntFile & before, const MtdIntFile & after, UnionFind & uf)
 
 {
 
@@ -2088,7 +2024,7 @@ for (x=0; x<nx; ++x)  {
 
       // mlog << Debug(5) << "merging values " << a << " and " << b << "\n";
 
-      p.merge_values(a, b);
+      uf.merge(a, b);
 
    }
 
@@ -282,57 +282,82 @@ void process_data_file() {
    // Open the output file
    open_nc(to_grid, run_cs);
 
-   // Loop through the requested fields
-   for(int i=0; i<FieldSA.n_elements(); i++) {
+   // Read the requested fields in groups that the input file can
+   // decode concurrently
+   const int n_fields = FieldSA.n_elements();
+   const int n_group  = get_num_threads();
+   vector<VarInfo *> vinfo_list(n_group, (VarInfo *) 0);
+   vector<DataPlane> fr_dp_list(n_group);
+   bool *status = new bool [n_group];
 
-      // Initialize
-      vinfo->clear();
+   for(int j=0; j<n_group; j++) vinfo_list[j] = v_factory.new_var_info(ftype);
 
-      // Populate the VarInfo object using the config string
-      config.read_string(FieldSA[i].c_str());
-      vinfo->set_dict(config);
+   for(int i_beg=0; i_beg<n_fields; i_beg+=n_group) {
 
-      // Get the data plane from the file for this VarInfo object
-      if(!fr_mtddf->data_plane(*vinfo, fr_dp)) {
-         mlog << Error << "\nprocess_data_file() -> trouble getting field \""
-              << FieldSA[i] << "\" from file \"" << InputFilename << "\"\n\n";
-         exit(1);
-      }
+      int n = min(n_group, n_fields - i_beg);
 
-      // Regrid the data plane
-      to_dp = met_regrid(fr_dp, fr_grid, to_grid, RGInfo);
-
-      // List range of data values
-      if(mlog.verbosity_level() >= 2) {
-         fr_dp.data_range(dmin, dmax);
-         mlog << Debug(2)
-              << "Range of input data (" << FieldSA[i] << ") is "
-              << dmin << " to " << dmax << ".\n";
-         to_dp.data_range(dmin, dmax);
-         mlog << Debug(2)
-              << "Range of regridded data (" << FieldSA[i] << ") is "
-              << dmin << " to " << dmax << ".\n";
+      // Populate the VarInfo objects using the config strings
+      for(int j=0; j<n; j++) {
+         vinfo_list[j]->clear();
+         config.read_string(FieldSA[i_beg + j].c_str());
+         vinfo_list[j]->set_dict(config);
       }
 
-      // Select output variable name
-      if(VarNameSA.n_elements() == 0) {
-         vname << cs_erase << vinfo->name();
-         if(vinfo->level().type() != LevelType_Accum &&
-            ftype != FileType_NcMet &&
-            ftype != FileType_General_Netcdf &&
-            ftype != FileType_NcPinterp &&
-            ftype != FileType_NcCF) {
-            vname << "_" << vinfo->level_name();
+      // Get the data planes from the file for these VarInfo objects
+      fr_mtddf->data_plane_list(vinfo_list.data(), n, fr_dp_list.data(), status);
+
+      // Loop through the fields in this group
+      for(int j=0; j<n; j++) {
+
+         int i = i_beg + j;
+         VarInfo *cur_vinfo = vinfo_list[j];
+         const DataPlane &cur_dp = fr_dp_list[j];
+
+         if(!status[j]) {
+            mlog << Error << "\nprocess_data_file() -> trouble getting field \""
+                 << FieldSA[i] << "\" from file \"" << InputFilename << "\"\n\n";
+            exit(1);
          }
-      }
-      else {
-         vname = VarNameSA[i];
-      }
 
-      // Write the regridded data
-      write_nc(to_dp, to_grid, vinfo, vname.c_str());
+         // Regrid the data plane
+         to_dp = met_regrid(cur_dp, fr_grid, to_grid, RGInfo);
+
+         // List range of data values
+         if(mlog.verbosity_level() >= 2) {
+            cur_dp.data_range(dmin, dmax);
+            mlog << Debug(2)
+                 << "Range of input data (" << FieldSA[i] << ") is "
+                 << dmin << " to " << dmax << ".\n";
+            to_dp.data_range(dmin, dmax);
+            mlog << Debug(2)
+                 << "Range of regridded data (" << FieldSA[i] << ") is "
+                 << dmin << " to " << dmax << ".\n";
+         }
+
+         // Select output variable name
+         if(VarNameSA.n_elements() == 0) {
+            vname << cs_erase << cur_vinfo->name();
+            if(cur_vinfo->level().type() != LevelType_Accum &&
+               ftype != FileType_NcMet &&
+               ftype != FileType_General_Netcdf &&
+               ftype != FileType_NcPinterp &&
+               ftype != FileType_NcCF) {
+               vname << "_" << cur_vinfo->level_name();
+            }
+         }
+         else {
+            vname = VarNameSA[i];
+         }
+
+         // Write the regridded data
+         write_nc(to_dp, to_grid, cur_vinfo, vname.c_str());
+
+      } // end for j
+
+   } // end for i_beg
 
-   } // end for i
+   for(int j=0; j<n_group; j++) delete vinfo_list[j];
+   delete [] status;
 
    // Close the output file
    close_nc();
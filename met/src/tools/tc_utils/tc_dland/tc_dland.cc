@@ -202,6 +202,8 @@ void process_distances() {
 
    // Instantiate the grid
    Grid grid(GridData);
+   vector<double> col_x(grid.ny()), col_y(grid.ny());
+   vector<double> col_lat(grid.ny()), col_lon(grid.ny());
    
    // NetCDF variables
    NcFile *f_out     = (NcFile *) 0;
@@ -262,6 +264,15 @@ void process_distances() {
 
    // Loop over the grid and compute the distance to land for each point   
    for(x=0,c=0; x<grid.nx(); x++) {
+
+      // Lat/Lon values for the current grid column
+      for(y=0; y<grid.ny(); y++) {
+         col_x[y] = x;
+         col_y[y] = y;
+      }
+      grid.xy_to_latlon(col_x.data(), col_y.data(),
+                        col_lat.data(), col_lon.data(), grid.ny());
+
       for(y=0; y<grid.ny(); y++) {
 
          if(++c % nlog == 0 && mlog.verbosity_level() == 3) {
@@ -271,9 +282,8 @@ void process_distances() {
          // Call two_to_one
          n = DefaultTO.two_to_one(grid.nx(), grid.ny(), x, y);
 
-         // Convert x,y to lat,lon
-         grid.xy_to_latlon(x, y, lat, lon);
-         lon = rescale_deg(lon, -180.0, 180.0);
+         lat = col_lat[y];
+         lon = rescale_deg(col_lon[y], -180.0, 180.0);
 
          // Compute distance to land
          dland[n] = land_array.min_dist(lat, lon, imin);